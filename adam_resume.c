@@ -142,6 +142,9 @@
          - g_JsonKeywordFalse
          - g_JsonKeywordNull
          - g_EntryStateLookup
+
+   Note: update enum ResumeString_e, g_ResumeStringLookup,
+         and ResumeStringFind() when adding strings here
 */
 
 #define RESUME_STRING_DATE_END       "date_end"
@@ -261,6 +264,14 @@ JSON_OBJECT_END_SECTION()
        allows for wider support of compilers without using
        any preprocessor directives.
 
+    3. platform features are only detected in SYSTEM
+       INCLUDES, which defines a RESUME_ macro for each
+       feature found. code that uses a feature checks that
+       macro. optimizations have a portable version that
+       produces the same result. features that cannot be
+       portable, such as --serve, report that they are not
+       supported instead.
+
 */
 
 //
@@ -268,6 +279,58 @@ JSON_OBJECT_END_SECTION()
 //
 /*
 
+    2026-10-18 v1.02.00
+    - render each format into an output buffer
+    - add -o to write several formats in one run
+    - order section entries once and reuse the order
+      for every output
+    - escape html special characters in html output
+    - decode json string escape sequences
+    - match json keys and values exactly with a single
+      lookup instead of comparing each resume string
+    - parse numbers without sscanf(). json numbers may
+      be negative or use a fraction or exponent as long
+      as the value is a whole number
+    - add --compile to save the loaded resume as a
+      binary snapshot and --snapshot to render from a
+      snapshot without parsing any json or dates
+    - add -j to read section data from a json file
+    - add --generate to save the resume as static c
+      tables that are built in with RESUME_GENERATED_DATA
+    - add --serve to answer render requests over a unix
+      domain socket from a resume that is loaded once
+    - add --http to serve the resume to local http clients
+      with keep-alive connections and ETags so unchanged
+      resumes are answered with 304 without rendering
+    - keep the most recently rendered resumes for --serve
+      and --http so repeated options are not rendered again
+    - add --watch to reload the json file while serving
+      without pausing requests
+    - only parse the json sections that changed when the
+      json file is reloaded
+    - add --threads to fill the resume from json sections
+      on several threads
+    - order and render sections on several threads with
+      --threads and write them with a single writev()
+    - add --batch to render every resume in a manifest on
+      a work-stealing thread pool
+    - add --cache to skip --batch jobs that are up to date
+    - add --bench to time each phase of a generated resume
+    - add --bench-json to time the json functions
+    - add --stats to print the time of each phase
+    - add --trace to write a timeline of each phase and
+      section
+    - count the allocations and peak memory of entries,
+      text, sections, and traverse arrays for --stats
+    - add --bench-memory to check the allocations of each
+      phase against a budget
+    - add --golden to check rendered outputs against golden
+      files and their render times against a baseline
+    - add --rank to display the entries of each section that
+      are most relevant to a job description first
+    - add --highlight to mark keywords in every displayed
+      entry
+
     2025-01-31 v1.01.00
     - add macros for easy json formatted strings
     - add json parser for dynamic section data
@@ -288,32 +351,161 @@ JSON_OBJECT_END_SECTION()
 */
 
 #define MAJOR_VERSION 1
-#define MINOR_VERSION 1
+#define MINOR_VERSION 2
 #define PATCH_VERSION 0
 
 //
 // MARK: SYSTEM INCLUDES
 //
 
-// included for printf(), snprintf(), sscanf()
+// selects the POSIX.1-2008 declarations before any header
+// is included so strict iso c builds such as -std=c99 and
+// -std=c11 still declare S_ISSOCK(), pthread_sigmask(),
+// sigemptyset(), sigaddset(), nanosleep(), gmtime_r(), and
+// fileno(). -std=c11 is also what selects RESUME_THREADS.
+// none of these may be implicitly declared because
+// gmtime_r() would then return an int
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// included for printf(), vprintf(), snprintf(), vsnprintf(),
+// fopen(), fwrite(), fflush(), fclose(), fileno()
 #include <stdio.h>
 
+// included for va_list, va_start(), va_copy(), va_end()
+#include <stdarg.h>
+
 // included for malloc(), realloc(), free(), rand(), srand()
 #include <stdlib.h>
 
 // included for struct tm, mktime(), struct timespec,
-// clock_gettime(), time()
+// clock_gettime(), time(), nanosleep(), gmtime(),
+// gmtime_r()
 #include <time.h>
 
-// included for memset(), memcpy(), strcmp(), strncmp()
+// included for memset(), memcpy(), strcmp(), strncmp(),
+// strchr()
 #include <string.h>
 
-// included for uint16_t
+// included for uint16_t, uint64_t, int64_t
 #include <stdint.h>
 
+// included for INT_MAX, INT_MIN
+#include <limits.h>
+
 // included for tolower()
 #include <ctype.h>
 
+// included for _mm_loadu_si128(), _mm_set1_epi8(),
+// _mm_cmpeq_epi8(), _mm_or_si128(), _mm_movemask_epi8(),
+// _mm_setzero_pd(), _mm_loadu_pd(), _mm_mul_pd(),
+// _mm_add_pd(), _mm_storeu_pd().
+// SSE2 is available on every x86-64 processor and is used
+// to scan text 16 characters at a time and to score
+// --rank entries 2 terms at a time
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define RESUME_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// included for open(), fstat(), mmap(), munmap(), close().
+// snapshots are mapped read-only where mmap() is available
+// and read into memory with fread() everywhere else
+#if defined(__unix__) || defined(__APPLE__)
+#define RESUME_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// included for stat(), struct stat, and mkdir().
+// --batch --cache checks the size and modification time of
+// each json file before reading it where stat() is available.
+// every job is rendered everywhere else. --golden creates
+// its directory where mkdir() is available. the time has
+// nanoseconds where struct stat has the POSIX.1-2008
+// st_mtim. apple only has it outside of POSIX mode so it
+// uses st_mtime seconds
+#if defined(__unix__) || defined(__APPLE__)
+#define RESUME_STAT 1
+#include <sys/stat.h>
+#if defined(__unix__) && !defined(__APPLE__)
+#define RESUME_STAT_NANO 1
+#endif
+#endif
+
+// included for __rdtsc().
+// --bench-json reports cycles per byte from the time stamp
+// counter where it is available
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define RESUME_RDTSC 1
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#define RESUME_RDTSC 1
+#include <intrin.h>
+#endif
+
+// included for writev() and struct iovec.
+// a resume rendered in parts is written with a single
+// call where writev() is available
+#if defined(__unix__) || defined(__APPLE__)
+#define RESUME_WRITEV 1
+#include <sys/uio.h>
+#endif
+
+// included for signal(), sig_atomic_t, sigset_t,
+// sigemptyset(), sigaddset(), SIG_BLOCK, SIG_SETMASK
+#include <signal.h>
+
+// included for errno
+#include <errno.h>
+
+// included for epoll_create1(), epoll_ctl(), epoll_wait(),
+// socket(), setsockopt(), bind(), listen(), accept(),
+// recv(), sendmsg(), struct msghdr, htons(), htonl(),
+// struct sockaddr_un, and struct sockaddr_in.
+// the resume server is only available on linux
+#if defined(__linux__)
+#define RESUME_SERVE 1
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#endif
+
+// included for pthread_create(), pthread_join(),
+// pthread_sigmask(), atomic_init(), atomic_load(),
+// atomic_store(), atomic_exchange(), and
+// atomic_fetch_add().
+// threads are only used where pthreads and c11 atomics
+// are both available. RESUME_ATOMIC() declares a type
+// that is atomic when threads are used and
+// RESUME_THREAD_LOCAL declares a global that each thread
+// has its own copy of
+#if (defined(__unix__) || defined(__APPLE__)) && \
+    defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && \
+    !defined(__STDC_NO_ATOMICS__)
+#define RESUME_THREADS 1
+#include <pthread.h>
+#include <stdatomic.h>
+#define RESUME_ATOMIC(type) _Atomic(type)
+#define RESUME_THREAD_LOCAL _Thread_local
+#else
+#define RESUME_ATOMIC(type) type
+#define RESUME_THREAD_LOCAL
+#endif
+
+// included for inotify_init1(), inotify_add_watch(),
+// and poll().
+// hot reload of a json file needs inotify and threads
+#if defined(RESUME_SERVE) && defined(RESUME_THREADS)
+#define RESUME_RELOAD 1
+#include <sys/inotify.h>
+#include <poll.h>
+#endif
+
 //
 // MARK: DEFINES
 //
@@ -322,6 +514,10 @@ JSON_OBJECT_END_SECTION()
 */
 #define NANO_PER_MILLI 1000000
 
+/** number of nanoseconds in 1 second
+*/
+#define NANO_PER_SECOND 1000000000
+
 /** an 8.5"x11" printed page can usually fit 60 lines.
     this value must be >= 4 or ResumeInit() will fail
 */
@@ -329,9 +525,12 @@ JSON_OBJECT_END_SECTION()
 
 /** max number of pages for the resume.
     this is the absolute max so is much larger than
-    what is actually needed
+    what is actually needed. build with
+    -DRESUME_MAX_PAGES=[count] to load larger json files
 */
+#if !defined(RESUME_MAX_PAGES)
 #define RESUME_MAX_PAGES (5)
+#endif
 
 /** max number of entries for the entire resume.
     allow for 1 entry per line of the max number of pages
@@ -370,6 +569,16 @@ JSON_OBJECT_END_SECTION()
 */
 #define DATE_STRING_LENGTH 10
 
+/** max digits of each field in DATE_STRING_FORMAT
+*/
+#define DATE_STRING_YEAR_DIGITS  4
+#define DATE_STRING_MONTH_DIGITS 2
+#define DATE_STRING_DAY_DIGITS   2
+
+/** separates the fields in DATE_STRING_FORMAT
+*/
+#define DATE_STRING_SEPARATOR '-'
+
 /** max length of the following value keywords:
     - false
     - true
@@ -377,6 +586,29 @@ JSON_OBJECT_END_SECTION()
 */
 #define JSON_VALUE_KEYWORD_MAX_LENGTH 5
 
+/** number of hex digits following "\\u" in a json string
+*/
+#define JSON_UNICODE_ESCAPE_DIGITS 4
+
+/** used in place of a json "\\u" escape sequence that
+    cannot be stored as ISO/IEC 8859-1 "Latin-1".
+    \see IMPORTANT NOTES
+*/
+#define JSON_UNICODE_REPLACEMENT_CHAR '?'
+
+/** max value of the significant digits kept while parsing
+    a number. digits beyond this are only checked to see
+    if the number is whole.
+    \see StringToInt()
+*/
+#define STRING_TO_INT_DIGITS_MAX 100000000000000000ULL
+
+/** max exponent tracked while parsing a number.
+    larger exponents overflow an int anyway.
+    \see StringToInt()
+*/
+#define STRING_TO_INT_EXPONENT_MAX 9999
+
 /** this is the max value of a signed int32.
     INT_MAX on a 32bit system is 2GB so it should
     be enough for any text being added to this resume :)
@@ -388,6 +620,321 @@ JSON_OBJECT_END_SECTION()
 */
 #define RESUME_OPTIONS_MAX_HIDDEN_SECTIONS 32
 
+/** initial number of bytes allocated by an OutputBuffer_t.
+    a complete resume is usually a few kilobytes so most
+    renders never need to grow the buffer
+*/
+#define OUTPUT_BUFFER_INITIAL_SIZE 8192
+
+/** max number of format and destination pairs that can
+    be selected with the -o command line option
+*/
+#define MAIN_MAX_OUTPUTS 8
+
+/** output destination used for standard out
+*/
+#define MAIN_OUTPUT_STDOUT "-"
+
+/** first bytes of every snapshot file including
+    the null-terminator. \see SnapshotHeader_s
+*/
+#define SNAPSHOT_MAGIC "RSNAP"
+
+/** number of bytes used by SNAPSHOT_MAGIC
+*/
+#define SNAPSHOT_MAGIC_LENGTH 8
+
+/** changes any time the snapshot layout changes so old
+    snapshots are rejected instead of misread
+*/
+#define SNAPSHOT_VERSION 1
+
+/** written in the byte order of the machine that compiled
+    the snapshot. a snapshot from a machine with a different
+    byte order will not match and is rejected
+*/
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+/** every snapshot table starts at a multiple of this many
+    bytes so the tables can be used directly from the
+    mapped file
+*/
+#define SNAPSHOT_ALIGNMENT 8
+
+/** max number of bytes in a single server request.
+    a connection that sends more without completing
+    a request is closed
+*/
+#define SERVER_MAX_REQUEST_LENGTH 4096
+
+/** max number of events handled by each epoll_wait()
+*/
+#define SERVER_MAX_EVENTS 64
+
+/** max number of connections waiting to be accepted
+*/
+#define SERVER_LISTEN_BACKLOG 64
+
+/** max number of open connections. a connection accepted
+    after this is closed right away
+*/
+#define SERVER_MAX_CONNECTIONS 256
+
+/** max number of response bytes waiting to be sent before
+    a connection stops answering and reading requests.
+    a few renders so a client that sends requests without
+    reading the responses cannot grow the output forever
+*/
+#define SERVER_MAX_PENDING_OUTPUT (256 * 1024)
+
+/** max number of response parts sent by each sendmsg()
+*/
+#define SERVER_MAX_WRITE_PARTS 64
+
+/** number of response parts a connection makes room for
+    each time it needs more
+*/
+#define SERVER_RESPONSE_PARTS_GROW 16
+
+/** max number of options in a single --serve request
+    or query parameters in a single --http request
+*/
+#define MAIN_SERVE_MAX_ARGS 64
+
+/** largest port number for --http
+*/
+#define SERVER_PORT_MAX 65535
+
+/** number of bytes needed to store an --http ETag
+    including the quotes and null-terminator
+*/
+#define MAIN_HTTP_ETAG_LENGTH 32
+
+/** number of bytes needed to store the headers written
+    with a rendered --http response
+*/
+#define MAIN_HTTP_HEADERS_LENGTH 160
+
+/** content type of every --http response that is not
+    a rendered resume
+*/
+#define MAIN_HTTP_TEXT_HEADER "Content-Type: text/plain; charset=ISO-8859-1\r\n"
+
+/** max number of rendered resumes kept by a RenderCache_t.
+    the least recently used is replaced when it is full
+*/
+#define RENDER_CACHE_MAX_ENTRIES 16
+
+/** max number of threads selected with --threads
+*/
+#define RESUME_MAX_THREADS 64
+
+/** max number of options on a single line of a
+    --batch manifest including the input and output
+*/
+#define BATCH_MAX_ARGS 64
+
+/** number of jobs a Batch_t has room for before it
+    first grows
+*/
+#define BATCH_INITIAL_JOBS 64
+
+/** number of values on each line of a --cache file.
+    the destination, json file size, json file modification
+    time, json file hash, and job key
+*/
+#define BATCH_CACHE_ARGS 5
+
+/** max number of --bench iterations. each phase keeps a
+    time for every iteration
+*/
+#define BENCH_MAX_ITERATIONS 100000
+
+/** max length of the text of a --bench entry
+*/
+#define BENCH_MAX_TEXT_LENGTH 4096
+
+/** max size in bytes of each --bench-json corpus
+*/
+#define BENCH_MAX_CORPUS_SIZE (64 * 1024 * 1024)
+
+/** max depth of the objects in the --bench-json nested
+    corpus. the json functions are recursive
+*/
+#define BENCH_MAX_DEPTH 256
+
+/** allocations every --bench-memory phase may make
+    that do not depend on the size of the resume
+*/
+#define BENCH_BUDGET_FIXED_ALLOCS 16
+
+/** bytes every --bench-memory phase may use that do not
+    depend on the size of the resume
+*/
+#define BENCH_BUDGET_FIXED_BYTES (16 * 1024)
+
+/** max allocations of the first --bench-memory render.
+    the output buffer doubles so this allows for outputs
+    much larger than any resume
+*/
+#define BENCH_BUDGET_RENDER_ALLOCS 32
+
+/** number of timed samples of each --golden output. the
+    fastest sample is compared to the baseline
+*/
+#define GOLDEN_SAMPLES 15
+
+/** min nanoseconds of each --golden sample. the output is
+    rendered again until the sample is this long so a
+    render of a few microseconds is not lost in the
+    resolution and noise of the clock
+*/
+#define GOLDEN_MIN_SAMPLE_NANO 1000000
+
+/** a --golden output is slower when its render time is
+    this many percent over the baseline
+*/
+#define GOLDEN_MAX_SLOWER_PERCENT 25
+
+/** a --golden output is only slower when its render time
+    is also this many nanoseconds over the baseline
+*/
+#define GOLDEN_MIN_SLOWER_NANO 2000
+
+/** max length of the path of a --golden file. a longer
+    directory is an error
+*/
+#define GOLDEN_MAX_PATH 1024
+
+/** max length of the name of a --golden file without
+    the directory
+*/
+#define GOLDEN_MAX_NAME 64
+
+/** number of option sets rendered by --golden.
+    \see g_GoldenCases
+*/
+#define GOLDEN_CASE_COUNT 7
+
+/** number of sections hidden by the --golden option sets
+    that hide sections. \see g_GoldenHidden
+*/
+#define GOLDEN_HIDDEN_COUNT 2
+
+/** max length of the --batch manifest line of a
+    --golden option set. \see m_CaseManifest
+*/
+#define GOLDEN_MAX_MANIFEST 256
+
+/** name of the --golden file with the render time of
+    every output
+*/
+#define GOLDEN_BASELINE_FILE "baseline.txt"
+
+/** max bytes of a --rank term. longer words are matched
+    by their first bytes
+*/
+#define RANK_MAX_TERM_LENGTH 32
+
+/** number of words in g_RankStopWords
+*/
+#define RANK_STOP_WORD_COUNT 32
+
+/** how quickly more uses of a term in an entry stop
+    raising its --rank score
+*/
+#define RANK_TERM_SATURATION 1.2
+
+/** how much a long entry is penalized for having more
+    terms. 0 is none and 1 is in proportion to its length
+*/
+#define RANK_LENGTH_PENALTY 0.75
+
+/** max bytes of every --highlight keyword together
+*/
+#define HIGHLIGHT_MAX_KEYWORD_BYTES 65536
+
+/** number of --trace events each thread keeps. when a
+    thread records more events the oldest are replaced
+*/
+#define TRACE_RING_SIZE 4096
+
+/** max number of threads that record --trace events
+*/
+#define TRACE_MAX_THREADS 64
+
+/** max length of the detail of a --trace event such as a
+    section title. longer details are cut short
+*/
+#define TRACE_MAX_DETAIL 40
+
+/** max number of buffers written by a single call to
+    writev() in OutputBufferWriteAll()
+*/
+#define OUTPUT_BUFFER_MAX_WRITE_PARTS 64
+
+/** number of json sections a SectionParser_t has room
+    for before it first grows
+*/
+#define SECTION_PARSER_INITIAL_JOBS 16
+
+/** max number of threads that can read a ResumeShared_t
+    at the same time. each uses its own reader index
+*/
+#define RESUME_SHARED_MAX_READERS 8
+
+/** reader index used by the server thread
+*/
+#define SERVER_RESUME_READER 0
+
+/** reader index used by the reload thread
+*/
+#define RELOAD_RESUME_READER 1
+
+/** reader epoch of a reader that is not reading
+*/
+#define RESUME_SHARED_IDLE 0
+
+/** number of milliseconds ResumeSharedPublish() waits
+    before checking the readers again
+*/
+#define RESUME_SHARED_WAIT_MILLI 1
+
+/** number of milliseconds the reload thread waits for
+    a change before checking if it should stop
+*/
+#define RELOAD_POLL_MILLI 250
+
+/** number of milliseconds without another change before
+    a changed file is reloaded. editors often write a file
+    in several steps
+*/
+#define RELOAD_SETTLE_MILLI 50
+
+/** number of bytes read from inotify at once
+*/
+#define RELOAD_EVENT_BUFFER_SIZE 4096
+
+/** starting value of a 32-bit FNV-1a hash.
+    see HashFnv1a()
+*/
+#define HASH_FNV_OFFSET 2166136261u
+
+/** multiplier of a 32-bit FNV-1a hash.
+    see HashFnv1a()
+*/
+#define HASH_FNV_PRIME 16777619u
+
+/** starting value of a 64-bit FNV-1a hash.
+    see HashFnv1a64()
+*/
+#define HASH_FNV64_OFFSET 14695981039346656037ull
+
+/** multiplier of a 64-bit FNV-1a hash.
+    see HashFnv1a64()
+*/
+#define HASH_FNV64_PRIME 1099511628211ull
+
 //
 // MARK: ENUMS
 //
@@ -419,7 +966,52 @@ enum Exit_e
     EXIT_EXTENDED_COUNT_MISSING     = -6,
     EXIT_UNKNOWN_ARG                = -7,
     EXIT_FILL_ERROR                 = -8,
-    EXIT_RESUME_INIT_ERROR          = -9
+    EXIT_RESUME_INIT_ERROR          = -9,
+    EXIT_OUTPUT_UNKNOWN_FORMAT      = -10,
+    EXIT_OUTPUT_ARG_MISSING         = -11,
+    EXIT_OUTPUT_SELECTION_MISSING   = -12,
+    EXIT_OUTPUT_DESTINATION_MISSING = -13,
+    EXIT_OUTPUT_TOO_MANY            = -14,
+    EXIT_OUTPUT_WRITE_ERROR         = -15,
+    EXIT_COMPILE_DESTINATION_MISSING = -16,
+    EXIT_COMPILE_WRITE_ERROR        = -17,
+    EXIT_SNAPSHOT_FILE_MISSING      = -18,
+    EXIT_SNAPSHOT_LOAD_ERROR        = -19,
+    EXIT_GENERATE_DESTINATION_MISSING = -20,
+    EXIT_GENERATE_WRITE_ERROR       = -21,
+    EXIT_JSON_FILE_MISSING          = -22,
+    EXIT_JSON_FILE_READ_ERROR       = -23,
+    EXIT_SERVE_SOCKET_MISSING       = -24,
+    EXIT_SERVE_ERROR                = -25,
+    EXIT_HTTP_PORT_MISSING          = -26,
+    EXIT_HTTP_PORT_INVALID          = -27,
+    EXIT_WATCH_INVALID              = -28,
+    EXIT_WATCH_ERROR                = -29,
+    EXIT_THREADS_MISSING            = -30,
+    EXIT_THREADS_INVALID            = -31,
+    EXIT_BATCH_MANIFEST_MISSING     = -32,
+    EXIT_BATCH_MANIFEST_INVALID     = -33,
+    EXIT_BATCH_ERROR                = -34,
+    EXIT_BATCH_CACHE_MISSING        = -35,
+    EXIT_BATCH_CACHE_UNUSED         = -36,
+    EXIT_BENCH_SPEC_MISSING         = -37,
+    EXIT_BENCH_SPEC_INVALID         = -38,
+    EXIT_BENCH_ERROR                = -39,
+    EXIT_TRACE_FILE_MISSING         = -40,
+    EXIT_TRACE_WRITE_ERROR          = -41,
+    EXIT_BENCH_OVER_BUDGET          = -42,
+    EXIT_GOLDEN_DIRECTORY_MISSING   = -43,
+    EXIT_GOLDEN_MISMATCH            = -44,
+    EXIT_GOLDEN_SLOWER              = -45,
+    EXIT_GOLDEN_ERROR               = -46,
+    EXIT_RANK_FILE_MISSING          = -47,
+    EXIT_RANK_FILE_READ_ERROR       = -48,
+    EXIT_HIGHLIGHT_FILE_MISSING     = -49,
+    EXIT_HIGHLIGHT_FILE_READ_ERROR  = -50,
+    EXIT_HIGHLIGHT_KEYWORDS_INVALID = -51,
+    EXIT_GOLDEN_MISSING             = -52,
+    EXIT_SNAPSHOT_INVALID           = -53,
+    EXIT_COMPILE_INVALID            = -54
 };
 
 /** months
@@ -460,6 +1052,124 @@ typedef enum Order_e
     ORDER_COUNT
 } Order_t;
 
+/** each phase of a --bench iteration in the order they run.
+    \see g_BenchPhaseLookup
+*/
+typedef enum BenchPhase_e
+{
+    BENCH_PHASE_INIT = 0,
+    BENCH_PHASE_FILL,
+    BENCH_PHASE_ORDER,
+    BENCH_PHASE_RENDER_TEXT,
+    BENCH_PHASE_RENDER_HTML,
+    BENCH_PHASE_DEINIT,
+    BENCH_PHASE_COUNT
+} BenchPhase_t;
+
+/** each phase of ResumeLoad() in the order they run.
+    \see ResumeLoadCallback_t
+*/
+typedef enum LoadPhase_e
+{
+    LOAD_PHASE_FILL = 0,
+    LOAD_PHASE_FILL_JSON,
+    LOAD_PHASE_ORDER,
+    LOAD_PHASE_DONE,
+    LOAD_PHASE_COUNT
+} LoadPhase_t;
+
+/** each phase timed by --stats in the order they run.
+    \see g_StatsPhaseLookup
+*/
+typedef enum StatsPhase_e
+{
+    STATS_PHASE_INIT = 0,
+    STATS_PHASE_READ,
+    STATS_PHASE_FILL_HARD_CODED,
+    STATS_PHASE_FILL_JSON,
+    STATS_PHASE_FILL_SNAPSHOT,
+    STATS_PHASE_ORDER,
+    STATS_PHASE_RENDER,
+    STATS_PHASE_WRITE,
+    STATS_PHASE_COUNT
+} StatsPhase_t;
+
+/** each json function timed by --bench-json.
+    \see g_BenchPrimitiveLookup
+*/
+typedef enum BenchPrimitive_e
+{
+    BENCH_PRIMITIVE_SKIP = 0,
+    BENCH_PRIMITIVE_STRING,
+    BENCH_PRIMITIVE_ARRAY,
+    BENCH_PRIMITIVE_OBJECT,
+    BENCH_PRIMITIVE_COUNT
+} BenchPrimitive_t;
+
+/** each json corpus generated by --bench-json.
+    every corpus is an array of objects.
+    \see g_BenchCorpusLookup
+*/
+typedef enum BenchCorpus_e
+{
+    BENCH_CORPUS_FLAT = 0,
+    BENCH_CORPUS_NESTED,
+    BENCH_CORPUS_ESCAPES,
+    BENCH_CORPUS_PRETTY,
+    BENCH_CORPUS_COUNT
+} BenchCorpus_t;
+
+/** each kind of span recorded by --trace.
+    \see g_TraceSpanLookup
+*/
+typedef enum TraceSpan_e
+{
+    TRACE_SPAN_PHASE = 0,
+    TRACE_SPAN_PARSE,
+    TRACE_SPAN_ENTRIES,
+    TRACE_SPAN_ORDER,
+    TRACE_SPAN_RENDER,
+    TRACE_SPAN_COUNT
+} TraceSpan_t;
+
+/** each part of the resume that memory is counted for.
+    \see g_MemoryKindLookup
+*/
+typedef enum MemoryKind_e
+{
+    MEMORY_ENTRIES = 0,
+    MEMORY_TEXT,
+    MEMORY_SECTIONS,
+    MEMORY_TRAVERSE,
+    MEMORY_OUTPUT,
+    MEMORY_THREADS,
+    MEMORY_RANK,
+    MEMORY_HIGHLIGHT,
+    MEMORY_COUNT
+} MemoryKind_t;
+
+/** identifies each of the RESUME STRINGS.
+    \see g_ResumeStringLookup and ResumeStringFind()
+*/
+typedef enum ResumeString_e
+{
+    RESUME_STRING_ID_UNKNOWN = 0,
+    RESUME_STRING_ID_DATE_END,
+    RESUME_STRING_ID_DATE_OPTION,
+    RESUME_STRING_ID_DATE_ORDER,
+    RESUME_STRING_ID_DATE_START,
+    RESUME_STRING_ID_DISPLAY_MAX,
+    RESUME_STRING_ID_ENTRIES,
+    RESUME_STRING_ID_NAME,
+    RESUME_STRING_ID_NEWEST_FIRST,
+    RESUME_STRING_ID_OLDEST_FIRST,
+    RESUME_STRING_ID_ORDER,
+    RESUME_STRING_ID_RANDOM,
+    RESUME_STRING_ID_SHOW_YEAR_ONLY,
+    RESUME_STRING_ID_TEXT,
+    RESUME_STRING_ID_COUNT
+} ResumeString_t;
+
 /** hard-coded resume sections used for filtering.
     Note: update ResumeFillSectionsFromHardCoded() and
           ResumeFillEntriesFromHardCoded() when making
@@ -518,6 +1228,11 @@ typedef enum EntryState_e
     */
     ENTRY_STATE_ERROR_TEXT_MISSING,
 
+    /** entry text is not a valid json string.
+        this can happen if it has an invalid escape
+    */
+    ENTRY_STATE_ERROR_TEXT_INVALID,
+
     /** start date is invalid
     */
     ENTRY_STATE_ERROR_START_DATE,
@@ -573,6 +1288,11 @@ typedef enum JsonState_e
     */
     JSON_STATE_ERROR_LEADING_DECIMAL,
 
+    /** a json number exponent must have at least one
+        digit after the 'e' or 'E' and optional sign
+    */
+    JSON_STATE_ERROR_MISSING_EXPONENT,
+
     /** the start of a string is missing the '"'
     */
     JSON_STATE_ERROR_STRING_MISSING_START,
@@ -587,6 +1307,12 @@ typedef enum JsonState_e
     */
     JSON_STATE_ERROR_STRING_MISSING_ESCAPED_CHAR,
 
+    /** an escape character '\\' was followed by a
+        character that cannot be escaped or "\\u" was
+        not followed by 4 hex digits
+    */
+    JSON_STATE_ERROR_STRING_INVALID_ESCAPE,
+
     /** a valid string was found but the next
         non-whitespace character was not one
         of the following: ',', ']', '}', ':', or '\0'
@@ -704,6 +1430,104 @@ typedef struct ManagedEntries_s  ManagedEntries_t;
 typedef struct SectionData_s     SectionData_t;
 typedef struct ResumeOptions_s   ResumeOptions_t;
 typedef struct Resume_s          Resume_t;
+typedef struct OutputBuffer_s    OutputBuffer_t;
+typedef struct SharedOutput_s    SharedOutput_t;
+typedef struct SnapshotHeader_s  SnapshotHeader_t;
+typedef struct SnapshotSection_s SnapshotSection_t;
+typedef struct SnapshotEntry_s   SnapshotEntry_t;
+typedef struct Snapshot_s        Snapshot_t;
+typedef struct ServerPart_s      ServerPart_t;
+typedef struct ServerResponse_s  ServerResponse_t;
+typedef struct ServerConnection_s ServerConnection_t;
+typedef struct Server_s          Server_t;
+typedef struct MainServe_s       MainServe_t;
+typedef struct MainStats_s       MainStats_t;
+typedef struct RenderCacheEntry_s RenderCacheEntry_t;
+typedef struct RenderCache_s     RenderCache_t;
+typedef struct ResumeShared_s    ResumeShared_t;
+typedef struct ResumeReload_s    ResumeReload_t;
+typedef struct SectionJob_s      SectionJob_t;
+typedef struct SectionParser_s   SectionParser_t;
+typedef struct SectionPool_s     SectionPool_t;
+typedef struct ResumeRender_s    ResumeRender_t;
+typedef struct RankTerm_s        RankTerm_t;
+typedef struct RankOrder_s       RankOrder_t;
+typedef struct Rank_s            Rank_t;
+typedef struct Highlight_s       Highlight_t;
+typedef struct BatchCacheEntry_s BatchCacheEntry_t;
+typedef struct BatchJob_s        BatchJob_t;
+typedef struct BatchWorker_s     BatchWorker_t;
+typedef struct Batch_s           Batch_t;
+typedef struct BenchSpec_s       BenchSpec_t;
+typedef struct Bench_s           Bench_t;
+typedef struct BenchMemory_s     BenchMemory_t;
+typedef struct TraceEvent_s      TraceEvent_t;
+typedef struct TraceRing_s       TraceRing_t;
+typedef struct Trace_s           Trace_t;
+typedef struct GoldenCase_s      GoldenCase_t;
+typedef struct Golden_s          Golden_t;
+typedef struct MemoryHeader_s    MemoryHeader_t;
+typedef struct MemoryCounters_s  MemoryCounters_t;
+typedef struct Memory_s          Memory_t;
+
+//
+// MARK: CALLBACK DEFINITIONS
+//
+
+/** callback function definition used by EntriesFind()
+    \param entry the entry within the entries being searched
+    \param entryTime the entry time to use for comparison
+    \param userData the data passed into EntriesFind()
+    \returns RESULT_OK when the entry is correct,
+             RESULT_ERROR to cancel the search, or
+             RESULT_NEXT to continue searching
+*/
+typedef Result_t (*EntriesFindCallback_t)(
+    Entry_t* entry,
+    EntryTime_t entryTime,
+    void* userData);
+
+/** callback function definition used by ResumeLoad()
+    to measure each phase
+    \param phase the phase that is starting or
+                 LOAD_PHASE_DONE after the last phase
+    \param userData the data passed into ResumeLoad()
+*/
+typedef void (*ResumeLoadCallback_t)(
+    LoadPhase_t phase,
+    void* userData);
+
+/** callback function definition used by ServerRun()
+    to answer requests
+    \param request the data received on a connection that
+                   has not been used yet. it is not
+                   null-terminated and may be modified
+    \param requestLength number of bytes at request
+    \param response the responses of the connection to
+                    write to. see ServerResponseAttach()
+    \param userData the data passed into ServerInit()
+    \returns number of request bytes used by a complete
+             request, 0 if the request is not complete yet,
+             or INVALID_POSITION to close the connection
+             after the response is sent
+*/
+typedef int (*ServerRequestCallback_t)(
+    char* request,
+    int requestLength,
+    ServerResponse_t* response,
+    void* userData);
+
+/** callback function definition used by SectionPoolRun()
+    \param sectionData the section to work on. no other
+                       thread uses it at the same time
+    \param section the index of sectionData in the resume
+    \param userData the data passed into SectionPoolRun()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+typedef Result_t (*SectionPoolCallback_t)(
+    SectionData_t* sectionData,
+    Section_t section,
+    void* userData);
 
 //
 // MARK: STRUCTS
@@ -721,6 +1545,13 @@ struct Entry_s
     */
     time_t m_EntryTimestamp[ENTRY_TIME_COUNT];
 
+    /** number of ManagedEntries_t that own this entry.
+        a reloaded resume shares the entries of sections
+        that did not change with the previous resume.
+        only changed by the thread that loads resumes
+    */
+    int m_EntryReferences;
+
 };
 
 /** stores an array of Entry_t including
@@ -742,6 +1573,11 @@ struct Entries_s
     */
     int m_EntriesUsed;
 
+    /** what m_Entries is counted as. MEMORY_SECTIONS
+        unless it is changed after EntriesInit()
+    */
+    MemoryKind_t m_EntriesMemory;
+
 };
 
 /** used to traverse entries from Entries_t
@@ -811,6 +1647,24 @@ struct SectionData_s
     */
     Entries_t m_SectionEntries;
 
+    /** all entries for this section in display order.
+        this is filled by SectionDataGetOrderedEntries()
+        and reused by every render until another entry
+        is included in this section
+    */
+    EntriesTraverse_t m_SectionOrdered;
+
+    /** 64-bit FNV-1a hash of the json object this
+        section was filled from or 0 if it was not
+        filled from json
+    */
+    uint64_t m_SectionFingerprint;
+
+    /** nanoseconds spent ordering m_SectionOrdered the
+        last time it was ordered. see --stats
+    */
+    int64_t m_SectionOrderNano;
+
     /** pointer to the next section
     */
     SectionData_t* m_SectionNext;
@@ -841,6 +1695,22 @@ struct ResumeOptions_s
     /** number of sections to hide in m_HideSectionName
     */
     int m_HideSectionCount;
+
+    /** number of threads used to fill the resume from
+        json. 1 or less fills it on the calling thread
+    */
+    int m_ThreadCount;
+
+    /** keywords or a job description. the entries of each
+        section most relevant to it are displayed first.
+        NULL to display entries in section order
+    */
+    const char* m_RankText;
+
+    /** keywords marked in the text of every displayed
+        entry. NULL to display the text as it is
+    */
+    const Highlight_t* m_Highlight;
 };
 
 /** resume data organizes entries into sections
@@ -877,3900 +1747,17526 @@ struct Resume_s
     */
     ResumeOptions_t m_ResumeOptions;
 
-};
+    /** every entry loaded from a snapshot in a single
+        allocation. the entry text points into the snapshot
+        data so these entries are never deinit.
+        NULL unless the resume was filled from a snapshot
+    */
+    Entry_t* m_ResumeSnapshotEntries;
 
-//
-// MARK: CALLBACK DEFINITIONS
-//
+    /** the snapshot file used by m_ResumeSnapshotEntries
+    */
+    Snapshot_t* m_ResumeSnapshot;
 
-/** callback function definition used by EntriesFind()
-    \param entry the entry within the entries being searched
-    \param entryTime the entry time to use for comparison
-    \param userData the data passed into EntriesFind()
-    \returns RESULT_OK when the entry is correct,
-             RESULT_ERROR to cancel the search, or
-             RESULT_NEXT to continue searching
-*/
-typedef Result_t (*EntriesFindCallback_t)(
-    Entry_t* entry,
-    EntryTime_t entryTime,
-    void* userData);
+    /** incremented by every function that changes the
+        sections, their entries, or the order the entries
+        are displayed in. anything rendered from the resume
+        is out of date once this changes
+    */
+    uint32_t m_ResumeGeneration;
 
-//
-// MARK: PROTOTYPES
-//
+    /** term index of every entry used by
+        ResumeRankSections() or NULL until the resume is
+        ranked. it is built again once m_ResumeGeneration
+        is not m_ResumeRankGeneration
+    */
+    Rank_t* m_ResumeRank;
 
-// --- MAIN ---
+    /** m_ResumeGeneration after m_ResumeRank was last
+        used to rank the sections
+    */
+    uint32_t m_ResumeRankGeneration;
 
-/** print help to standard out
-*/
-static void MainPrintHelp(
-    const char* programName);
+};
 
-/** print version to standard out
+/** stores text written by the resume renderers so it
+    can be sent to one or more destinations
 */
-static void MainPrintVersion(void);
+struct OutputBuffer_s
+{
+    /** text data which is not null-terminated
+    */
+    char* m_OutputData;
 
-// --- STRING ---
+    /** number of bytes in use at m_OutputData
+    */
+    int m_OutputLength;
 
-/** set text by performing a deep copy of src or using
-    a shared empty string for NULL or empty strings
-    \param dest pointer to the string to update
-    \param src the string source or NULL to clear the text
-    \returns RESULT_OK or RESULT_ERROR
-*/
-static Result_t SetText(
-    char** dest,
-    const char* src);
-
-/** set text by performing a deep copy of src or using
-    a shared empty string for NULL or empty strings
-    \param dest pointer to the string to update
-    \param src the string source or NULL to clear the text
-    \param srcLength the max number of bytes to copy, which
-                     will not exceed those up to the
-                     null-terminator of src
-    \returns RESULT_OK or RESULT_ERROR
-*/
-static Result_t SetTextSubstr(
-    char** dest,
-    const char* src,
-    int srcLength);
+    /** number of bytes allocated at m_OutputData
+    */
+    int m_OutputMax;
 
-/** search for an uppercase character
-    \param text
-    \param maxChars max number of characters
-           to search through
-    \returns position of the uppercase character or
-             INVALID_POSITION if not found
-*/
-static int FindUppercase(
-    const char* text,
-    int maxChars);
+    /** set to RESULT_ERROR if any write to this buffer
+        failed. otherwise RESULT_OK
+    */
+    Result_t m_OutputResult;
 
-// --- TIME AND DATE ---
+};
 
-/** get the number of days in the specified month
-    \param month \see Month_e
-    \param year used to determine leap year.
-           use YEAR_UNKNOWN if unsure.
-    \returns the number of days 31, 30, 29, or 28
+/** an output buffer with several owners so it can be
+    sent without being copied. it is freed when the last
+    owner releases it. only used by a single thread
 */
-static int GetDaysInMonth(
-    int month,
-    int year);
+struct SharedOutput_s
+{
+    /** the shared output
+    */
+    OutputBuffer_t m_SharedBuffer;
 
-/** get a date string from the timestamp
-    \param time the timestamp
-    \param dest location to store the string
-    \param destLength bytes available at dest
-    \param dateOption control whether the year, month, and
-           day are written to the string
-*/
-static int TimeToDateString(
-    time_t time,
-    char* dest,
-    int destLength,
-    DateOption_t dateOption);
+    /** number of owners
+    */
+    int m_SharedReferences;
 
-/** get the timestamp from the date string
-    \param time optional pointer to the time to update.
-           use NULL and check for RESULT_ERROR if just
-           checking if date is valid.
-    \param date optional date in DATE_STRING_FORMAT
-           use NULL or empty string for no date.
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+};
+
+/** first bytes of a snapshot file. a snapshot is a
+    position-independent image of a resume so it can be
+    used directly from a read-only mapping. it contains:
+    - SnapshotHeader_t
+    - SnapshotSection_t table in display order
+    - SnapshotEntry_t table grouped by section
+    - string pool of null-terminated strings
+    every table is referenced by byte offset from the start
+    of the file and every string by byte offset from the
+    start of the string pool
 */
-static Result_t TimeFromDateString(
-    time_t* time,
-    const char* date);
+struct SnapshotHeader_s
+{
+    /** SNAPSHOT_MAGIC
+    */
+    char m_SnapshotMagic[SNAPSHOT_MAGIC_LENGTH];
 
-// --- ENTRIES ---
+    /** SNAPSHOT_VERSION
+    */
+    uint32_t m_SnapshotVersion;
 
-/** init. call EntriesResize() after init to set size of
-    this array.
-    \param me
-*/
-static void EntriesInit(
-    Entries_t* me);
+    /** SNAPSHOT_BYTE_ORDER
+    */
+    uint32_t m_SnapshotByteOrder;
 
-/** deinit
-    \param me
-*/
-static void EntriesDeInit(
-    Entries_t* me);
+    /** size of the entire snapshot in bytes
+    */
+    uint32_t m_SnapshotSize;
 
-/** resize the entries array
-    \param me
-    \param max the max number of entries this array
-           should be able to store
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t EntriesResize(
-    Entries_t* me,
-    int max);
+    /** number of SnapshotSection_t and where they start
+    */
+    uint32_t m_SnapshotSectionCount;
+    uint32_t m_SnapshotSectionOffset;
 
-/** append an entry to the end of the array
-    \param me
-    \param entry a pointer to the entry to append
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t EntriesAppend(
-    Entries_t* me,
-    Entry_t* entry);
+    /** number of SnapshotEntry_t and where they start
+    */
+    uint32_t m_SnapshotEntryCount;
+    uint32_t m_SnapshotEntryOffset;
 
-/** insert an entry at the specified index within the array
-    \param me
-    \param entry a pointer to the entry to append
-    \param index the position to insert between 0 and the
-           current number of entries
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t EntriesInsertAt(
-    Entries_t* me,
-    Entry_t* entry,
-    int index);
+    /** size of the string pool and where it starts
+    */
+    uint32_t m_SnapshotPoolSize;
+    uint32_t m_SnapshotPoolOffset;
 
-/** an EntriesFindCallback_t to find an older entry.
-    see EntriesFind()
-    \param entry
-    \param entryTime
-    \param userData pointer to an Entry_t to compare to
-    \returns RESULT_OK if entry is older than userData
-*/
-static Result_t CallbackEntryIsOlder(
-    Entry_t* entry,
-    EntryTime_t entryTime,
-    void* userData);
+    /** always 0. keeps the header size a multiple
+        of SNAPSHOT_ALIGNMENT
+    */
+    uint32_t m_SnapshotReserved;
 
-/** an EntriesFindCallback_t to find a newer entry.
-    see EntriesFind()
-    \param entry
-    \param userData pointer to an Entry_t to compare to
-    \returns RESULT_OK if entry is newer than userData
-*/
-static Result_t CallbackEntryIsNewer(
-    Entry_t* entry,
-    EntryTime_t entryTime,
-    void* userData);
+};
 
-/** find an entry
-    \param me
-    \param findCallback callback to define find conditions
-    \param entryTime the time to compare while searching
-    \param userData passed to the callback
-    \returns the index of the entry that was found or
-             INVALID_POSITION if not found
+/** snapshot version of SectionData_t
 */
-static int EntriesFind(
-    Entries_t* me,
-    EntriesFindCallback_t findCallback,
-    EntryTime_t entryTime,
-    void* userData);
+struct SnapshotSection_s
+{
+    /** title position in the string pool and its length
+        not including the null-terminator
+    */
+    uint32_t m_SnapshotTitleOffset;
+    uint32_t m_SnapshotTitleLength;
 
-/** remove an entry from the end of the array
-    \param me
-    \returns a pointer to the entry or NULL if none exist
-*/
-static Entry_t* EntriesTakeLast(
-    Entries_t* me);
+    /** see SectionData_s
+    */
+    int32_t m_SnapshotDisplayMax;
+    int32_t m_SnapshotOrder;
+    int32_t m_SnapshotOrderEntryTime;
+    uint32_t m_SnapshotDateOption;
+
+    /** index of the first SnapshotEntry_t of this section
+        and the number of entries. unless the order is
+        ORDER_RANDOM the entries are already in display
+        order
+    */
+    uint32_t m_SnapshotFirstEntry;
+    uint32_t m_SnapshotEntryCount;
 
-// --- ENTRIES TRAVERSE ---
+};
 
-/** init. call EntriesTraverseFirst() after init to
-    begin traversing an array
-    \param me
+/** snapshot version of Entry_t
 */
-static void EntriesTraverseInit(
-    EntriesTraverse_t* me);
+struct SnapshotEntry_s
+{
+    /** see Entry_s
+    */
+    int64_t m_SnapshotTimestamp[ENTRY_TIME_COUNT];
 
-/** deinit
-    \param me
-*/
-static void EntriesTraverseDeInit(
-    EntriesTraverse_t* me);
+    /** text position in the string pool and its length
+        not including the null-terminator
+    */
+    uint32_t m_SnapshotTextOffset;
+    uint32_t m_SnapshotTextLength;
 
-/** get the first entry based on the specified order
-    \param me
-    \param entries the entries to traverse
-    \param order the order to traverse the entries with
-            subsequent calls to EntriesTraverseNext()
-    \param entryTime the time to compare when sorting
-           by ORDER_NEWEST_FIRST or ORDER_OLDEST_FIRST
-    \returns the first entry or NULL if none remain
-*/
-static Entry_t* EntriesTraverseFirst(
-    EntriesTraverse_t* me,
-    Entries_t* entries,
-    Order_t order,
-    EntryTime_t entryTime);
+};
 
-/** get the next entry based on the order started by
-    the last call to EntriesTraverseFirst()
-    \param me
-    \returns the next entry or NULL if none remain
+/** part of the responses waiting to be sent
+    on a connection
 */
-static Entry_t* EntriesTraverseNext(
-    EntriesTraverse_t* me);
+struct ServerPart_s
+{
+    /** output sent by reference or NULL to send
+        the bytes of m_ResponseBytes at m_PartOffset
+    */
+    SharedOutput_t* m_PartShared;
 
-// --- MANAGED ENTRIES ---
+    /** offset in m_ResponseBytes when m_PartShared
+        is NULL
+    */
+    int m_PartOffset;
 
-/** init
-    \param me
-    \param max the max entries allowed
-    \returns RESULT_OK or RESULT_ERROR
-*/
-static Result_t ManagedEntriesInit(
-    ManagedEntries_t* me,
-    int max);
+    /** number of bytes in the part
+    */
+    int m_PartLength;
 
-/** deinit
-    \param me
-*/
-static void ManagedEntriesDeInit(
-    ManagedEntries_t* me);
+};
 
-/** append an entry to the array
-    \param me
-    \param text the entry text. cannot be empty.
-    \param start optional start date.
-           see TimeFromDateString()
-    \param end optional end date when start is specified.
-           see TimeFromDateString()
-    \returns the entry or NULL for error
+/** the responses waiting to be sent on a connection.
+    a ServerRequestCallback_t writes to m_ResponseBytes
+    and queues output it does not own with
+    ServerResponseAttach() so the output is not copied
 */
-static Entry_t* ManagedEntriesAppend(
-    ManagedEntries_t* me,
-    const char* text,
-    const char* start,
-    const char* end);
+struct ServerResponse_s
+{
+    /** bytes written by the request callbacks
+    */
+    OutputBuffer_t m_ResponseBytes;
 
-/** append an entry to the array using part of a string
-    \param me
-    \param text the entry text
-    \param textLength the entry text length
-    \param start optional start date.
-           see TimeFromDateString()
-    \param end optional end date when start is specified.
-           see TimeFromDateString()
-    \returns the entry or NULL for error
-*/
-static Entry_t* ManagedEntriesAppendSubstr(
-    ManagedEntries_t* me,
-    const char* text,
-    int textLength,
-    const char* start,
-    const char* end);
+    /** every part in the order it is sent. bytes at the
+        end of m_ResponseBytes that are not in a part yet
+        are sent after the last part
+    */
+    ServerPart_t* m_ResponseParts;
 
-// --- ENTRY ---
+    /** number of parts in use
+    */
+    int m_ResponsePartCount;
 
-/** init
-    \param me
-*/
-static void EntryInit(
-    Entry_t* me);
+    /** number of parts allocated
+    */
+    int m_ResponsePartMax;
 
-/** deinit
-    \param me
-*/
-static void EntryDeInit(
-    Entry_t* me);
+    /** the first part that is not completely sent
+    */
+    int m_ResponsePartFirst;
 
-/** set the entry text.
-    this creates a deep copy of the string.
-    \param me
-    \param text optional pointer to a null-terminated
-                string. use NULL to clear the text.
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t EntrySetText(
-    Entry_t* me,
-    const char* text);
+    /** number of bytes of the first part already sent
+    */
+    int m_ResponsePartSent;
 
-/** set the entry text to a substring.
-    this creates a deep copy of the string.
-    \param me
-    \param text optional pointer to a null-terminated
-                string. use NULL to clear the text.
-    \param textLength length of text
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t EntrySetTextSubstr(
-    Entry_t* me,
-    const char* text,
-    int textLength);
+    /** number of bytes of m_ResponseBytes in a part
+    */
+    int m_ResponseBytesQueued;
 
-/** get a date string from the entry time.
-    this uses TimeToDateString() to get the string
-    unless the timestamp value is TIMESTAMP_UNSET
-    or the dateOption prevents the string from being
-    written entirely
-    \param me
-    \param dest
-    \param destLength
-    \param entryTime
-    \param dateOption
-    \returns positing within dest where writing date
-             string data was stopped.
-             Note: the entire destLength will still be
-             filled with either spaces or periods
-             depending on whether the dateOption allowed
-             anything to be written
-*/
-static int EntryTimeToString(
-    Entry_t* me,
-    char* dest,
-    int destLength,
-    EntryTime_t entryTime,
-    DateOption_t dateOption);
+    /** number of bytes in every part that are not sent
+    */
+    int m_ResponsePending;
 
-// --- SECTION DATA ---
+};
 
-/** init
-    \param me
+/** a client connected to a Server_t
 */
-static void SectionDataInit(
-    SectionData_t* me);
+struct ServerConnection_s
+{
+    /** connected socket
+    */
+    int m_ConnectionSocket;
 
-/** deinit
-    \param me
-*/
-static void SectionDataDeInit( // recursive
-    SectionData_t* me);
+    /** received data that has not been used
+        by a request yet
+    */
+    OutputBuffer_t m_ConnectionInput;
 
-/** set the section title.
-    this creates a deep copy of the string.
-    \param me
-    \param text optional pointer to a null-terminated
-                string. use NULL to clear the text.
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
-*/
-static Result_t SectionDataSetTitle(
-    SectionData_t* me,
-    const char* title);
+    /** responses waiting to be sent
+    */
+    ServerResponse_t m_ConnectionResponse;
 
-/** set the section title.
-    this creates a deep copy of the string.
-    \param me
-    \param title optional pointer to a null-terminated
-                 string. use NULL to clear the text.
-    \param titleLength length of title
-    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+    /** RESULT_YES to close the connection once the
+        output is sent
+    */
+    Result_t m_ConnectionClose;
+
+    /** RESULT_YES while complete requests wait in
+        m_ConnectionInput for the output to drop below
+        SERVER_MAX_PENDING_OUTPUT
+    */
+    Result_t m_ConnectionPaused;
+
+    /** epoll events the connection is waiting for
+    */
+    uint32_t m_ConnectionEvents;
+
+    /** linked-list of every open connection
+    */
+    ServerConnection_t* m_ConnectionPrevious;
+    ServerConnection_t* m_ConnectionNext;
+
+};
+
+/** answers requests on a listening socket with a single
+    thread using epoll
 */
-static Result_t SectionDataSetTitleSubstr(
-    SectionData_t* me,
-    const char* title,
-    int titleLength);
+struct Server_s
+{
+    /** listening socket or INVALID_POSITION
+    */
+    int m_ServerSocket;
 
-/** include an entry in this section
-    \param me
-    \param entry pointer to the entry
-    \returns RESULT_OK or RESULT_ERROR
+    /** epoll instance or INVALID_POSITION
+    */
+    int m_ServerEpoll;
+
+    /** unix socket path removed by ServerDeInit()
+        or NULL
+    */
+    const char* m_ServerUnixPath;
+
+    /** called for every request
+    */
+    ServerRequestCallback_t m_ServerCallback;
+
+    /** passed to m_ServerCallback
+    */
+    void* m_ServerUserData;
+
+    /** first of every open connection
+    */
+    ServerConnection_t* m_ServerConnections;
+
+    /** number of connections in m_ServerConnections
+    */
+    int m_ServerConnectionCount;
+
+};
+
+/** a rendered resume kept by a RenderCache_t
 */
-static Result_t SectionDataIncludeEntry(
-    SectionData_t* me,
-    Entry_t* entry);
+struct RenderCacheEntry_s
+{
+    /** hash of m_CacheKey
+    */
+    uint32_t m_CacheHash;
 
-// --- JSON ---
+    /** m_ResumeGeneration of the resume when
+        m_CacheOutput was rendered
+    */
+    uint32_t m_CacheGeneration;
 
-/** find the data length of a value
-    \param json the json data. examples:
-                - 1000 will return 4
-                - "text" will return 6
-                - true will return 4
-    \param jsonState this will be updated only if an
-                     error occurs. \see enum JsonState_e
-    \returns the value data length or
-             0 if json does not start with a value
+    /** the options written by ResumeOptionsWriteKey()
+    */
+    OutputBuffer_t m_CacheKey;
+
+    /** the rendered resume or NULL. a connection may
+        still be sending it after it is replaced
+    */
+    SharedOutput_t* m_CacheShared;
+
+    /** the entry used more recently or NULL
+        if this is the newest
+    */
+    RenderCacheEntry_t* m_CacheNewer;
+
+    /** the entry used less recently or NULL
+        if this is the oldest
+    */
+    RenderCacheEntry_t* m_CacheOlder;
+
+};
+
+/** keeps the most recently rendered resumes so repeated
+    options are not rendered again
 */
-static int JsonValueDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState);
+struct RenderCache_s
+{
+    /** every entry. the first m_CacheCount are in use
+    */
+    RenderCacheEntry_t m_CacheEntries[RENDER_CACHE_MAX_ENTRIES];
 
-/** find the data length of a number
-    \param json the json data. example: 5.1
-                will return 3 as the data length
-    \param jsonState this will be updated only if an
-                     error occurs. \see enum JsonState_e
-    \returns the value data length or
-             0 if json does not start with a number
+    /** number of entries in use
+    */
+    int m_CacheCount;
+
+    /** the most recently used entry
+    */
+    RenderCacheEntry_t* m_CacheNewest;
+
+    /** the least recently used entry. replaced first
+    */
+    RenderCacheEntry_t* m_CacheOldest;
+
+    /** the key of the options being found.
+        reused by every RenderCacheGet()
+    */
+    OutputBuffer_t m_CacheFindKey;
+
+    /** number of times a rendered resume was reused
+    */
+    uint64_t m_CacheHits;
+
+    /** number of times the resume was rendered
+    */
+    uint64_t m_CacheMisses;
+
+};
+
+/** publishes the resume used by readers such as the
+    server and replaces it without locks. each reader marks
+    the epoch it started reading in so a replaced resume is
+    only freed once no reader can still be using it
 */
-static int JsonNumberDataLength(
-    const char* json,
-    JsonState_t* jsonState);
+struct ResumeShared_s
+{
+    /** the resume that new readers use
+    */
+    RESUME_ATOMIC(Resume_t*) m_SharedCurrent;
 
-/** find the data length of a single quoted string
-    \param json the json data. example: "string": "value"
-                will return 8 as the data length
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns the string data length including the quotes or
-             0 if json does not start with a '"' or
-             1 if an end '"' was not found
+    /** incremented every time the resume is replaced
+    */
+    RESUME_ATOMIC(uint64_t) m_SharedEpoch;
+
+    /** the epoch each reader started reading in or
+        RESUME_SHARED_IDLE
+    */
+    RESUME_ATOMIC(uint64_t) m_SharedReaderEpoch[RESUME_SHARED_MAX_READERS];
+
+    /** the resume passed to ResumeSharedInit(). it belongs
+        to the caller so it is deinit but never freed
+    */
+    Resume_t* m_SharedFirst;
+
+};
+
+/** reloads a json file into a new resume whenever
+    the file changes
 */
-static int JsonStringDataLength(
-    const char* json,
-    JsonState_t* jsonState);
+struct ResumeReload_s
+{
+    /** where each reloaded resume is published
+    */
+    ResumeShared_t* m_ReloadShared;
 
-/** find the data length of an array
-    \param json the json data. example: ["value1","value2"]
-                will return 19 as the data length
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns the array data length including the brackets or
-             0 if json does not start with a '[' or
-             1 if an end ']' was not found
+    /** the json file
+    */
+    const char* m_ReloadPath;
+
+    /** the file name without its directory.
+        points into m_ReloadPath
+    */
+    const char* m_ReloadName;
+
+    /** the options of every reloaded resume
+    */
+    ResumeOptions_t m_ReloadOptions;
+
+    /** inotify file descriptor or INVALID_POSITION
+    */
+    int m_ReloadNotify;
+
+    /** set to stop the reload thread
+    */
+    RESUME_ATOMIC(int) m_ReloadStop;
+
+    /** RESULT_YES while the reload thread is running
+    */
+    Result_t m_ReloadRunning;
+
+#if defined(RESUME_RELOAD)
+    /** the reload thread
+    */
+    pthread_t m_ReloadThread;
+#endif
+
+};
+
+/** one top-level json section object filled by a
+    SectionParser_t
 */
-static int JsonArrayDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState);
+struct SectionJob_s
+{
+    /** the start of the json section object
+    */
+    const char* m_JobJson;
 
-/** find the data length of an object
-    \param json the json data. example: {"key":"value"}
-                will return 15 as the data length
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns the object data length including the braces or
-             0 if json does not start with a '{' or
-             1 if an end '}' was not found
+    /** the filled section or NULL if the job did not run.
+        not linked to any resume
+    */
+    SectionData_t* m_JobSection;
+
+    /** every entry created while filling m_JobSection in
+        the order they were created
+    */
+    ManagedEntries_t m_JobEntries;
+
+    /** result of filling m_JobSection
+    */
+    Result_t m_JobResult;
+
+    /** the entry error that stopped the job or
+        ENTRY_STATE_UNKNOWN
+    */
+    EntryState_t m_JobErrorInEntry;
+
+    /** number of changes made to m_JobSection.
+        see m_ResumeGeneration
+    */
+    uint32_t m_JobGeneration;
+
+};
+
+/** fills the sections of a json array on several threads.
+    each thread fills a section into its own resume which
+    is only used as an arena for the entries. the filled
+    sections are then linked in their original order
 */
-static int JsonObjectDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState);
+struct SectionParser_s
+{
+    /** one job per json section object in array order
+    */
+    SectionJob_t* m_ParserJobs;
 
-/** skip the current json data
-    \param json current json data
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns pointer to the next, non-whitespace, json data.
-             IMPORTANT: if the skip cannot occur the
-                        original pointer is returned
-             good examples:
-             - if '[' then after the closing ']':
-               ',', ']', '}', or '\0'
-             - if '{' then after the closing '}':
-               ',', ']', '}', or '\0'
-             - if '"' then after the closing '"':
-               ',', ']', '}', ':', or '\0'
-             - if ':' then after the value:
-               ',', '}', or '\0'
-             - if a number then after it:
-               ',', ']', '}', or '\0'
-             - if a boolean then after it:
-               ',', ']', '}', or '\0'
-             - if a null then after it:
-               ',', ']', '}', or '\0'
-             - if ',' then after it:
-               '{', '[', or '"'
-             - if whitespace then a non-whitespace after it
-*/
-static const char* JsonSkip( // recursive
-    const char* json,
-    JsonState_t* jsonState);
+    /** number of jobs in use at m_ParserJobs
+    */
+    int m_ParserJobCount;
 
-/** uses JsonSkip() to find the start of the value for
-    the specified key
-    \param json current json data within an object
-    \param key the key to search for within the object
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns a pointer to the start of the value for this
-             key or the end of the object if the key is not
-             found. the start of the value is any
-             non-whitespace character following the ':'
-             after the key
-*/
-static const char* JsonSkipToKeyValue( // recursive
-    const char* json,
-    const char* key,
-    JsonState_t* jsonState);
+    /** number of jobs allocated at m_ParserJobs
+    */
+    int m_ParserJobMax;
 
-/** uses JsonSkip() to find the start of the value for
-    the next key within an object.
-    \param json current json data within an object.
-                the next non-whitespace character should
-                be one of the following: '"', ',', '}', '\0'
-                Note: when looping through object keys,
-                      this pointer must be the return value
-                      of the previous call to this function
-                      plus the value length.
-                      \see JsonValueDataLength()
-    \param key this will be set to the next key or NULL
-               if no key was found
-    \param keyLength this is the length of the next key
-                     or < 2 if no key was found
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns a pointer to the start of the value for the
-             next key or the end of the object if there
-             are no more keys. the start of the value is
-             any non-whitespace character following the ':'
-             after the key. use JsonValueDataLength() to
-             find the lenth of the value.
-*/
-static const char* JsonSkipToNextValue( // recursive
-    const char* json,
-    const char** key,
-    int* keyLength,
-    JsonState_t* jsonState);
+    /** index of the next job a thread will run
+    */
+    RESUME_ATOMIC(int) m_ParserNextJob;
 
-/** find the position in the json data where the next
-    array index begins.
-    \param json the json data at the first character within
-                the array at the current index.
-                - for currentIndex == INVALID_POSITION this
-                  should be the first character after the
-                  open bracket '['
-                - for currentIndex >= 0 this should be the
-                  first character of the data at that index
-                  past the '[' or ','
-    \param currentIndex set this to the current index or to
-                        INVALID_POSITION when looking for
-                        the start of index 0. this will be
-                        updated to the next index value on
-                        success or to INVALID_POSITION if
-                        no array data remains.
-    \param jsonState this will be updated only if an error
-                     occurs. \see enum JsonState_e
-    \returns a pointer to the first character of the
-             json value at currentIndex.
-             if currentIndex is INVALID_POSITION then a
-             pointer to: ']' or '\0'
-*/
-static const char* JsonArrayNextIndex( // recursive
-    const char* json,
-    int* currentIndex,
-    JsonState_t* jsonState);
+    /** options of each thread's arena
+    */
+    ResumeOptions_t m_ParserOptions;
 
-// --- RESUME ---
+};
 
-/** init
-    \param me
-    \returns RESULT_OK or RESULT_ERROR
+/** runs a callback for every section of a resume on
+    several threads
 */
-static Result_t ResumeInit(
-    Resume_t* me,
-    ResumeOptions_t* resumeOptions);
+struct SectionPool_s
+{
+    /** every section of the resume in section order
+    */
+    SectionData_t** m_PoolSections;
 
-/** check if the specified section should be hidden
-    \param me
-    \param sectionTitle null-terminated string
-    \returns RESULT_YES if hidden or RESULT_NO
-*/
-static Result_t ResumeOptionsIsHiddenSection(
-    ResumeOptions_t* me,
-    const char* sectionTitle);
+    /** the result of the callback for each section or
+        RESULT_NEXT until the callback runs
+    */
+    Result_t* m_PoolResults;
 
-/** deinit
-    \param me
-*/
-static void ResumeDeInit(
-    Resume_t* me);
+    /** number of sections at m_PoolSections
+    */
+    Section_t m_PoolCount;
 
-/** insert section data at runtime
-    \param me
-    \param section the section index to insert
-            new section data. a value
-            >= SECTION_AT_RUNTIME and
-            <= ResumeGetSectionCount()
-    \returns pointer to the initialized section data
-             or NULL if it could not be inserted
-*/
-SectionData_t* ResumeInsertSection(
-    Resume_t* me,
-    Section_t section);
+    /** index of the next section a thread will use
+    */
+    RESUME_ATOMIC(Section_t) m_PoolNext;
 
-/** remove a section without deinit
-*/
-SectionData_t* ResumeRemoveSection(
-    Resume_t* me,
-    Section_t section);
+    /** the callback passed to SectionPoolRun()
+    */
+    SectionPoolCallback_t m_PoolCallback;
 
-/** get the total number of hard-coded
-    and runtime sections
-*/
-Section_t ResumeGetSectionCount(
-    Resume_t* me);
+    /** the user data passed to SectionPoolRun()
+    */
+    void* m_PoolUserData;
 
-/** get section data from the resume
-    \param me
-    \param section see enum Section_e
-    \returns section data or NULL if it does not exist
-*/
-SectionData_t* ResumeGetSectionData(
-    Resume_t* me,
-    Section_t section);
+};
 
-/** get section index from the resume
-    \param me
-    \param sectionData
-    \returns see enum Section_e
+/** a resume rendered into one buffer per section so the
+    sections can be rendered on several threads
 */
-Section_t ResumeGetSectionIndex(
-    Resume_t* me,
-    SectionData_t* sectionData);
+struct ResumeRender_s
+{
+    /** the header, every section in section order, and
+        the footer. hidden sections are empty
+    */
+    OutputBuffer_t* m_RenderParts;
 
-/** get a section title from the resume
-    \param me
-    \param section see enum Section_e
-    \returns section title or empty string if there is none
-*/
-static const char* ResumeGetSectionTitle(
-    Resume_t* me,
-    Section_t section);
+    /** number of buffers at m_RenderParts
+    */
+    int m_RenderPartCount;
 
-/** add entry to the resume under the specified section
-    \param me
-    \param section see enum Section_e
-    \param text the entry text. cannot be empty.
-    \param start optional start date.
-           see TimeFromDateString()
-    \param end optional end date when start is specified.
-           see TimeFromDateString()
-    \returns RESULT_OK or RESULT_ERROR
-*/
-static Result_t ResumeAddEntry(
-    Resume_t* me,
-    Section_t section,
-    const char* text,
-    const char* start,
-    const char* end);
+    /** the options used to render each section
+    */
+    ResumeOptions_t m_RenderOptions;
 
-/** add entry to the specified section
-    \param me
-    \param resume
-    \param text the entry text
-    \param textLength the entry text length
-    \param start optional start date.
-           see TimeFromDateString()
-    \param end optional end date when start is specified.
-           see TimeFromDateString()
-    \returns RESULT_OK or RESULT_ERROR
-*/
-static Result_t SectionAddEntry(
-    SectionData_t* me,
-    Resume_t* resume,
-    const char* text,
-    int textLength,
-    const char* start,
-    const char* end);
+};
 
-/** print html version of resume to standard out
+/** a word in the --rank index
 */
-static void ResumePrintHtml(
-    Resume_t* me);
+struct RankTerm_s
+{
+    /** the first use of the word in an entry. it is
+        compared without case
+    */
+    const char* m_TermText;
 
-/** print text version of resume to standard out
-*/
-static void ResumePrintPlainText(
-    Resume_t* me);
+    /** bytes of the word used. up to RANK_MAX_TERM_LENGTH
+    */
+    int m_TermLength;
 
-/** fill resume sections at runtime from a json array
-    \param me
-    \param json a pointer to the start of a json array.
-                Note: any whitespace before the '['
-                      will be ignored
-    \returns RESULT_OK or RESULT_ERROR
+    /** FNV-1a hash of the lowercase word
+    */
+    uint32_t m_TermHash;
+
+    /** number of entries the word is used in
+    */
+    int m_TermEntries;
+
+};
+
+/** the --rank score of an entry of a section
 */
-static Result_t ResumeFillSectionsFromJsonArray(
-    Resume_t* me,
-    const char* json);
+struct RankOrder_s
+{
+    /** relevance to the rank text
+    */
+    double m_OrderScore;
 
-/** fill the section at runtime from a json object
-    \param me
-    \param sectionData
-    \param json a pointer to the start of a json object.
-                Note: any whitespace before the '{'
-                      will be ignored
-    \returns RESULT_OK or RESULT_ERROR
+    /** position of the entry in section order
+    */
+    int m_OrderPosition;
+
+};
+
+/** a term index of every entry of a resume so the entries
+    can be scored against any text. each entry is a sparse
+    vector of term weights and the text is a dense vector
+    over every term so each score is a single pass over
+    the terms of an entry
 */
-static Result_t ResumeFillSectionFromJsonObject(
-    Resume_t* me,
-    SectionData_t* sectionData,
-    const char* json);
+struct Rank_s
+{
+    /** every entry in display order. the entries of each
+        section are together
+    */
+    Entry_t** m_RankEntries;
 
-/** fill resume entries at runtime from a json array
-    \param me
-    \param sectionData
-    \param json a pointer to the start of a json array.
-                Note: any whitespace before the '['
-                      will be ignored
-    \returns RESULT_OK or RESULT_ERROR
+    /** number of entries at m_RankEntries
+    */
+    int m_RankEntryCount;
+
+    /** the terms of entry e are m_RankPostingStart[e] to
+        m_RankPostingStart[e + 1] - 1 in m_RankPostingTerm
+        and m_RankPostingWeight
+    */
+    int* m_RankPostingStart;
+
+    /** index in m_RankTerms of each term of each entry
+    */
+    int* m_RankPostingTerm;
+
+    /** weight of each term of each entry. the number of
+        uses until the index is complete
+    */
+    double* m_RankPostingWeight;
+
+    /** number of terms of every entry together
+    */
+    int m_RankPostingCount;
+
+    /** every unique term
+    */
+    RankTerm_t* m_RankTerms;
+
+    /** number of terms at m_RankTerms
+    */
+    int m_RankTermCount;
+
+    /** open addressing table of indexes in m_RankTerms or
+        INVALID_POSITION when the slot is empty
+    */
+    int* m_RankTable;
+
+    /** number of slots at m_RankTable minus 1. the number
+        of slots is a power of two
+    */
+    uint32_t m_RankTableMask;
+
+    /** weight of each term in the rank text
+    */
+    double* m_RankQuery;
+
+    /** weight in the rank text of each term of each entry.
+        the same layout as m_RankPostingWeight so every
+        score is a dense dot product
+    */
+    double* m_RankGathered;
+
+    /** score of each entry. the number of terms of each
+        entry until the index is complete
+    */
+    double* m_RankScores;
+
+    /** used to sort the entries of each section
+    */
+    RankOrder_t* m_RankOrder;
+
+};
+
+/** an Aho-Corasick automaton of every --highlight keyword.
+    each state has a transition for every class of byte so
+    the text of an entry is scanned one byte at a time no
+    matter how many keywords there are
 */
-static Result_t ResumeFillEntriesFromJsonArray(
-    Resume_t* me, 
-    SectionData_t* sectionData,
-    const char* json);
+struct Highlight_s
+{
+    /** the keywords. one per line or separated by ','
+    */
+    const char* m_HighlightText;
 
-/** fill the resume from hard-coded data.
-    calls ResumeFillSectionsFromHardCoded() and ResumeFillEntriesFromHardCoded()
+    /** class of each lowercase byte. 0 for every byte that
+        is not in a keyword
+    */
+    uint8_t m_HighlightClass[256];
+
+    /** number of classes including 0
+    */
+    int m_HighlightClassCount;
+
+    /** the next state from each state for each class at
+        (state * m_HighlightClassCount) + class
+    */
+    int* m_HighlightNext;
+
+    /** the state of the longest suffix of each state that
+        is also a prefix of a keyword
+    */
+    int* m_HighlightFail;
+
+    /** length of the keyword each state ends or 0
+    */
+    int* m_HighlightLength;
+
+    /** the first state that ends a keyword when following
+        m_HighlightFail from each state including itself or
+        0 when there is none
+    */
+    int* m_HighlightOutput;
+
+    /** number of states. state 0 is the root
+    */
+    int m_HighlightStateCount;
+
+    /** number of keywords
+    */
+    int m_HighlightKeywordCount;
+
+};
+
+/** a single line of a --cache file. each line is an output
+    rendered by a previous --batch
 */
-static Result_t ResumeFillHardCoded(
-    Resume_t* me);
+struct BatchCacheEntry_s
+{
+    /** the output file. points into the cache file
+    */
+    const char* m_CacheDestination;
 
-/** fill the resume with section data
+    /** size of the json file in bytes
+    */
+    int64_t m_CacheInputSize;
+
+    /** modification time of the json file in
+        nanoseconds. \see MainGetFileInfo()
+    */
+    int64_t m_CacheInputTime;
+
+    /** hash of the json file
+    */
+    uint64_t m_CacheInputHash;
+
+    /** the job key. see BatchJobKey()
+    */
+    uint64_t m_CacheKey;
+
+};
+
+/** a single line of a --batch manifest
 */
-static Result_t ResumeFillSectionsFromHardCoded(
-    Resume_t* me);
+struct BatchJob_s
+{
+    /** the json file. points into the manifest
+    */
+    const char* m_JobInput;
 
-/** fill the resume with entries
+    /** the output file. points into the manifest
+    */
+    const char* m_JobDestination;
+
+    /** the options and format of the output
+    */
+    ResumeOptions_t m_JobOptions;
+
+    /** the manifest line number used in error messages
+    */
+    int m_JobLine;
+
+    /** hash of the program version, json file name, and
+        options. see BatchJobKey()
+    */
+    uint64_t m_JobKey;
+
+    /** the output rendered by a previous --batch or NULL
+        when there is no --cache or it is a new output
+    */
+    const BatchCacheEntry_t* m_JobCached;
+
+    /** size of the json file in bytes
+    */
+    int64_t m_JobInputSize;
+
+    /** modification time of the json file in
+        nanoseconds. \see MainGetFileInfo()
+    */
+    int64_t m_JobInputTime;
+
+    /** hash of the json file
+    */
+    uint64_t m_JobInputHash;
+
+    /** RESULT_OK when the output is up to date
+    */
+    Result_t m_JobResult;
+
+};
+
+/** a thread of a Batch_t. each worker runs the jobs in
+    its own range first and then steals half of the jobs
+    left in another worker's range
 */
-static Result_t ResumeFillEntriesFromHardCoded(
-    Resume_t* me);
+struct BatchWorker_s
+{
+    /** the batch this worker runs jobs from
+    */
+    Batch_t* m_WorkerBatch;
 
-//
-// MARK: GLOBALS
-//
+    /** the next job in this worker's range
+    */
+    int m_WorkerNext;
 
-static const char g_JsonKeywordTrue[]  = "true";
-static const char g_JsonKeywordFalse[] = "false";
-static const char g_JsonKeywordNull[]  = "null";
+    /** one past the last job in this worker's range.
+        other workers steal from this end
+    */
+    int m_WorkerEnd;
 
-static const char g_ResumeFullName[]     = RESUME_FULL_NAME;
-static const char g_ResumeEmail[]        = RESUME_EMAIL;
-static const char g_ResumeCity[]         = RESUME_CITY;
-static const char g_ResumeState[]        = RESUME_STATE;
-static const char g_ResumeMobileNumber[] = RESUME_MOBILE_NUMBER;
-static const char g_ResumeWebUrl[]       = RESUME_WEB_URL;
-static const char g_ResumeJsonData[]     = RESUME_JSON_DATA;
+    /** reused by every job so the memory allocated for
+        the entries and sections is kept between jobs
+    */
+    Resume_t m_WorkerResume;
 
-static const char g_EmptyText[] = "";
+    /** reused to read every json file
+    */
+    OutputBuffer_t m_WorkerJson;
 
-/** lookup table to find text version of entry state
+    /** reused to render every resume
+    */
+    OutputBuffer_t m_WorkerOutput;
+
+    /** number of jobs this worker ran
+    */
+    int m_WorkerDone;
+
+    /** number of jobs this worker stole
+    */
+    int m_WorkerStolen;
+
+    /** number of jobs that failed
+    */
+    int m_WorkerFailed;
+
+    /** number of jobs that were already up to date
+    */
+    int m_WorkerSkipped;
+
+    /** number of skipped jobs that did not need the json
+        file to be read
+    */
+    int m_WorkerSkippedByTime;
+
+#if defined(RESUME_THREADS)
+    /** protects m_WorkerNext and m_WorkerEnd
+    */
+    pthread_mutex_t m_WorkerLock;
+
+    /** the worker thread. worker 0 uses the calling
+        thread
+    */
+    pthread_t m_WorkerThread;
+#endif
+
+};
+
+/** renders every job of a --batch manifest in a single
+    process
 */
-static const char* g_EntryStateLookup[ENTRY_STATE_COUNT] =
+struct Batch_s
 {
-    "unknown",               // ENTRY_STATE_UNKNOWN
-    "ok",                    // ENTRY_STATE_OK
-    "error-full",            // ENTRY_STATE_ERROR_FULL
-    "error-text-empty",      // ENTRY_STATE_ERROR_TEXT_EMPTY
-    "error-text-missing",    // ENTRY_STATE_ERROR_TEXT_MISSING
-    "error-start-date",      // ENTRY_STATE_ERROR_START_DATE
-    "error-end-date",        // ENTRY_STATE_ERROR_END_DATE
-    "error-start-missing",   // ENTRY_STATE_ERROR_START_DATE_MISSING
-    "error-alloc",           // ENTRY_STATE_ERROR_ALLOC
-    "error-set-text",        // ENTRY_STATE_ERROR_SET_TEXT
-    "error-resize",          // ENTRY_STATE_ERROR_RESIZE
-    "error-section-missing"  // ENTRY_STATE_ERROR_SECTION_MISSING
+    /** the manifest. each job points into it
+    */
+    OutputBuffer_t m_BatchManifest;
+
+    /** every job in manifest order
+    */
+    BatchJob_t* m_BatchJobs;
+
+    /** number of jobs in use at m_BatchJobs
+    */
+    int m_BatchJobCount;
+
+    /** number of jobs allocated at m_BatchJobs
+    */
+    int m_BatchJobMax;
+
+    /** every job starts with these options
+    */
+    ResumeOptions_t m_BatchOptions;
+
+    /** one worker per thread
+    */
+    BatchWorker_t* m_BatchWorkers;
+
+    /** number of workers at m_BatchWorkers
+    */
+    int m_BatchWorkerCount;
+
+    /** the --cache file or NULL to render every job
+    */
+    const char* m_BatchCachePath;
+
+    /** the --cache file read before the jobs run.
+        each cache entry points into it
+    */
+    OutputBuffer_t m_BatchCacheFile;
+
+    /** every output rendered by a previous --batch
+    */
+    BatchCacheEntry_t* m_BatchCacheEntries;
+
+    /** number of entries at m_BatchCacheEntries
+    */
+    int m_BatchCacheCount;
+
 };
 
-//
-// MARK: HELPER MACROS
-//
+/** the synthetic resume generated by --bench and the
+    number of times it is timed
+*/
+struct BenchSpec_s
+{
+    /** number of timed iterations
+    */
+    int m_SpecIterations;
 
-/** indicate a param is not used
+    /** number of sections
+    */
+    int m_SpecSections;
+
+    /** number of entries in each section
+    */
+    int m_SpecEntries;
+
+    /** shortest entry text
+    */
+    int m_SpecTextMin;
+
+    /** longest entry text. lengths are uniform between
+        m_SpecTextMin and m_SpecTextMax
+    */
+    int m_SpecTextMax;
+
+    /** earliest start year
+    */
+    int m_SpecYearMin;
+
+    /** latest start year. years are uniform between
+        m_SpecYearMin and m_SpecYearMax
+    */
+    int m_SpecYearMax;
+
+    /** percent of entries without an end date
+    */
+    int m_SpecOngoing;
+
+    /** display_max of each section or DISPLAY_ALL
+    */
+    int m_SpecDisplayMax;
+
+    /** relative number of sections using each Order_t
+    */
+    int m_SpecOrderWeight[ORDER_COUNT];
+
+    /** seed for the generated resume
+    */
+    int m_SpecSeed;
+
+    /** size in bytes of each --bench-json corpus
+    */
+    int m_SpecCorpusSize;
+
+    /** depth of the objects in the --bench-json nested
+        corpus
+    */
+    int m_SpecDepth;
+
+};
+
+/** times each phase of filling, ordering, and rendering a
+    synthetic resume
 */
-#define PARAM_NOT_USED(var) (void)var;
+struct Bench_s
+{
+    /** the generated resume
+    */
+    BenchSpec_t m_BenchSpec;
+
+    /** options used to fill and render the resume
+    */
+    ResumeOptions_t m_BenchOptions;
+
+    /** the generated json
+    */
+    OutputBuffer_t m_BenchJson;
+
+    /** used to render each iteration
+    */
+    OutputBuffer_t m_BenchOutput;
+
+    /** nanoseconds of each iteration of each phase.
+        the times of a phase are together starting at
+        (phase * m_SpecIterations)
+    */
+    int64_t* m_BenchTimes;
+
+    /** --bench-json time stamp counter ticks of each
+        iteration
+    */
+    int64_t* m_BenchCycles;
+
+    /** --bench-json int offset of every string in
+        m_BenchJson
+    */
+    OutputBuffer_t m_BenchStrings;
+
+    /** --bench-json int offset of every object in the
+        array at m_BenchJson
+    */
+    OutputBuffer_t m_BenchObjects;
+
+};
+
+/** the memory of each phase of a --bench-memory case
+*/
+struct BenchMemory_s
+{
+    /** allocations and resizes made by each phase
+    */
+    int64_t m_MemoryAllocs[BENCH_PHASE_COUNT];
+
+    /** the most bytes each phase had live at once
+    */
+    int64_t m_MemoryPeak[BENCH_PHASE_COUNT];
+
+};
+
+/** a set of options rendered by --golden
+*/
+struct GoldenCase_s
+{
+    /** part of the name of each output
+    */
+    const char* m_CaseName;
+
+    /** see m_ExtendedDisplayCount
+    */
+    int m_CaseExtended;
+
+    /** RESULT_YES to hide every section in g_GoldenHidden
+    */
+    Result_t m_CaseHide;
+
+    /** the random seed used to order the resume
+    */
+    unsigned int m_CaseSeed;
+
+    /** a --batch manifest line whose options are added to
+        the case or NULL. the json file and destination
+        are not used
+    */
+    const char* m_CaseManifest;
+
+};
+
+/** renders every --golden output, compares it to its
+    golden file, and times it
+*/
+struct Golden_s
+{
+    /** the directory of the golden files
+    */
+    const char* m_GoldenDirectory;
+
+    /** RESULT_YES to write every golden file and the
+        baseline instead of checking them
+    */
+    Result_t m_GoldenUpdate;
+
+    /** generates the json of the generated resume
+    */
+    Bench_t m_GoldenBench;
+
+    /** the first render of the current output
+    */
+    OutputBuffer_t m_GoldenOutput;
+
+    /** every timed render of the current output
+    */
+    OutputBuffer_t m_GoldenRepeat;
+
+    /** the golden file of the current output
+    */
+    OutputBuffer_t m_GoldenExpected;
+
+    /** the baseline file or empty when there is none
+    */
+    OutputBuffer_t m_GoldenBaseline;
+
+    /** the baseline written by this run
+    */
+    OutputBuffer_t m_GoldenNewBaseline;
+
+    /** number of outputs checked
+    */
+    int m_GoldenChecked;
+
+    /** number of outputs that do not match their golden
+        file
+    */
+    int m_GoldenMismatched;
+
+    /** number of outputs slower than the baseline
+    */
+    int m_GoldenSlower;
+
+    /** number of golden files written
+    */
+    int m_GoldenRecorded;
+
+    /** number of golden files and baselines that do not
+        exist without --golden-update
+    */
+    int m_GoldenMissing;
+
+};
+
+/** a single span recorded by --trace
+*/
+struct TraceEvent_s
+{
+    /** the kind of span
+    */
+    TraceSpan_t m_EventSpan;
+
+    /** number of entries or bytes in the span
+    */
+    int m_EventCount;
+
+    /** monotonic time the span started in nanoseconds
+    */
+    int64_t m_EventStart;
+
+    /** length of the span in nanoseconds
+    */
+    int64_t m_EventDuration;
+
+    /** a copy of the section title or phase name
+    */
+    char m_EventDetail[TRACE_MAX_DETAIL];
+
+};
+
+/** the events recorded by a single thread. only that
+    thread writes to the ring so no lock is needed. the
+    ring is read after the thread has stopped
+*/
+struct TraceRing_s
+{
+    /** number of events ever recorded. the newest event
+        is at ((m_RingWritten - 1) % TRACE_RING_SIZE)
+    */
+    int64_t m_RingWritten;
+
+    /** the thread id written to the trace
+    */
+    int m_RingThread;
+
+    /** the newest TRACE_RING_SIZE events
+    */
+    TraceEvent_t m_RingEvents[TRACE_RING_SIZE];
+
+};
+
+/** spans recorded on every thread for --trace
+*/
+struct Trace_s
+{
+    /** monotonic time the trace started in nanoseconds
+    */
+    int64_t m_TraceStart;
+
+    /** the ring of each thread in the order the threads
+        recorded their first event
+    */
+    TraceRing_t* m_TraceRings[TRACE_MAX_THREADS];
+
+    /** number of rings claimed. may be more than
+        TRACE_MAX_THREADS when too many threads record
+        events
+    */
+    RESUME_ATOMIC(int) m_TraceRingCount;
+
+};
+
+/** placed before every block from MemoryAlloc() so the
+    block size is known when it is freed
+*/
+struct MemoryHeader_s
+{
+    /** size of the block in bytes not including the
+        header
+    */
+    int64_t m_HeaderSize;
+
+    /** the MemoryKind_t of the block
+    */
+    int64_t m_HeaderKind;
+
+};
+
+/** the counters of a single MemoryKind_t or of every
+    kind. see MemoryGetCounters()
+*/
+struct MemoryCounters_s
+{
+    /** number of blocks allocated
+    */
+    int64_t m_CountAllocs;
+
+    /** number of blocks resized
+    */
+    int64_t m_CountReallocs;
+
+    /** number of blocks freed
+    */
+    int64_t m_CountFrees;
+
+    /** total bytes requested by every allocation and
+        resize
+    */
+    int64_t m_CountBytes;
+
+    /** bytes in blocks that are not freed yet
+    */
+    int64_t m_CountLive;
+
+    /** most bytes that were live at once
+    */
+    int64_t m_CountPeak;
+
+};
+
+/** counts every block from MemoryAlloc() and
+    MemoryRealloc(). each counter has an element for
+    every MemoryKind_t. the live bytes and peaks have one
+    more element at MEMORY_COUNT for every kind together
+*/
+struct Memory_s
+{
+    /** number of blocks allocated
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryAllocs[MEMORY_COUNT];
+
+    /** number of blocks resized
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryReallocs[MEMORY_COUNT];
+
+    /** number of blocks freed
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryFrees[MEMORY_COUNT];
+
+    /** total bytes requested by every allocation and
+        resize
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryBytes[MEMORY_COUNT];
+
+    /** bytes in blocks that are not freed yet
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryLive[MEMORY_COUNT + 1];
+
+    /** most bytes that were live at once
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryPeak[MEMORY_COUNT + 1];
+
+    /** most bytes of every kind that were live at once
+        since MemoryResetPhasePeak()
+    */
+    RESUME_ATOMIC(int64_t) m_MemoryPhasePeak;
+
+};
+
+/** data used to answer --serve and --http requests
+*/
+struct MainServe_s
+{
+    /** the resume used by every request.
+        read with SERVER_RESUME_READER
+    */
+    ResumeShared_t* m_ServeShared;
+
+    /** the options selected when the server started.
+        every request starts with these options
+    */
+    ResumeOptions_t m_ServeOptions;
+
+    /** the random seed used to order the resume. random
+        sections are displayed in a different order with
+        a different seed so it is part of every ETag
+    */
+    unsigned int m_ServeSeed;
+
+    /** rendered resumes reused by every request
+    */
+    RenderCache_t m_ServeCache;
+
+};
+
+/** times and sizes printed by --stats
+*/
+struct MainStats_s
+{
+    /** nanoseconds spent in each phase
+    */
+    int64_t m_StatsPhase[STATS_PHASE_COUNT];
+
+    /** bytes rendered in each format or 0 if the format
+        was not rendered
+    */
+    int m_StatsRendered[FORMAT_COUNT];
+
+    /** bytes written to every output
+    */
+    int64_t m_StatsWritten;
+
+    /** number of allocations and resizes in each phase
+    */
+    int64_t m_StatsAllocs[STATS_PHASE_COUNT];
+
+    /** most bytes that were live at once in each phase
+    */
+    int64_t m_StatsPeak[STATS_PHASE_COUNT];
+
+    /** number of allocations and resizes when the
+        current phase started
+    */
+    int64_t m_StatsAllocStart;
+
+    /** the phase ResumeLoad() is running or
+        STATS_PHASE_COUNT before it starts
+    */
+    StatsPhase_t m_StatsLoadPhase;
+
+    /** the time m_StatsLoadPhase started from
+        TimeNowNano()
+    */
+    int64_t m_StatsLoadStart;
+
+};
+
+/** snapshot file data that stays available for as long
+    as the resume uses it
+*/
+struct Snapshot_s
+{
+    /** the entire snapshot file
+    */
+    const char* m_SnapshotData;
+
+    /** number of bytes at m_SnapshotData
+    */
+    int m_SnapshotSize;
+
+    /** RESULT_YES if m_SnapshotData is mapped or RESULT_NO
+        if it was allocated
+    */
+    Result_t m_SnapshotIsMapped;
+
+};
+
+//
+// MARK: PROTOTYPES
+//
+
+// --- MAIN ---
+
+/** print help to standard out
+*/
+static void MainPrintHelp(
+    const char* programName);
+
+/** print version to standard out
+*/
+static void MainPrintVersion(void);
+
+/** select a format from a command line arg
+    \param arg the format name such as "html" or "text"
+    \param format updated to the selected format
+    \returns RESULT_OK or RESULT_ERROR if the format
+             is unknown
+*/
+static Result_t MainParseFormat(
+    const char* arg,
+    Format_t* format);
+
+/** write an output buffer to a destination
+    \param destination a file path or MAIN_OUTPUT_STDOUT
+    \param output the rendered resume
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t MainWriteOutput(
+    const char* destination,
+    OutputBuffer_t* output);
+
+/** write several output buffers to a destination in order
+    \param destination a file path or MAIN_OUTPUT_STDOUT
+    \param outputs the buffers to write
+    \param outputCount number of buffers at outputs
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t MainWriteOutputs(
+    const char* destination,
+    OutputBuffer_t* outputs,
+    int outputCount);
+
+/** parse a command line arg that selects a resume option:
+    -a, -e, -f, or -H
+    \param argc number of args
+    \param argv the args
+    \param index position of the arg to parse. updated to
+                 the position of the last arg used
+    \param options updated with the selected option
+    \returns EXIT_OK, the exit code of an invalid option, or
+             EXIT_UNKNOWN_ARG if the arg is not a resume option
+*/
+static int MainParseResumeOption(
+    int argc,
+    char** argv,
+    int* index,
+    ResumeOptions_t* options);
+
+/** read an entire file into an output buffer and
+    null-terminate it so it can be parsed as text
+    \param path the file to read
+    \param output the buffer to fill
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t MainReadFile(
+    const char* path,
+    OutputBuffer_t* output);
+
+/** split a line into args in place at whitespace.
+    whitespace between double quotes is part of the arg
+    and the quotes are removed so "Work History" is one
+    arg
+    \param line the line which is null-terminated at
+                each arg
+    \param lineLength number of bytes at line
+    \param args set to the start of each arg
+    \param argMax number of args that fit at args
+    \returns the number of args or INVALID_POSITION if
+             there are more than argMax
+*/
+static int MainSplitArgs(
+    char* line,
+    int lineLength,
+    char** args,
+    int argMax);
+
+/** render every job in a --batch manifest
+    \param path the manifest
+    \param cachePath the --cache file or NULL to render
+                     every job
+    \param options every job starts with these options.
+                   m_ThreadCount selects the number of
+                   threads or 0 for one per processor
+    \returns EXIT_OK or an Exit_e code
+*/
+static int MainBatch(
+    const char* path,
+    const char* cachePath,
+    ResumeOptions_t* options);
+
+/** generate a synthetic resume and time each phase of
+    filling, ordering, and rendering it
+    \param spec comma separated key=value pairs.
+                see BenchParseSpec()
+    \param options used to fill and render the resume.
+                   m_ThreadCount is used when filling
+                   and ordering
+    \returns EXIT_OK or an Exit_e code
+*/
+static int MainBench(
+    const char* spec,
+    ResumeOptions_t* options);
+
+/** generate json corpora and time the json functions
+    used to load a resume over each of them
+    \param spec comma separated key=value pairs.
+                see BenchParseSpec()
+    \returns EXIT_OK or an Exit_e code
+*/
+static int MainBenchJson(
+    const char* spec);
+
+/** load the built-in resume and a generated resume and
+    check the allocations and peak bytes of each phase
+    against their budgets
+    \param spec comma separated key=value pairs.
+                see BenchParseSpec()
+    \param options display options. every resume is
+                   filled on a single thread
+    \returns EXIT_OK, EXIT_BENCH_OVER_BUDGET, or an Exit_e
+             code
+*/
+static int MainBenchMemory(
+    const char* spec,
+    ResumeOptions_t* options);
+
+/** render the built-in and a generated resume with each
+    set of options in g_GoldenCases in both formats,
+    compare them to the golden files, and compare their
+    render times to the baseline
+    \param directory the directory of the golden files
+    \param update RESULT_YES to write every golden file
+                  and the baseline
+    \param options display options. the options of each
+                   case replace these
+    \returns EXIT_OK, EXIT_GOLDEN_MISMATCH,
+             EXIT_GOLDEN_MISSING, EXIT_GOLDEN_SLOWER, or
+             EXIT_GOLDEN_ERROR
+*/
+static int MainGolden(
+    const char* directory,
+    Result_t update,
+    ResumeOptions_t* options);
+
+/** start a phase
+    \param me
+    \returns the time the phase started from TimeNowNano()
+*/
+static int64_t MainStatsBegin(
+    MainStats_t* me);
+
+/** add the time since start to a phase and record the
+    phase for --trace
+    \param me
+    \param phase the phase that just ended
+    \param start the time the phase started from
+                 TimeNowNano()
+*/
+static void MainStatsAdd(
+    MainStats_t* me,
+    StatsPhase_t phase,
+    int64_t start);
+
+/** times each ResumeLoad() phase as the matching --stats
+    phase. see ResumeLoadCallback_t
+    \param phase
+    \param userData the MainStats_t to add the times to
+*/
+static void MainStatsLoad(
+    LoadPhase_t phase,
+    void* userData);
+
+/** write the --trace file and stop recording
+    \param destination a file path or MAIN_OUTPUT_STDOUT
+    \param exitCode the exit code of the program so far
+    \returns exitCode or EXIT_TRACE_WRITE_ERROR when the
+             trace could not be written
+*/
+static int MainWriteTrace(
+    const char* destination,
+    int exitCode);
+
+/** print the times and sizes of each phase, section,
+    and output to stderr
+    \param me
+    \param resume the resume after it was ordered
+*/
+static void MainStatsPrint(
+    MainStats_t* me,
+    Resume_t* resume);
+
+/** get the size and modification time of a file
+    \param path the file
+    \param size set to the size in bytes
+    \param modified set to the modification time in
+                    nanoseconds. whole seconds where the
+                    nanoseconds are not available
+    \returns RESULT_OK or RESULT_ERROR if the file does not
+             exist or the time is not available
+*/
+static Result_t MainGetFileInfo(
+    const char* path,
+    int64_t* size,
+    int64_t* modified);
+
+/** a ServerRequestCallback_t that answers --serve requests.
+    each request is a single line of resume options such as
+    "-f html -H Projects -e 2". the response is "OK" and the
+    number of bytes in the rendered resume on one line
+    followed by the resume, or "ERROR" and an exit code on
+    one line
+    \param request see ServerRequestCallback_t
+    \param requestLength see ServerRequestCallback_t
+    \param response see ServerRequestCallback_t
+    \param userData the MainServe_t
+    \returns see ServerRequestCallback_t
+*/
+static int MainServeRequest(
+    char* request,
+    int requestLength,
+    ServerResponse_t* response,
+    void* userData);
+
+/** a ServerRequestCallback_t that answers --http requests.
+    each request is an HTTP/1.1 GET or HEAD of "/" with
+    optional query parameters:
+    format=html or format=text,
+    hide=[section title] repeated for each hidden section,
+    extend=[count], and all.
+    every rendered response has an ETag made from the seed,
+    the resume generation, and a hash of the options so a
+    request with a matching If-None-Match is answered with
+    304 Not Modified without rendering
+    \param request see ServerRequestCallback_t
+    \param requestLength see ServerRequestCallback_t
+    \param response see ServerRequestCallback_t
+    \param userData the MainServe_t
+    \returns see ServerRequestCallback_t
+*/
+static int MainHttpRequest(
+    char* request,
+    int requestLength,
+    ServerResponse_t* response,
+    void* userData);
+
+/** write an --http response
+    \param response the buffer to write the response to
+    \param status the status code and reason such as
+                  "200 OK"
+    \param headers null-terminated header lines, each
+                   ending with "\r\n", or an empty string
+    \param body the response body or NULL if it is
+                attached to the response after the headers
+    \param bodyLength number of bytes at body or
+                      INVALID_POSITION if the response
+                      has no Content-Length
+    \param sendBody RESULT_NO to only send the headers
+    \param keepAlive RESULT_YES if the connection stays
+                     open after this response
+*/
+static void MainHttpWriteResponse(
+    OutputBuffer_t* response,
+    const char* status,
+    const char* headers,
+    const char* body,
+    int bodyLength,
+    Result_t sendBody,
+    Result_t keepAlive);
+
+// --- MEMORY ---
+
+/** allocate a block that is counted as kind. the block
+    must be freed with MemoryFree()
+    \param kind what the block is used for
+    \param size size of the block in bytes
+    \returns the block or NULL
+*/
+static void* MemoryAlloc(
+    MemoryKind_t kind,
+    size_t size);
+
+/** resize a block from MemoryAlloc() like realloc()
+    \param kind what the block is used for when data is
+                NULL. otherwise the kind of data is kept
+    \param data the block or NULL to allocate a new block
+    \param size new size of the block in bytes
+    \returns the block or NULL when data was not resized
+*/
+static void* MemoryRealloc(
+    MemoryKind_t kind,
+    void* data,
+    size_t size);
+
+/** free a block from MemoryAlloc() or MemoryRealloc()
+    \param data the block or NULL
+*/
+static void MemoryFree(
+    void* data);
+
+/** add to the live bytes of a kind and raise the peaks
+    \param kind what the bytes are used for
+    \param bytes number of bytes to add or remove
+*/
+static void MemoryAddLive(
+    MemoryKind_t kind,
+    int64_t bytes);
+
+/** raise a peak to live if live is larger
+    \param peak the peak to raise
+    \param live the bytes that are live now
+*/
+static void MemoryRaisePeak(
+    RESUME_ATOMIC(int64_t)* peak,
+    int64_t live);
+
+/** get the counters of a kind
+    \param kind the kind or MEMORY_COUNT for every kind
+    \param counters set to the counters
+*/
+static void MemoryGetCounters(
+    MemoryKind_t kind,
+    MemoryCounters_t* counters);
+
+/** start a new phase peak at the bytes that are live now
+*/
+static void MemoryResetPhasePeak(void);
+
+/** get the most bytes that were live at once since
+    MemoryResetPhasePeak()
+    \returns the phase peak in bytes
+*/
+static int64_t MemoryGetPhasePeak(void);
+
+// --- STRING ---
+
+/** set text by performing a deep copy of src or using
+    a shared empty string for NULL or empty strings
+    \param dest pointer to the string to update
+    \param src the string source or NULL to clear the text
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SetText(
+    char** dest,
+    const char* src);
+
+/** set text by performing a deep copy of src or using
+    a shared empty string for NULL or empty strings
+    \param dest pointer to the string to update
+    \param src the string source or NULL to clear the text
+    \param srcLength the max number of bytes to copy, which
+                     will not exceed those up to the
+                     null-terminator of src
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SetTextSubstr(
+    char** dest,
+    const char* src,
+    int srcLength);
+
+/** get the position of the lowest bit that is set
+    \param bits must not be 0
+    \returns 0 to 31
+*/
+static int FindLowestSetBit(
+    unsigned int bits);
+
+/** search for a character that must be escaped in html:
+    '<', '>', '&', '"', or '\''
+    \param text
+    \param textLength number of characters to search
+    \returns position of the character or textLength
+             if not found
+*/
+static int HtmlFindSpecialChar(
+    const char* text,
+    int textLength);
+
+/** get the html entity used in place of a character
+    \param c the character
+    \returns the entity such as "&amp;" or NULL if the
+             character does not need to be escaped
+*/
+static const char* HtmlGetEntity(
+    char c);
+
+/** find the resume string that exactly matches text.
+    the text length and at most one character select the
+    only possible match, which is then compared once, so
+    this works like a perfect hash of the RESUME STRINGS
+    \param text the text to match. does not need to be
+                null-terminated
+    \param textLength the text length
+    \returns the matching string or RESUME_STRING_ID_UNKNOWN
+*/
+static ResumeString_t ResumeStringFind(
+    const char* text,
+    int textLength);
+
+/** parse an int without sscanf() or the locale.
+    accepts json number forms: an optional '-' followed by
+    digits, an optional fraction, and an optional exponent
+    such as "-12", "1.5e1", or "2E+2". leading zeros are
+    also accepted. \see StringToDigits() for dates
+    \param text the number. does not need to be
+                null-terminated
+    \param textLength max number of characters to parse.
+                      parsing stops at the first character
+                      that is not part of the number
+    \param value updated with the number. set to INT_MAX or
+                 INT_MIN when the number overflows
+    \param numberLength optional. updated with the number
+                        of characters parsed
+    \returns RESULT_OK, RESULT_WARNING when the number does
+             not fit in an int, or RESULT_ERROR when text is
+             not a number or not a whole number
+*/
+static Result_t StringToInt(
+    const char* text,
+    int textLength,
+    int* value,
+    int* numberLength);
+
+/** parse a field of a date such as "2024" or "01".
+    only the digits '0' to '9' are accepted so a sign,
+    fraction, or exponent is not part of the field
+    \param text the digits. does not need to be
+                null-terminated
+    \param textLength max number of digits to parse.
+                      parsing stops at the first character
+                      that is not a digit
+    \param value updated with the number
+    \param digitCount optional. updated with the number
+                      of digits parsed
+    \returns RESULT_OK or RESULT_ERROR when text does not
+             start with a digit
+*/
+static Result_t StringToDigits(
+    const char* text,
+    int textLength,
+    int* value,
+    int* digitCount);
+
+/** search for an uppercase character
+    \param text
+    \param maxChars max number of characters
+           to search through
+    \returns position of the uppercase character or
+             INVALID_POSITION if not found
+*/
+static int FindUppercase(
+    const char* text,
+    int maxChars);
+
+/** continue a 32-bit FNV-1a hash
+    \param hash HASH_FNV_OFFSET to start a new hash or the
+                result of a previous call to continue it
+    \param data the bytes to hash
+    \param dataLength number of bytes at data
+    \returns the updated hash
+*/
+static uint32_t HashFnv1a(
+    uint32_t hash,
+    const void* data,
+    int dataLength);
+
+/** continue a 64-bit FNV-1a hash
+    \param hash HASH_FNV64_OFFSET to start a new hash or the
+                result of a previous call to continue it
+    \param data the bytes to hash
+    \param dataLength number of bytes at data
+    \returns the updated hash
+*/
+static uint64_t HashFnv1a64(
+    uint64_t hash,
+    const void* data,
+    int dataLength);
+
+// --- OUTPUT BUFFER ---
+
+/** init. the buffer is allocated on the first write
+    \param me
+*/
+static void OutputBufferInit(
+    OutputBuffer_t* me);
+
+/** deinit
+    \param me
+*/
+static void OutputBufferDeInit(
+    OutputBuffer_t* me);
+
+/** remove all text without releasing memory so the
+    buffer can be reused
+    \param me
+*/
+static void OutputBufferClear(
+    OutputBuffer_t* me);
+
+/** make sure there is space for additional bytes
+    \param me
+    \param length the number of bytes about to be written
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferReserve(
+    OutputBuffer_t* me,
+    int length);
+
+/** append text to the end of the buffer
+    \param me
+    \param text the text to append
+    \param textLength number of bytes to append
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferAppend(
+    OutputBuffer_t* me,
+    const char* text,
+    int textLength);
+
+/** append a null-terminated string to the end of
+    the buffer
+    \param me
+    \param text the text to append
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferAppendText(
+    OutputBuffer_t* me,
+    const char* text);
+
+/** append text to the end of the buffer replacing each
+    html special character with its entity.
+    see HtmlFindSpecialChar()
+    \param me
+    \param text the text to escape and append
+    \param textLength number of bytes to append
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferAppendHtml(
+    OutputBuffer_t* me,
+    const char* text,
+    int textLength);
+
+/** append formatted text to the end of the buffer
+    \param me
+    \param format printf() style format string
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferPrintf(
+    OutputBuffer_t* me,
+    const char* format,
+    ...);
+
+/** write the entire buffer to a stream
+    \param me
+    \param stream such as stdout
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferWrite(
+    OutputBuffer_t* me,
+    FILE* stream);
+
+/** write several buffers to a stream in order. anything
+    already buffered by the stream is written first
+    \param buffers the buffers to write
+    \param bufferCount number of buffers
+    \param stream such as stdout
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t OutputBufferWriteAll(
+    OutputBuffer_t* buffers,
+    int bufferCount,
+    FILE* stream);
+
+// --- SHARED OUTPUT ---
+
+/** allocate an empty output with a single owner
+    \returns the output or NULL
+*/
+static SharedOutput_t* SharedOutputCreate(void);
+
+/** add an owner
+    \param me
+*/
+static void SharedOutputRetain(
+    SharedOutput_t* me);
+
+/** remove an owner and free the output if it was
+    the last one
+    \param me
+*/
+static void SharedOutputRelease(
+    SharedOutput_t* me);
+
+// --- TIME AND DATE ---
+
+/** get the number of days in the specified month
+    \param month \see Month_e
+    \param year used to determine leap year.
+           use YEAR_UNKNOWN if unsure.
+    \returns the number of days 31, 30, 29, or 28
+*/
+static int GetDaysInMonth(
+    int month,
+    int year);
+
+/** get a date string from the timestamp
+    \param time the timestamp
+    \param dest location to store the string
+    \param destLength bytes available at dest
+    \param dateOption control whether the year, month, and
+           day are written to the string
+*/
+static int TimeToDateString(
+    time_t time,
+    char* dest,
+    int destLength,
+    DateOption_t dateOption);
+
+/** get the timestamp from the date string
+    \param time optional pointer to the time to update.
+           use NULL and check for RESULT_ERROR if just
+           checking if date is valid.
+    \param date optional date in DATE_STRING_FORMAT
+           use NULL or empty string for no date.
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t TimeFromDateString(
+    time_t* time,
+    const char* date);
+
+/** get a time in nanoseconds that only moves forward.
+    it is only useful to measure the time between calls
+    \returns the time
+*/
+static int64_t TimeNowNano(void);
+
+// --- ENTRIES ---
+
+/** init. call EntriesResize() after init to set size of
+    this array.
+    \param me
+*/
+static void EntriesInit(
+    Entries_t* me);
+
+/** deinit
+    \param me
+*/
+static void EntriesDeInit(
+    Entries_t* me);
+
+/** resize the entries array
+    \param me
+    \param max the max number of entries this array
+           should be able to store
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t EntriesResize(
+    Entries_t* me,
+    int max);
+
+/** append an entry to the end of the array
+    \param me
+    \param entry a pointer to the entry to append
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t EntriesAppend(
+    Entries_t* me,
+    Entry_t* entry);
+
+/** insert an entry at the specified index within the array
+    \param me
+    \param entry a pointer to the entry to append
+    \param index the position to insert between 0 and the
+           current number of entries
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t EntriesInsertAt(
+    Entries_t* me,
+    Entry_t* entry,
+    int index);
+
+/** an EntriesFindCallback_t to find an older entry.
+    see EntriesFind()
+    \param entry
+    \param entryTime
+    \param userData pointer to an Entry_t to compare to
+    \returns RESULT_OK if entry is older than userData
+*/
+static Result_t CallbackEntryIsOlder(
+    Entry_t* entry,
+    EntryTime_t entryTime,
+    void* userData);
+
+/** an EntriesFindCallback_t to find a newer entry.
+    see EntriesFind()
+    \param entry
+    \param userData pointer to an Entry_t to compare to
+    \returns RESULT_OK if entry is newer than userData
+*/
+static Result_t CallbackEntryIsNewer(
+    Entry_t* entry,
+    EntryTime_t entryTime,
+    void* userData);
+
+/** find an entry
+    \param me
+    \param findCallback callback to define find conditions
+    \param entryTime the time to compare while searching
+    \param userData passed to the callback
+    \returns the index of the entry that was found or
+             INVALID_POSITION if not found
+*/
+static int EntriesFind(
+    Entries_t* me,
+    EntriesFindCallback_t findCallback,
+    EntryTime_t entryTime,
+    void* userData);
+
+/** remove an entry from the end of the array
+    \param me
+    \returns a pointer to the entry or NULL if none exist
+*/
+static Entry_t* EntriesTakeLast(
+    Entries_t* me);
+
+// --- ENTRIES TRAVERSE ---
+
+/** init. call EntriesTraverseFirst() after init to
+    begin traversing an array
+    \param me
+*/
+static void EntriesTraverseInit(
+    EntriesTraverse_t* me);
+
+/** deinit
+    \param me
+*/
+static void EntriesTraverseDeInit(
+    EntriesTraverse_t* me);
+
+/** get the first entry based on the specified order
+    \param me
+    \param entries the entries to traverse
+    \param order the order to traverse the entries with
+            subsequent calls to EntriesTraverseNext()
+    \param entryTime the time to compare when sorting
+           by ORDER_NEWEST_FIRST or ORDER_OLDEST_FIRST
+    \returns the first entry or NULL if none remain
+*/
+static Entry_t* EntriesTraverseFirst(
+    EntriesTraverse_t* me,
+    Entries_t* entries,
+    Order_t order,
+    EntryTime_t entryTime);
+
+/** get the next entry based on the order started by
+    the last call to EntriesTraverseFirst()
+    \param me
+    \returns the next entry or NULL if none remain
+*/
+static Entry_t* EntriesTraverseNext(
+    EntriesTraverse_t* me);
+
+// --- MANAGED ENTRIES ---
+
+/** init
+    \param me
+    \param max the max entries allowed
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ManagedEntriesInit(
+    ManagedEntries_t* me,
+    int max);
+
+/** deinit
+    \param me
+*/
+static void ManagedEntriesDeInit(
+    ManagedEntries_t* me);
+
+/** free every entry but keep the array so it can be
+    filled again
+    \param me
+*/
+static void ManagedEntriesClear(
+    ManagedEntries_t* me);
+
+/** append an entry to the array
+    \param me
+    \param text the entry text. cannot be empty.
+    \param start optional start date.
+           see TimeFromDateString()
+    \param end optional end date when start is specified.
+           see TimeFromDateString()
+    \returns the entry or NULL for error
+*/
+static Entry_t* ManagedEntriesAppend(
+    ManagedEntries_t* me,
+    const char* text,
+    const char* start,
+    const char* end);
+
+/** append an entry to the array using part of a string
+    \param me
+    \param text the entry text
+    \param textLength the entry text length
+    \param start optional start date.
+           see TimeFromDateString()
+    \param end optional end date when start is specified.
+           see TimeFromDateString()
+    \returns the entry or NULL for error
+*/
+static Entry_t* ManagedEntriesAppendSubstr(
+    ManagedEntries_t* me,
+    const char* text,
+    int textLength,
+    const char* start,
+    const char* end);
+
+/** append an entry owned by another array without
+    copying it. the entry is freed when the last array
+    that owns it is cleared
+    \param me
+    \param source the entry to share. its text and dates
+                  are not changed
+    \returns the entry or NULL for error
+*/
+static Entry_t* ManagedEntriesAppendShared(
+    ManagedEntries_t* me,
+    Entry_t* source);
+
+/** move entries from another array to the end of this
+    array without copying them
+    \param me
+    \param source the entries to move in order. entries that
+                  do not fit are left here
+    \returns RESULT_OK or RESULT_ERROR if this array is full
+*/
+static Result_t ManagedEntriesMove(
+    ManagedEntries_t* me,
+    ManagedEntries_t* source);
+
+// --- ENTRY ---
+
+/** init
+    \param me
+*/
+static void EntryInit(
+    Entry_t* me);
+
+/** deinit
+    \param me
+*/
+static void EntryDeInit(
+    Entry_t* me);
+
+/** set the entry text.
+    this creates a deep copy of the string.
+    \param me
+    \param text optional pointer to a null-terminated
+                string. use NULL to clear the text.
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t EntrySetText(
+    Entry_t* me,
+    const char* text);
+
+/** set the entry text to a substring.
+    this creates a deep copy of the string.
+    \param me
+    \param text optional pointer to a null-terminated
+                string. use NULL to clear the text.
+    \param textLength length of text
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t EntrySetTextSubstr(
+    Entry_t* me,
+    const char* text,
+    int textLength);
+
+/** get a date string from the entry time.
+    this uses TimeToDateString() to get the string
+    unless the timestamp value is TIMESTAMP_UNSET
+    or the dateOption prevents the string from being
+    written entirely
+    \param me
+    \param dest
+    \param destLength
+    \param entryTime
+    \param dateOption
+    \returns positing within dest where writing date
+             string data was stopped.
+             Note: the entire destLength will still be
+             filled with either spaces or periods
+             depending on whether the dateOption allowed
+             anything to be written
+*/
+static int EntryTimeToString(
+    Entry_t* me,
+    char* dest,
+    int destLength,
+    EntryTime_t entryTime,
+    DateOption_t dateOption);
+
+// --- SECTION DATA ---
+
+/** init
+    \param me
+*/
+static void SectionDataInit(
+    SectionData_t* me);
+
+/** deinit
+    \param me
+*/
+static void SectionDataDeInit( // recursive
+    SectionData_t* me);
+
+/** restore the defaults and remove every entry but keep
+    the memory allocated for the entries.
+    the section must not have a next section
+    \param me
+*/
+static void SectionDataClear(
+    SectionData_t* me);
+
+/** set the section title.
+    this creates a deep copy of the string.
+    \param me
+    \param text optional pointer to a null-terminated
+                string. use NULL to clear the text.
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t SectionDataSetTitle(
+    SectionData_t* me,
+    const char* title);
+
+/** set the section title.
+    this creates a deep copy of the string.
+    \param me
+    \param title optional pointer to a null-terminated
+                 string. use NULL to clear the text.
+    \param titleLength length of title
+    \returns RESULT_OK, RESULT_WARNING, or RESULT_ERROR
+*/
+static Result_t SectionDataSetTitleSubstr(
+    SectionData_t* me,
+    const char* title,
+    int titleLength);
+
+/** include an entry in this section
+    \param me
+    \param entry pointer to the entry
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionDataIncludeEntry(
+    SectionData_t* me,
+    Entry_t* entry);
+
+/** get all entries of this section in display order.
+    the entries are only sorted the first time this is
+    called after an entry is included so every render
+    shares the same order
+    \param me
+    \returns the ordered entries or NULL if they could
+             not be ordered
+*/
+static Entries_t* SectionDataGetOrderedEntries(
+    SectionData_t* me);
+
+/** include a block of entries in this section.
+    the entries are not managed by the section
+    \param me
+    \param entries the first entry
+    \param entryCount number of entries
+    \param isOrdered RESULT_YES if the entries are already
+                     in display order so they are never
+                     sorted by SectionDataGetOrderedEntries()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionDataIncludeEntries(
+    SectionData_t* me,
+    Entry_t* entries,
+    int entryCount,
+    Result_t isOrdered);
+
+// --- JSON ---
+
+/** find the data length of a value
+    \param json the json data. examples:
+                - 1000 will return 4
+                - "text" will return 6
+                - true will return 4
+    \param jsonState this will be updated only if an
+                     error occurs. \see enum JsonState_e
+    \returns the value data length or
+             0 if json does not start with a value
+*/
+static int JsonValueDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState);
+
+/** find the data length of a number
+    \param json the json data. example: 5.1
+                will return 3 as the data length.
+                a leading '-' and an exponent such
+                as -2.5e3 are included in the length
+    \param jsonState this will be updated only if an
+                     error occurs. \see enum JsonState_e
+    \returns the value data length or
+             0 if json does not start with a number
+*/
+static int JsonNumberDataLength(
+    const char* json,
+    JsonState_t* jsonState);
+
+/** find the data length of a single quoted string
+    \param json the json data. example: "string": "value"
+                will return 8 as the data length
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns the string data length including the quotes or
+             0 if json does not start with a '"' or
+             1 if an end '"' was not found
+*/
+static int JsonStringDataLength(
+    const char* json,
+    JsonState_t* jsonState);
+
+/** find the data length of an array
+    \param json the json data. example: ["value1","value2"]
+                will return 19 as the data length
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns the array data length including the brackets or
+             0 if json does not start with a '[' or
+             1 if an end ']' was not found
+*/
+static int JsonArrayDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState);
+
+/** find the data length of an object
+    \param json the json data. example: {"key":"value"}
+                will return 15 as the data length
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns the object data length including the braces or
+             0 if json does not start with a '{' or
+             1 if an end '}' was not found
+*/
+static int JsonObjectDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState);
+
+/** skip the current json data
+    \param json current json data
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns pointer to the next, non-whitespace, json data.
+             IMPORTANT: if the skip cannot occur the
+                        original pointer is returned
+             good examples:
+             - if '[' then after the closing ']':
+               ',', ']', '}', or '\0'
+             - if '{' then after the closing '}':
+               ',', ']', '}', or '\0'
+             - if '"' then after the closing '"':
+               ',', ']', '}', ':', or '\0'
+             - if ':' then after the value:
+               ',', '}', or '\0'
+             - if a number then after it:
+               ',', ']', '}', or '\0'
+             - if a boolean then after it:
+               ',', ']', '}', or '\0'
+             - if a null then after it:
+               ',', ']', '}', or '\0'
+             - if ',' then after it:
+               '{', '[', or '"'
+             - if whitespace then a non-whitespace after it
+*/
+static const char* JsonSkip( // recursive
+    const char* json,
+    JsonState_t* jsonState);
+
+/** uses JsonSkip() to find the start of the value for
+    the specified key
+    \param json current json data within an object
+    \param key the key to search for within the object
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns a pointer to the start of the value for this
+             key or the end of the object if the key is not
+             found. the start of the value is any
+             non-whitespace character following the ':'
+             after the key
+*/
+static const char* JsonSkipToKeyValue( // recursive
+    const char* json,
+    const char* key,
+    JsonState_t* jsonState);
+
+/** uses JsonSkip() to find the start of the value for
+    the next key within an object.
+    \param json current json data within an object.
+                the next non-whitespace character should
+                be one of the following: '"', ',', '}', '\0'
+                Note: when looping through object keys,
+                      this pointer must be the return value
+                      of the previous call to this function
+                      plus the value length.
+                      \see JsonValueDataLength()
+    \param key this will be set to the next key or NULL
+               if no key was found
+    \param keyLength this is the length of the next key
+                     or < 2 if no key was found
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns a pointer to the start of the value for the
+             next key or the end of the object if there
+             are no more keys. the start of the value is
+             any non-whitespace character following the ':'
+             after the key. use JsonValueDataLength() to
+             find the lenth of the value.
+*/
+static const char* JsonSkipToNextValue( // recursive
+    const char* json,
+    const char** key,
+    int* keyLength,
+    JsonState_t* jsonState);
+
+/** find the position in the json data where the next
+    array index begins.
+    \param json the json data at the first character within
+                the array at the current index.
+                - for currentIndex == INVALID_POSITION this
+                  should be the first character after the
+                  open bracket '['
+                - for currentIndex >= 0 this should be the
+                  first character of the data at that index
+                  past the '[' or ','
+    \param currentIndex set this to the current index or to
+                        INVALID_POSITION when looking for
+                        the start of index 0. this will be
+                        updated to the next index value on
+                        success or to INVALID_POSITION if
+                        no array data remains.
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns a pointer to the first character of the
+             json value at currentIndex.
+             if currentIndex is INVALID_POSITION then a
+             pointer to: ']' or '\0'
+*/
+static const char* JsonArrayNextIndex( // recursive
+    const char* json,
+    int* currentIndex,
+    JsonState_t* jsonState);
+
+/** search for the escape character '\\' within
+    json string data
+    \param json the string data after the opening '"'
+    \param jsonLength number of characters to search
+    \returns position of the escape character or
+             jsonLength if not found
+*/
+static int JsonFindEscapeChar(
+    const char* json,
+    int jsonLength);
+
+/** decode the escape sequences of json string data
+    \param json the string data after the opening '"'
+    \param jsonLength number of characters to decode
+                      not including the closing '"'
+    \param dest location to store the decoded text. this
+                must have space for jsonLength characters
+                because decoding never adds characters
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns the decoded text length or INVALID_POSITION
+             if an escape sequence is invalid
+*/
+static int JsonStringDecode(
+    const char* json,
+    int jsonLength,
+    char* dest,
+    JsonState_t* jsonState);
+
+/** get the text of a quoted json string. the text is
+    only decoded when it contains an escape sequence.
+    otherwise the text is used in place without a copy.
+    \param json the json data starting at the opening '"'
+    \param jsonLength the string data length including
+                      the quotes. \see JsonStringDataLength()
+    \param scratch stores the decoded text when needed.
+                   the decoded text is null-terminated
+    \param text updated to the start of the text
+    \param textLength updated to the text length
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t JsonStringGetText(
+    const char* json,
+    int jsonLength,
+    OutputBuffer_t* scratch,
+    const char** text,
+    int* textLength,
+    JsonState_t* jsonState);
+
+// --- SERVER ---
+
+/** init
+    \param me
+    \param callback called for every request
+    \param userData passed to the callback
+*/
+static void ServerInit(
+    Server_t* me,
+    ServerRequestCallback_t callback,
+    void* userData);
+
+/** deinit. closes the listening socket and removes
+    the unix socket path
+    \param me
+*/
+static void ServerDeInit(
+    Server_t* me);
+
+/** listen on a unix domain socket. an existing socket at
+    the path is replaced, but any other file is not
+    \param me
+    \param path the socket path
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerListenUnix(
+    Server_t* me,
+    const char* path);
+
+/** listen on a tcp port of the loopback address so only
+    clients on the same machine can connect
+    \param me
+    \param port 1 to SERVER_PORT_MAX
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerListenTcp(
+    Server_t* me,
+    int port);
+
+#if defined(RESUME_SERVE)
+/** start listening on the bound m_ServerSocket and
+    wait for connections with epoll
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerListenStart(
+    Server_t* me);
+#endif
+
+/** answer requests until SIGINT or SIGTERM
+    \param me a listening server
+    \returns RESULT_OK when stopped by a signal or
+             RESULT_ERROR
+*/
+static Result_t ServerRun(
+    Server_t* me);
+
+#if defined(RESUME_SERVE)
+/** accept every waiting connection
+    \param me
+*/
+static void ServerAccept(
+    Server_t* me);
+
+/** read from a connection and answer each complete request.
+    stops reading while the connection is paused
+    \param me
+    \param connection
+    \returns RESULT_OK or RESULT_ERROR to close the connection
+*/
+static Result_t ServerConnectionRead(
+    Server_t* me,
+    ServerConnection_t* connection);
+
+/** answer the complete requests in the connection input
+    until SERVER_MAX_PENDING_OUTPUT bytes are waiting to be
+    sent. the connection is paused if requests are left
+    \param me
+    \param connection
+    \returns RESULT_OK or RESULT_ERROR if a request is too long
+*/
+static Result_t ServerConnectionAnswer(
+    Server_t* me,
+    ServerConnection_t* connection);
+
+/** send as much of the waiting output as possible and
+    answer the requests of a paused connection once
+    enough was sent
+    \param me
+    \param connection
+    \returns RESULT_OK or RESULT_ERROR to close the connection
+*/
+static Result_t ServerConnectionWrite(
+    Server_t* me,
+    ServerConnection_t* connection);
+#endif
+
+/** close a connection and free it
+    \param me
+    \param connection
+*/
+static void ServerConnectionClose(
+    Server_t* me,
+    ServerConnection_t* connection);
+
+#if defined(RESUME_SERVE)
+/** init
+    \param me
+*/
+static void ServerResponseInit(
+    ServerResponse_t* me);
+#endif
+
+/** deinit. releases every shared part
+    \param me
+*/
+static void ServerResponseDeInit(
+    ServerResponse_t* me);
+
+/** remove every part without releasing memory. every
+    shared part is released
+    \param me
+*/
+static void ServerResponseClear(
+    ServerResponse_t* me);
+
+/** queue output after the bytes already written to
+    m_ResponseBytes. it is sent by reference so it must
+    not change until it is released
+    \param me
+    \param shared the output. retained until it is sent
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerResponseAttach(
+    ServerResponse_t* me,
+    SharedOutput_t* shared);
+
+/** put the bytes of m_ResponseBytes that are not in a
+    part yet into a new part
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerResponseQueueBytes(
+    ServerResponse_t* me);
+
+/** add a part to the end
+    \param me
+    \param shared see m_PartShared
+    \param offset see m_PartOffset
+    \param length see m_PartLength
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ServerResponseAddPart(
+    ServerResponse_t* me,
+    SharedOutput_t* shared,
+    int offset,
+    int length);
+
+#if defined(RESUME_SERVE)
+/** number of bytes waiting to be sent
+    \param me
+    \returns number of bytes
+*/
+static int ServerResponseGetPending(
+    ServerResponse_t* me);
+
+/** skip bytes that were sent. every shared part that
+    was completely sent is released
+    \param me
+    \param sentLength number of bytes sent
+*/
+static void ServerResponseSent(
+    ServerResponse_t* me,
+    int sentLength);
+#endif
+
+#if defined(RESUME_SERVE)
+/** signal handler used by ServerRun() to stop
+    \param signalNumber SIGINT or SIGTERM
+*/
+static void ServerSignalStop(
+    int signalNumber);
+#endif
+
+// --- HTTP ---
+
+/** find a header in an http request
+    \param headers the header lines after the request line.
+                   does not need to be null-terminated
+    \param headersLength number of bytes at headers
+    \param name null-terminated header name.
+                case is ignored
+    \param value updated to the start of the value without
+                 leading or trailing whitespace
+    \returns number of bytes at value or INVALID_POSITION
+             if the header is not found
+*/
+static int HttpFindHeader(
+    const char* headers,
+    int headersLength,
+    const char* name,
+    const char** value);
+
+/** check a comma separated header value such as
+    "Connection: keep-alive, Upgrade" for a token.
+    case is ignored
+    \param list the header value
+    \param listLength number of bytes at list
+    \param token null-terminated token to find
+    \returns RESULT_YES if found or RESULT_NO
+*/
+static Result_t HttpListHasToken(
+    const char* list,
+    int listLength,
+    const char* token);
+
+/** check an If-None-Match header value for an ETag.
+    weak ETags such as W/"1" match the same strong ETag
+    and "*" matches every ETag
+    \param list the header value
+    \param listLength number of bytes at list
+    \param etag null-terminated ETag including quotes
+    \returns RESULT_YES if found or RESULT_NO
+*/
+static Result_t HttpETagMatches(
+    const char* list,
+    int listLength,
+    const char* etag);
+
+/** decode '+' and "%XX" in a query parameter in place.
+    invalid escapes are kept as they are
+    \param text the query parameter
+    \param textLength number of bytes at text
+    \returns number of bytes at text after decoding
+*/
+static int HttpUrlDecode(
+    char* text,
+    int textLength);
+
+// --- SNAPSHOT ---
+
+/** init
+    \param me
+*/
+static void SnapshotInit(
+    Snapshot_t* me);
+
+/** open a snapshot file. the file is mapped read-only
+    when mmap() is available and read into memory otherwise
+    \param me
+    \param path the snapshot file
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SnapshotOpen(
+    Snapshot_t* me,
+    const char* path);
+
+/** close the snapshot file. any pointers into the
+    snapshot data are no longer valid
+    \param me
+*/
+static void SnapshotClose(
+    Snapshot_t* me);
+
+/** check a snapshot table is inside the snapshot data
+    \param me
+    \param offset table position from the start of the data
+    \param count number of table records
+    \param recordSize number of bytes in each record
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SnapshotCheckTable(
+    Snapshot_t* me,
+    uint32_t offset,
+    uint32_t count,
+    int recordSize);
+
+/** check a string is inside the string pool and
+    is null-terminated
+    \param pool the string pool
+    \param poolSize number of bytes in the string pool
+    \param offset string position in the pool
+    \param length string length
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SnapshotCheckString(
+    const char* pool,
+    int poolSize,
+    uint32_t offset,
+    uint32_t length);
+
+// --- RESUME ---
+
+/** init
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeInit(
+    Resume_t* me,
+    ResumeOptions_t* resumeOptions);
+
+/** check if the specified section should be hidden
+    \param me
+    \param sectionTitle null-terminated string
+    \returns RESULT_YES if hidden or RESULT_NO
+*/
+static Result_t ResumeOptionsIsHiddenSection(
+    ResumeOptions_t* me,
+    const char* sectionTitle);
+
+/** get the max number of entries to display in a section
+    after applying the resume options
+    \param me
+    \param sectionData
+    \returns DISPLAY_NONE, DISPLAY_ALL, or the max number
+             of entries to display
+*/
+static int ResumeOptionsGetDisplayMax(
+    ResumeOptions_t* me,
+    SectionData_t* sectionData);
+
+/** hash the options that change how the resume is
+    rendered. hidden sections are hashed in sorted order
+    without duplicates so options that render the same
+    resume have the same hash
+    \param me
+    \returns the hash
+*/
+static uint32_t ResumeOptionsHash(
+    ResumeOptions_t* me);
+
+/** write the options that change how the resume is
+    rendered so they can be compared. hidden sections are
+    written in sorted order without duplicates so options
+    that render the same resume write the same bytes
+    \param me
+    \param output the buffer to write to. it is not cleared
+*/
+static void ResumeOptionsWriteKey(
+    ResumeOptions_t* me,
+    OutputBuffer_t* output);
+
+/** sort the hidden section names without duplicates
+    \param me
+    \param hidden updated with up to
+                  RESUME_OPTIONS_MAX_HIDDEN_SECTIONS names
+    \returns number of names at hidden
+*/
+static int ResumeOptionsSortHidden(
+    ResumeOptions_t* me,
+    const char** hidden);
+
+/** deinit
+    \param me
+*/
+static void ResumeDeInit(
+    Resume_t* me);
+
+/** remove every section and entry so the resume can be
+    filled again. memory allocated for the entries is kept.
+    the options are not changed
+    \param me
+*/
+static void ResumeClear(
+    Resume_t* me);
+
+/** insert section data at runtime
+    \param me
+    \param section the section index to insert
+            new section data. a value
+            >= SECTION_AT_RUNTIME and
+            <= ResumeGetSectionCount()
+    \returns pointer to the initialized section data
+             or NULL if it could not be inserted
+*/
+SectionData_t* ResumeInsertSection(
+    Resume_t* me,
+    Section_t section);
+
+/** remove a section without deinit
+*/
+SectionData_t* ResumeRemoveSection(
+    Resume_t* me,
+    Section_t section);
+
+/** get the total number of hard-coded
+    and runtime sections
+*/
+Section_t ResumeGetSectionCount(
+    Resume_t* me);
+
+/** get section data from the resume
+    \param me
+    \param section see enum Section_e
+    \returns section data or NULL if it does not exist
+*/
+SectionData_t* ResumeGetSectionData(
+    Resume_t* me,
+    Section_t section);
+
+/** get section index from the resume
+    \param me
+    \param sectionData
+    \returns see enum Section_e
+*/
+Section_t ResumeGetSectionIndex(
+    Resume_t* me,
+    SectionData_t* sectionData);
+
+/** get a section title from the resume
+    \param me
+    \param section see enum Section_e
+    \returns section title or empty string if there is none
+*/
+static const char* ResumeGetSectionTitle(
+    Resume_t* me,
+    Section_t section);
+
+/** add entry to the resume under the specified section
+    \param me
+    \param section see enum Section_e
+    \param text the entry text. cannot be empty.
+    \param start optional start date.
+           see TimeFromDateString()
+    \param end optional end date when start is specified.
+           see TimeFromDateString()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeAddEntry(
+    Resume_t* me,
+    Section_t section,
+    const char* text,
+    const char* start,
+    const char* end);
+
+/** add entry to the specified section
+    \param me
+    \param resume
+    \param text the entry text
+    \param textLength the entry text length
+    \param start optional start date.
+           see TimeFromDateString()
+    \param end optional end date when start is specified.
+           see TimeFromDateString()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionAddEntry(
+    SectionData_t* me,
+    Resume_t* resume,
+    const char* text,
+    int textLength,
+    const char* start,
+    const char* end);
+
+/** share the entries of a section from another resume
+    including its display order so nothing is parsed,
+    copied, or sorted
+    \param me an empty section
+    \param resume the resume that shares the entries
+    \param source an ordered section. only the references
+                  of its entries change so it can be shared
+                  while it is rendered
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionShare(
+    SectionData_t* me,
+    Resume_t* resume,
+    SectionData_t* source);
+
+/** find a section filled from a json object
+    \param me
+    \param fingerprint see m_SectionFingerprint
+    \returns the first runtime section with the fingerprint
+             or NULL if there is none
+*/
+static SectionData_t* ResumeFindSectionByFingerprint(
+    Resume_t* me,
+    uint64_t fingerprint);
+
+/** order the entries of every section so they can be
+    rendered any number of times without sorting again.
+    see SectionDataGetOrderedEntries()
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeOrderSections(
+    Resume_t* me);
+
+/** order the entries of every section using m_ThreadCount
+    threads. random sections are ordered on the calling
+    thread in the same order as ResumeOrderSections()
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeOrderSectionsParallel(
+    Resume_t* me);
+
+/** order the entries of a section.
+    see SectionPoolCallback_t
+*/
+static Result_t ResumeOrderSectionCallback(
+    SectionData_t* sectionData,
+    Section_t section,
+    void* userData);
+
+/** move the entries of every ordered section that are
+    most relevant to m_RankText first. entries that are
+    equally relevant stay in section order. the term index
+    is kept in m_ResumeRank until the resume changes
+    \param me an ordered resume
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeRankSections(
+    Resume_t* me);
+
+/** fill a resume from the hard-coded data and a json
+    array and order its sections
+    \param me an initialized or cleared resume
+    \param json null-terminated json array of sections or
+                NULL when the sections were already filled
+                from a snapshot and only need ordering
+    \param callback called as each phase starts or NULL
+    \param userData passed to callback
+    \returns RESULT_OK or RESULT_ERROR. see
+             ResumePrintLoadError()
+*/
+static Result_t ResumeLoad(
+    Resume_t* me,
+    const char* json,
+    ResumeLoadCallback_t callback,
+    void* userData);
+
+/** same as ResumeLoad() but sections that did not change
+    share their entries with a previous resume
+    \param me an initialized or cleared resume
+    \param json see ResumeLoad()
+    \param previous optional. see
+                    ResumeFillSectionsFromJsonArrayReusing()
+    \param reusedCount optional. updated with the number of
+                       sections shared with previous
+    \param callback called as each phase starts or NULL
+    \param userData passed to callback
+    \returns RESULT_OK or RESULT_ERROR. see
+             ResumePrintLoadError()
+*/
+static Result_t ResumeLoadReusing(
+    Resume_t* me,
+    const char* json,
+    Resume_t* previous,
+    int* reusedCount,
+    ResumeLoadCallback_t callback,
+    void* userData);
+
+/** print why ResumeLoad() failed
+    \param me the resume that failed to load
+    \param nameFormat printf() format of the name of the
+                      resume followed by its arguments
+*/
+static void ResumePrintLoadError(
+    Resume_t* me,
+    const char* nameFormat,
+    ...);
+
+/** print the text of an entry with every keyword of
+    m_Highlight marked
+    \param options the display options and format
+    \param text the entry text
+    \param output the buffer to write to
+*/
+static void ResumePrintEntryText(
+    ResumeOptions_t* options,
+    const char* text,
+    OutputBuffer_t* output);
+
+/** print the resume in the format selected by options
+    \param me
+    \param options the display options and format
+    \param output the buffer to write to
+*/
+static void ResumePrint(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output);
+
+/** print the resume in a format other than the one
+    selected by options
+    \param me
+    \param options the display options
+    \param format the format to print
+    \param output the buffer to write to
+    \returns RESULT_OK or RESULT_ERROR if output failed
+             to grow
+*/
+static Result_t ResumePrintFormat(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    Format_t format,
+    OutputBuffer_t* output);
+
+/** print html version of resume
+    \param me
+    \param options the display options
+    \param output the buffer to write to
+*/
+static void ResumePrintHtml(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output);
+
+/** print text version of resume
+    \param me
+    \param options the display options
+    \param output the buffer to write to
+*/
+static void ResumePrintPlainText(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output);
+
+/** print everything before the first section in the
+    format selected by options
+    \param options the display options and format
+    \param output the buffer to write to
+*/
+static void ResumePrintHeader(
+    ResumeOptions_t* options,
+    OutputBuffer_t* output);
+
+/** print a section in the format selected by options.
+    nothing is printed if the section is hidden
+    \param options the display options and format
+    \param sectionData the section
+    \param output the buffer to write to
+*/
+static void ResumePrintSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output);
+
+/** print everything after the last section in the
+    format selected by options
+    \param options the display options and format
+    \param output the buffer to write to
+*/
+static void ResumePrintFooter(
+    ResumeOptions_t* options,
+    OutputBuffer_t* output);
+
+/** print the html header
+    \param output the buffer to write to
+*/
+static void ResumePrintHtmlHeader(
+    OutputBuffer_t* output);
+
+/** print an html section
+    \param options the display options
+    \param sectionData the section
+    \param output the buffer to write to
+*/
+static void ResumePrintHtmlSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output);
+
+/** print the html footer
+    \param output the buffer to write to
+*/
+static void ResumePrintHtmlFooter(
+    OutputBuffer_t* output);
+
+/** print the text header
+    \param output the buffer to write to
+*/
+static void ResumePrintPlainTextHeader(
+    OutputBuffer_t* output);
+
+/** print a text section
+    \param options the display options
+    \param sectionData the section
+    \param output the buffer to write to
+*/
+static void ResumePrintPlainTextSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output);
+
+/** print the text footer
+    \param output the buffer to write to
+*/
+static void ResumePrintPlainTextFooter(
+    OutputBuffer_t* output);
+
+/** fill resume sections at runtime from a json array
+    \param me
+    \param json a pointer to the start of a json array.
+                Note: any whitespace before the '['
+                      will be ignored
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillSectionsFromJsonArray(
+    Resume_t* me,
+    const char* json);
+
+/** fill resume sections at runtime from a json array.
+    a json object that is exactly the same as the one a
+    section of the previous resume was filled from shares
+    the entries of that section instead of being parsed
+    \param me
+    \param json see ResumeFillSectionsFromJsonArray()
+    \param previous optional. an ordered resume to share
+                    unchanged sections with. only the
+                    references of its entries change
+    \param reusedCount optional. updated with the number of
+                       sections shared with previous
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillSectionsFromJsonArrayReusing(
+    Resume_t* me,
+    const char* json,
+    Resume_t* previous,
+    int* reusedCount);
+
+/** fill resume sections at runtime from a json array using
+    m_ThreadCount threads. the resume is the same as one
+    filled by ResumeFillSectionsFromJsonArray() on a single
+    thread
+    \param me
+    \param json see ResumeFillSectionsFromJsonArray()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillSectionsFromJsonArrayParallel(
+    Resume_t* me,
+    const char* json);
+
+/** fill the section at runtime from a json object
+    \param me
+    \param sectionData
+    \param json a pointer to the start of a json object.
+                Note: any whitespace before the '{'
+                      will be ignored
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillSectionFromJsonObject(
+    Resume_t* me,
+    SectionData_t* sectionData,
+    const char* json);
+
+/** fill resume entries at runtime from a json array
+    \param me
+    \param sectionData
+    \param json a pointer to the start of a json array.
+                Note: any whitespace before the '['
+                      will be ignored
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillEntriesFromJsonArray(
+    Resume_t* me, 
+    SectionData_t* sectionData,
+    const char* json);
+
+/** fill the resume from a snapshot file created by
+    ResumeWriteSnapshot(). the snapshot stays open until
+    ResumeDeInit() because the entries use its text
+    \param me an initialized resume with no entries
+    \param path the snapshot file
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillFromSnapshot(
+    Resume_t* me,
+    const char* path);
+
+/** fill the resume from snapshot tables. all entries are
+    created with a single allocation and their text points
+    into the string pool so the pool must remain valid
+    until ResumeDeInit()
+    \param me an initialized resume with no entries
+    \param sections the section table
+    \param sectionCount number of sections
+    \param entries the entry table
+    \param entryCount number of entries
+    \param pool the string pool
+    \param poolSize number of bytes in the string pool
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeFillFromSnapshotTables(
+    Resume_t* me,
+    const SnapshotSection_t* sections,
+    int sectionCount,
+    const SnapshotEntry_t* entries,
+    int entryCount,
+    const char* pool,
+    int poolSize);
+
+/** write the resume as a snapshot that can be loaded
+    by ResumeFillFromSnapshot()
+    \param me an ordered resume. see ResumeOrderSections()
+    \param output the buffer to write to
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeWriteSnapshot(
+    Resume_t* me,
+    OutputBuffer_t* output);
+
+/** write the resume as c source with static snapshot
+    tables. building with RESUME_GENERATED_DATA set to the
+    generated file fills the resume from these tables with
+    ResumeFillFromSnapshotTables() instead of parsing
+    \param me an ordered resume. see ResumeOrderSections()
+    \param output the buffer to write to
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeWriteGenerated(
+    Resume_t* me,
+    OutputBuffer_t* output);
+
+/** fill the resume from hard-coded data.
+    calls ResumeFillSectionsFromHardCoded() and ResumeFillEntriesFromHardCoded()
+*/
+static Result_t ResumeFillHardCoded(
+    Resume_t* me);
+
+/** fill the resume with section data
+*/
+static Result_t ResumeFillSectionsFromHardCoded(
+    Resume_t* me);
+
+/** fill the resume with entries
+*/
+static Result_t ResumeFillEntriesFromHardCoded(
+    Resume_t* me);
+
+// --- RENDER CACHE ---
+
+/** init
+    \param me
+*/
+static void RenderCacheInit(
+    RenderCache_t* me);
+
+/** deinit
+    \param me
+*/
+static void RenderCacheDeInit(
+    RenderCache_t* me);
+
+/** get the resume rendered with the options. the resume
+    is only rendered when these options were not used
+    since the resume last changed
+    \param me
+    \param resume the resume to render
+    \param options the options to render with
+    \returns the rendered resume owned by the cache or NULL
+             if it could not be rendered. it is not copied
+             and stays valid until the next RenderCacheGet()
+             unless it is retained. a retained render is
+             never changed by the cache
+*/
+static SharedOutput_t* RenderCacheGet(
+    RenderCache_t* me,
+    Resume_t* resume,
+    ResumeOptions_t* options);
+
+/** make an entry the most recently used
+    \param me
+    \param entry
+*/
+static void RenderCacheTouch(
+    RenderCache_t* me,
+    RenderCacheEntry_t* entry);
+
+// --- RESUME SHARED ---
+
+/** init
+    \param me
+    \param first the first resume readers use
+*/
+static void ResumeSharedInit(
+    ResumeShared_t* me,
+    Resume_t* first);
+
+/** deinit. frees the current resume.
+    no reader can be reading
+    \param me
+*/
+static void ResumeSharedDeInit(
+    ResumeShared_t* me);
+
+/** start reading the current resume. never waits
+    \param me
+    \param reader 0 to RESUME_SHARED_MAX_READERS - 1.
+                  only one thread can use each reader
+    \returns the resume that stays valid until
+             ResumeSharedDone()
+*/
+static Resume_t* ResumeSharedRead(
+    ResumeShared_t* me,
+    int reader);
+
+/** finish reading the resume returned by ResumeSharedRead()
+    \param me
+    \param reader the reader passed to ResumeSharedRead()
+*/
+static void ResumeSharedDone(
+    ResumeShared_t* me,
+    int reader);
+
+#if defined(RESUME_RELOAD)
+/** replace the current resume. waits for readers of the
+    previous resume to finish then frees it. only one
+    thread can publish
+    \param me
+    \param resume a resume allocated with malloc(). its
+                  generation is moved past the previous
+                  resume so it is never mistaken for it
+*/
+static void ResumeSharedPublish(
+    ResumeShared_t* me,
+    Resume_t* resume);
+#endif
+
+/** deinit a resume that is no longer used and free it
+    unless it is m_SharedFirst
+    \param me
+    \param resume
+*/
+static void ResumeSharedRetire(
+    ResumeShared_t* me,
+    Resume_t* resume);
+
+// --- RESUME RELOAD ---
+
+/** start a thread that reloads a json file every time
+    it changes and publishes the new resume
+    \param me
+    \param shared where each reloaded resume is published
+    \param path the json file. must stay valid until
+                ResumeReloadStop()
+    \param options the options of every reloaded resume
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeReloadStart(
+    ResumeReload_t* me,
+    ResumeShared_t* shared,
+    const char* path,
+    ResumeOptions_t* options);
+
+/** stop the reload thread and wait for it to finish
+    \param me
+*/
+static void ResumeReloadStop(
+    ResumeReload_t* me);
+
+#if defined(RESUME_RELOAD)
+/** reload the json file into a new resume and publish it.
+    the previous resume is kept if the file cannot be loaded
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeReloadFile(
+    ResumeReload_t* me);
+
+/** the reload thread started by ResumeReloadStart()
+    \param userData the ResumeReload_t
+    \returns NULL
+*/
+static void* ResumeReloadThread(
+    void* userData);
+#endif
+
+// --- SECTION PARSER ---
+
+/** init
+    \param me
+    \param options the options of each thread's arena
+*/
+static void SectionParserInit(
+    SectionParser_t* me,
+    ResumeOptions_t* options);
+
+/** deinit. frees every section and entry that was not
+    linked to a resume
+    \param me
+*/
+static void SectionParserDeInit(
+    SectionParser_t* me);
+
+/** add a job for each object in a json array without
+    filling any section
+    \param me
+    \param json the json sections array
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionParserFindSections(
+    SectionParser_t* me,
+    const char* json);
+
+/** run every job and wait for them to finish
+    \param me
+    \param threadCount number of threads including the
+                       calling thread
+*/
+static void SectionParserRun(
+    SectionParser_t* me,
+    int threadCount);
+
+/** run jobs until there are none left
+    \param me
+*/
+static void SectionParserWork(
+    SectionParser_t* me);
+
+#if defined(RESUME_THREADS)
+/** a thread started by SectionParserRun()
+    \param userData the SectionParser_t
+    \returns NULL
+*/
+static void* SectionParserThread(
+    void* userData);
+#endif
+
+/** link the filled sections and move their entries to a
+    resume in job order. stops at the first job that failed
+    the same way ResumeFillSectionsFromJsonArray() would
+    \param me
+    \param resume
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionParserLink(
+    SectionParser_t* me,
+    Resume_t* resume);
+
+// --- SECTION POOL ---
+
+/** init with every section of a resume
+    \param me
+    \param resume the sections must not be added or
+                  removed until SectionPoolDeInit()
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t SectionPoolInit(
+    SectionPool_t* me,
+    Resume_t* resume);
+
+/** deinit
+    \param me
+*/
+static void SectionPoolDeInit(
+    SectionPool_t* me);
+
+/** run a callback for every section that does not have
+    a result yet and wait for them to finish. a section
+    can be finished on the calling thread first by setting
+    its m_PoolResults
+    \param me
+    \param threadCount number of threads including the
+                       calling thread
+    \param callback the callback
+    \param userData passed to the callback
+*/
+static void SectionPoolRun(
+    SectionPool_t* me,
+    int threadCount,
+    SectionPoolCallback_t callback,
+    void* userData);
+
+/** run the callback until there are no sections left
+    \param me
+*/
+static void SectionPoolWork(
+    SectionPool_t* me);
+
+#if defined(RESUME_THREADS)
+/** a thread started by SectionPoolRun()
+    \param userData the SectionPool_t
+    \returns NULL
+*/
+static void* SectionPoolThread(
+    void* userData);
+#endif
+
+// --- RESUME RENDER ---
+
+/** init
+    \param me
+*/
+static void ResumeRenderInit(
+    ResumeRender_t* me);
+
+/** deinit
+    \param me
+*/
+static void ResumeRenderDeInit(
+    ResumeRender_t* me);
+
+/** render a resume with each section in its own buffer.
+    the buffers are the same as ResumePrint() would write
+    \param me
+    \param resume the resume
+    \param options the display options and format
+    \param threadCount number of threads including the
+                       calling thread
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t ResumeRenderRun(
+    ResumeRender_t* me,
+    Resume_t* resume,
+    ResumeOptions_t* options,
+    int threadCount);
+
+/** render a section into its buffer.
+    see SectionPoolCallback_t
+*/
+static Result_t ResumeRenderSectionCallback(
+    SectionData_t* sectionData,
+    Section_t section,
+    void* userData);
+
+// --- RANK ---
+
+/** init
+    \param me
+*/
+static void RankInit(
+    Rank_t* me);
+
+/** deinit
+    \param me
+*/
+static void RankDeInit(
+    Rank_t* me);
+
+/** index the terms of every entry of an ordered resume
+    \param me
+    \param resume the resume
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t RankBuild(
+    Rank_t* me,
+    Resume_t* resume);
+
+/** score every entry against text
+    \param me an index from RankBuild()
+    \param text keywords or a job description
+    \returns number of terms of text found in the index
+*/
+static int RankScore(
+    Rank_t* me,
+    const char* text);
+
+/** sort the ordered entries of every section by score
+    \param me an index scored by RankScore()
+    \param resume the resume passed to RankBuild()
+*/
+static void RankApply(
+    Rank_t* me,
+    Resume_t* resume);
+
+/** find or add a term
+    \param me
+    \param term the lowercase term
+    \param termLength bytes at term
+    \param termText where the term was found. NULL to
+                    only find the term
+    \returns index in m_RankTerms or INVALID_POSITION
+*/
+static int RankFindTerm(
+    Rank_t* me,
+    const char* term,
+    int termLength,
+    const char* termText);
+
+/** find the next term of text that is not a stop word
+    \param text the text to search. moved to the end of
+                the term
+    \param term set to the lowercase term. at least
+                RANK_MAX_TERM_LENGTH bytes
+    \param termText set to where the term was found
+    \returns bytes at term or 0 when there are no more
+             terms
+*/
+static int RankNextTerm(
+    const char** text,
+    char* term,
+    const char** termText);
+
+/** a base 2 log that is exact at each power of two and
+    linear between them. the ranking only needs it to
+    grow with value
+    \param value 1 or more
+    \returns the log
+*/
+static double RankLog2(
+    double value);
+
+/** compare two RankOrder_t for qsort(). the highest score
+    is first then the lowest position
+    \param left a RankOrder_t
+    \param right a RankOrder_t
+    \returns less than, equal to, or greater than 0
+*/
+static int RankCompareOrder(
+    const void* left,
+    const void* right);
+
+// --- HIGHLIGHT ---
+
+/** init
+    \param me
+*/
+static void HighlightInit(
+    Highlight_t* me);
+
+/** deinit
+    \param me
+*/
+static void HighlightDeInit(
+    Highlight_t* me);
+
+/** build the automaton of every keyword
+    \param me
+    \param text the keywords. one per line or separated by
+                ','. spaces around each keyword are ignored
+                and keywords match without case
+    \returns RESULT_OK or RESULT_ERROR if there are no
+             keywords or memory could not be allocated
+*/
+static Result_t HighlightBuild(
+    Highlight_t* me,
+    const char* text);
+
+/** append text with each keyword marked. a keyword must
+    start and end at a word boundary and the longest
+    keyword is marked when keywords overlap
+    \param me
+    \param text the text
+    \param format selects the marks and escaping
+    \param output the buffer to write to
+*/
+static void HighlightAppend(
+    const Highlight_t* me,
+    const char* text,
+    Format_t format,
+    OutputBuffer_t* output);
+
+/** append part of the text in a format
+    \param text the text
+    \param textLength bytes of text
+    \param format FORMAT_HTML to escape the text
+    \param output the buffer to write to
+*/
+static void HighlightAppendPart(
+    const char* text,
+    int textLength,
+    Format_t format,
+    OutputBuffer_t* output);
+
+/** find the next keyword of text
+    \param text the text. moved to the byte after the
+                keyword
+    \param keywordLength set to the bytes of the keyword
+    \returns the keyword or NULL when there are no more
+*/
+static const char* HighlightNextKeyword(
+    const char** text,
+    int* keywordLength);
+
+/** check if a byte is part of a word. utf-8 bytes are
+    letters
+    \param value the byte
+    \returns RESULT_YES or RESULT_NO
+*/
+static Result_t HighlightIsWordByte(
+    char value);
+
+// --- BATCH ---
+
+/** init
+    \param me
+    \param cachePath the --cache file or NULL to render
+                     every job
+    \param options every job starts with these options
+*/
+static void BatchInit(
+    Batch_t* me,
+    const char* cachePath,
+    ResumeOptions_t* options);
+
+/** deinit
+    \param me
+*/
+static void BatchDeInit(
+    Batch_t* me);
+
+/** read a manifest and add a job for each line.
+    each line is a json file, a format and destination
+    the same as -o, and any of the -a, -e, -f, or -H
+    options. empty lines and lines starting with '#'
+    are skipped. errors are printed with the line number
+    \param me
+    \param path the manifest
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BatchLoadManifest(
+    Batch_t* me,
+    const char* path);
+
+/** parse a single manifest line into a new job
+    \param me
+    \param line the line which is split in place
+    \param lineLength number of bytes at line
+    \param lineNumber used in error messages
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BatchAddJob(
+    Batch_t* me,
+    char* line,
+    int lineLength,
+    int lineNumber);
+
+/** hash the program version, json file name, and options
+    of a job. an output with a different key is rendered
+    again even if the json file did not change
+    \param job the job
+    \returns the key
+*/
+static uint64_t BatchJobKey(
+    BatchJob_t* job);
+
+/** read the --cache file written by a previous --batch.
+    a missing file or a file from another version is empty
+    so every job is rendered
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BatchLoadCache(
+    Batch_t* me);
+
+/** find the cache entry for each job by destination
+    \param me
+*/
+static void BatchMatchCache(
+    Batch_t* me);
+
+/** write the --cache file with every job that is up to
+    date. failed jobs are left out so they run again
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BatchSaveCache(
+    Batch_t* me);
+
+/** run every job and wait for them to finish
+    \param me
+    \param threadCount number of threads including the
+                       calling thread
+    \returns number of jobs that failed or
+             INVALID_POSITION if the jobs could not run
+*/
+static int BatchRun(
+    Batch_t* me,
+    int threadCount);
+
+/** take the next job from a worker's own range or steal
+    half of the range of another worker
+    \param me
+    \returns the job index or INVALID_POSITION when there
+             are no jobs left
+*/
+static int BatchWorkerTake(
+    BatchWorker_t* me);
+
+/** render a single job unless its output is up to date
+    \param me
+    \param job the job
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BatchWorkerRunJob(
+    BatchWorker_t* me,
+    BatchJob_t* job);
+
+/** run jobs until there are none left
+    \param me
+*/
+static void BatchWorkerWork(
+    BatchWorker_t* me);
+
+#if defined(RESUME_THREADS)
+/** a thread started by BatchRun()
+    \param userData the BatchWorker_t
+    \returns NULL
+*/
+static void* BatchWorkerThread(
+    void* userData);
+#endif
+
+// --- BENCH ---
+
+/** init with the default spec
+    \param me
+    \param options used to fill and render the resume
+*/
+static void BenchInit(
+    Bench_t* me,
+    ResumeOptions_t* options);
+
+/** deinit
+    \param me
+*/
+static void BenchDeInit(
+    Bench_t* me);
+
+/** update the spec from comma separated key=value pairs.
+    iterations, sections, entries, text=min-max,
+    years=min-max, ongoing=percent, display, newest,
+    oldest, random, seed, size, and depth. errors are
+    printed
+    \param me
+    \param spec the pairs such as "sections=20,text=10-400"
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BenchParseSpec(
+    Bench_t* me,
+    const char* spec);
+
+/** write the json of the synthetic resume to m_BenchJson
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BenchGenerate(
+    Bench_t* me);
+
+/** append random lowercase words
+    \param output the buffer to append to
+    \param length number of characters to append
+*/
+static void BenchAppendText(
+    OutputBuffer_t* output,
+    int length);
+
+/** fill, order, and render the resume once
+    \param me
+    \param times updated with the nanoseconds of each phase
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BenchRunIteration(
+    Bench_t* me,
+    int64_t times[BENCH_PHASE_COUNT]);
+
+/** records when each ResumeLoad() phase starts.
+    see ResumeLoadCallback_t
+    \param phase
+    \param userData int64_t[LOAD_PHASE_COUNT] set to the
+                    nanoseconds when phase starts
+*/
+static void BenchLoadTime(
+    LoadPhase_t phase,
+    void* userData);
+
+/** run every iteration after one that is not timed
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BenchRun(
+    Bench_t* me);
+
+/** print the median, p99, and mean of each phase
+    \param me
+*/
+static void BenchReport(
+    Bench_t* me);
+
+/** compare two times for qsort()
+    \param left an int64_t
+    \param right an int64_t
+    \returns less than, equal to, or greater than 0
+*/
+static int BenchCompareTimes(
+    const void* left,
+    const void* right);
+
+/** write a --bench-json corpus to m_BenchJson and find
+    the offset of every string and object in it
+    \param me
+    \param corpus the corpus
+    \returns RESULT_OK or RESULT_ERROR if the corpus is not
+             valid json
+*/
+static Result_t BenchGenerateCorpus(
+    Bench_t* me,
+    BenchCorpus_t corpus);
+
+/** append a single object of a --bench-json corpus
+    \param me
+    \param corpus the corpus
+*/
+static void BenchAppendCorpusObject(
+    Bench_t* me,
+    BenchCorpus_t corpus);
+
+/** run a json function over all of m_BenchJson once
+    \param me
+    \param primitive the function
+    \param jsonState this will be updated only if an error
+                     occurs. \see enum JsonState_e
+    \returns number of json bytes the function went over
+*/
+static int64_t BenchJsonWalk(
+    Bench_t* me,
+    BenchPrimitive_t primitive,
+    JsonState_t* jsonState);
+
+/** time every json function over every corpus and print
+    the results
+    \param me
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t BenchJsonRun(
+    Bench_t* me);
+
+/** read the time stamp counter
+    \returns the number of ticks or 0 when there is no
+             time stamp counter
+*/
+static int64_t BenchReadCycles(void);
+
+/** check the memory of every --bench-memory resume
+    \param me
+    \param overBudget incremented for each phase that is
+                      over its budget
+    \returns RESULT_OK or RESULT_ERROR when a resume
+             could not be loaded
+*/
+static Result_t BenchMemoryRun(
+    Bench_t* me,
+    int* overBudget);
+
+/** load, order, render, and free a resume and check the
+    allocations and peak bytes of each phase
+    \param me
+    \param name the name of the resume to print
+    \param json the sections json array
+    \param overBudget incremented for each phase that is
+                      over its budget
+    \returns RESULT_OK or RESULT_ERROR when the resume
+             could not be loaded
+*/
+static Result_t BenchMemoryCase(
+    Bench_t* me,
+    const char* name,
+    const char* json,
+    int* overBudget);
+
+/** counts the memory of each ResumeLoad() phase.
+    see ResumeLoadCallback_t
+    \param phase
+    \param userData the BenchMemory_t of the case
+*/
+static void BenchLoadMemory(
+    LoadPhase_t phase,
+    void* userData);
+
+/** start counting the memory of a phase
+    \param allocs set to the allocations and resizes so
+                  far
+    \param live set to the live bytes now
+*/
+static void BenchMemoryBegin(
+    int64_t* allocs,
+    int64_t* live);
+
+/** stop counting the memory of a phase
+    \param allocs the value from BenchMemoryBegin().
+                  set to the allocations and resizes made
+                  by the phase
+    \param live the value from BenchMemoryBegin(). set to
+                the most bytes the phase had live at once
+*/
+static void BenchMemoryEnd(
+    int64_t* allocs,
+    int64_t* live);
+
+/** print the memory of a phase and its budget
+    \param name the phase
+    \param allocs allocations and resizes of the phase
+    \param maxAllocs budget of allocs
+    \param peak the most bytes the phase had live at once
+    \param maxPeak budget of peak
+    \param overBudget incremented when the phase is over
+                      its budget
+*/
+static void BenchMemoryPrint(
+    const char* name,
+    int64_t allocs,
+    int64_t maxAllocs,
+    int64_t peak,
+    int64_t maxPeak,
+    int* overBudget);
+
+// --- GOLDEN ---
+
+/** initialize
+    \param me
+    \param directory the directory of the golden files
+    \param update RESULT_YES to write every golden file
+                  and the baseline
+    \param options display options
+*/
+static void GoldenInit(
+    Golden_t* me,
+    const char* directory,
+    Result_t update,
+    ResumeOptions_t* options);
+
+/** free every buffer
+    \param me
+*/
+static void GoldenDeInit(
+    Golden_t* me);
+
+/** check every output of the built-in and generated
+    resumes and write the baseline with --golden-update
+    \param me
+    \returns RESULT_OK or RESULT_ERROR when a resume
+             could not be loaded or a file could not be
+             written
+*/
+static Result_t GoldenRun(
+    Golden_t* me);
+
+/** load a resume with the options of a case then check
+    and time it in both formats
+    \param me
+    \param inputName the name of the resume used in the
+                     name of each output
+    \param json the sections json array
+    \param goldenCase the options
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t GoldenRunCase(
+    Golden_t* me,
+    const char* inputName,
+    const char* json,
+    const GoldenCase_t* goldenCase);
+
+/** compare m_GoldenOutput to its golden file or write
+    the golden file with --golden-update
+    \param me
+    \param fileName the golden file in m_GoldenDirectory
+    \param status set to the result printed for the output
+    \returns RESULT_OK or RESULT_ERROR when the golden
+             file could not be written
+*/
+static Result_t GoldenCheck(
+    Golden_t* me,
+    const char* fileName,
+    const char** status);
+
+/** print the first line that is different between the
+    golden file and the output
+    \param me
+    \param fileName the golden file
+    \param expectedLength length of m_GoldenExpected not
+                          including the null-terminator
+*/
+static void GoldenPrintDifference(
+    Golden_t* me,
+    const char* fileName,
+    int expectedLength);
+
+/** find the render time of an output in the baseline
+    \param me
+    \param fileName the golden file of the output
+    \returns nanoseconds or 0 when it is not in the
+             baseline
+*/
+static int64_t GoldenFindBaseline(
+    Golden_t* me,
+    const char* fileName);
+
+// --- TRACE ---
+
+/** initialize a trace and claim the first ring for the
+    calling thread
+    \param me
+*/
+static void TraceInit(
+    Trace_t* me);
+
+/** free the ring of every thread
+    \param me
+*/
+static void TraceDeInit(
+    Trace_t* me);
+
+/** get the time a span starts
+    \returns the time from TimeNowNano() or 0 when nothing
+             is being traced
+*/
+static int64_t TraceBegin(void);
+
+/** record a span on the ring of the calling thread
+    \param span the kind of span
+    \param detail the section title or phase name or NULL
+    \param count number of entries or bytes in the span
+    \param start the time from TraceBegin(). the span is
+                 not recorded when start is 0
+*/
+static void TraceEnd(
+    TraceSpan_t span,
+    const char* detail,
+    int count,
+    int64_t start);
+
+/** get the ring of the calling thread. the ring is
+    claimed the first time the thread records an event
+    \param me
+    \returns the ring or NULL when too many threads have
+             recorded events
+*/
+static TraceRing_t* TraceGetRing(
+    Trace_t* me);
+
+/** append every event as chrome trace-event json
+    \param me
+    \param output the buffer to append to
+    \returns RESULT_OK or RESULT_ERROR
+*/
+static Result_t TraceWrite(
+    Trace_t* me,
+    OutputBuffer_t* output);
+
+/** append text escaped for a json string without the
+    quotes. bytes from 0x80 are Latin-1 characters and
+    are written as \u00XX
+    \param output the buffer to append to
+    \param text the null-terminated text
+*/
+static void TraceAppendJsonText(
+    OutputBuffer_t* output,
+    const char* text);
+
+//
+// MARK: GLOBALS
+//
+
+static const char g_JsonKeywordTrue[]  = "true";
+static const char g_JsonKeywordFalse[] = "false";
+static const char g_JsonKeywordNull[]  = "null";
+
+static const char g_ResumeFullName[]     = RESUME_FULL_NAME;
+static const char g_ResumeEmail[]        = RESUME_EMAIL;
+static const char g_ResumeCity[]         = RESUME_CITY;
+static const char g_ResumeState[]        = RESUME_STATE;
+static const char g_ResumeMobileNumber[] = RESUME_MOBILE_NUMBER;
+static const char g_ResumeWebUrl[]       = RESUME_WEB_URL;
+static const char g_ResumeJsonData[]     = RESUME_JSON_DATA;
+
+static const char g_EmptyText[] = "";
+
+/** lookup table to find the text of each resume string
+*/
+static const char* g_ResumeStringLookup[RESUME_STRING_ID_COUNT] =
+{
+    "",                           // RESUME_STRING_ID_UNKNOWN
+    RESUME_STRING_DATE_END,       // RESUME_STRING_ID_DATE_END
+    RESUME_STRING_DATE_OPTION,    // RESUME_STRING_ID_DATE_OPTION
+    RESUME_STRING_DATE_ORDER,     // RESUME_STRING_ID_DATE_ORDER
+    RESUME_STRING_DATE_START,     // RESUME_STRING_ID_DATE_START
+    RESUME_STRING_DISPLAY_MAX,    // RESUME_STRING_ID_DISPLAY_MAX
+    RESUME_STRING_ENTRIES,        // RESUME_STRING_ID_ENTRIES
+    RESUME_STRING_NAME,           // RESUME_STRING_ID_NAME
+    RESUME_STRING_NEWEST_FIRST,   // RESUME_STRING_ID_NEWEST_FIRST
+    RESUME_STRING_OLDEST_FIRST,   // RESUME_STRING_ID_OLDEST_FIRST
+    RESUME_STRING_ORDER,          // RESUME_STRING_ID_ORDER
+    RESUME_STRING_RANDOM,         // RESUME_STRING_ID_RANDOM
+    RESUME_STRING_SHOW_YEAR_ONLY, // RESUME_STRING_ID_SHOW_YEAR_ONLY
+    RESUME_STRING_TEXT            // RESUME_STRING_ID_TEXT
+};
+
+/** lookup table to find text version of entry state
+*/
+static const char* g_EntryStateLookup[ENTRY_STATE_COUNT] =
+{
+    "unknown",               // ENTRY_STATE_UNKNOWN
+    "ok",                    // ENTRY_STATE_OK
+    "error-full",            // ENTRY_STATE_ERROR_FULL
+    "error-text-empty",      // ENTRY_STATE_ERROR_TEXT_EMPTY
+    "error-text-missing",    // ENTRY_STATE_ERROR_TEXT_MISSING
+    "error-text-invalid",    // ENTRY_STATE_ERROR_TEXT_INVALID
+    "error-start-date",      // ENTRY_STATE_ERROR_START_DATE
+    "error-end-date",        // ENTRY_STATE_ERROR_END_DATE
+    "error-start-missing",   // ENTRY_STATE_ERROR_START_DATE_MISSING
+    "error-alloc",           // ENTRY_STATE_ERROR_ALLOC
+    "error-set-text",        // ENTRY_STATE_ERROR_SET_TEXT
+    "error-resize",          // ENTRY_STATE_ERROR_RESIZE
+    "error-section-missing"  // ENTRY_STATE_ERROR_SECTION_MISSING
+};
+
+/** lookup table to find the json name of each Order_t
+*/
+static const char* g_OrderLookup[ORDER_COUNT] =
+{
+    RESUME_STRING_NEWEST_FIRST, // ORDER_NEWEST_FIRST
+    RESUME_STRING_OLDEST_FIRST, // ORDER_OLDEST_FIRST
+    RESUME_STRING_RANDOM        // ORDER_RANDOM
+};
+
+/** lookup table to find the name of each --stats phase
+*/
+static const char* g_StatsPhaseLookup[STATS_PHASE_COUNT] =
+{
+    "init",            // STATS_PHASE_INIT
+    "read",            // STATS_PHASE_READ
+    "fill-hard-coded", // STATS_PHASE_FILL_HARD_CODED
+    "fill-json",       // STATS_PHASE_FILL_JSON
+    "fill-snapshot",   // STATS_PHASE_FILL_SNAPSHOT
+    "order",           // STATS_PHASE_ORDER
+    "render",          // STATS_PHASE_RENDER
+    "write"            // STATS_PHASE_WRITE
+};
+
+/** lookup table to find the name of each --bench phase
+*/
+static const char* g_BenchPhaseLookup[BENCH_PHASE_COUNT] =
+{
+    "init",        // BENCH_PHASE_INIT
+    "fill",        // BENCH_PHASE_FILL
+    "order",       // BENCH_PHASE_ORDER
+    "render-text", // BENCH_PHASE_RENDER_TEXT
+    "render-html", // BENCH_PHASE_RENDER_HTML
+    "deinit"       // BENCH_PHASE_DEINIT
+};
+
+/** lookup table to find the name of each --bench-json
+    function
+*/
+static const char* g_BenchPrimitiveLookup[BENCH_PRIMITIVE_COUNT] =
+{
+    "JsonSkip",             // BENCH_PRIMITIVE_SKIP
+    "JsonStringDataLength", // BENCH_PRIMITIVE_STRING
+    "JsonArrayNextIndex",   // BENCH_PRIMITIVE_ARRAY
+    "JsonSkipToNextValue"   // BENCH_PRIMITIVE_OBJECT
+};
+
+/** lookup table to find the name of each --bench-json
+    corpus
+*/
+static const char* g_BenchCorpusLookup[BENCH_CORPUS_COUNT] =
+{
+    "flat",    // BENCH_CORPUS_FLAT
+    "nested",  // BENCH_CORPUS_NESTED
+    "escapes", // BENCH_CORPUS_ESCAPES
+    "pretty"   // BENCH_CORPUS_PRETTY
+};
+
+/** the marks around each --highlight keyword
+*/
+static const char* g_HighlightOpen[FORMAT_COUNT] =
+{
+    "*",     // FORMAT_TEXT
+    "<mark>" // FORMAT_HTML
+};
+
+/** the marks after each --highlight keyword
+*/
+static const char* g_HighlightClose[FORMAT_COUNT] =
+{
+    "*",      // FORMAT_TEXT
+    "</mark>" // FORMAT_HTML
+};
+
+/** common words that are never --rank terms
+*/
+static const char* g_RankStopWords[RANK_STOP_WORD_COUNT] =
+{
+    "a",    "an",   "and",  "are",  "as",   "at",   "be",   "by",
+    "for",  "from", "has",  "have", "in",   "is",   "it",   "its",
+    "of",   "on",   "or",   "our",  "that", "the",  "their", "this",
+    "to",   "was",  "we",   "will", "with", "you",  "your", "who"
+};
+
+/** each set of options rendered by --golden
+*/
+static const GoldenCase_t g_GoldenCases[GOLDEN_CASE_COUNT] =
+{
+    // name       extended      hide        seed  manifest
+    { "default",  DISPLAY_NONE, RESULT_NO,  1,    NULL },
+    { "extend-3", 3,            RESULT_NO,  1,    NULL },
+    { "all",      DISPLAY_ALL,  RESULT_NO,  1,    NULL },
+    { "hide",     DISPLAY_NONE, RESULT_YES, 1,    NULL },
+    { "seed-2",   DISPLAY_NONE, RESULT_NO,  2,    NULL },
+    { "all-seed-2", DISPLAY_ALL, RESULT_NO, 2,    NULL },
+    { "manifest-hide", DISPLAY_NONE, RESULT_NO, 1,
+      "resume.json text:resume.txt -a -H \"Work History\" -H \"Languages and Libraries\"" }
+};
+
+/** the sections hidden by --golden cases. one is
+    hard-coded and one is generated
+*/
+static const char* g_GoldenHidden[GOLDEN_HIDDEN_COUNT] =
+{
+    "Interests",
+    "Section 1"
+};
+
+/** lookup table to find the name of each --trace span
+*/
+static const char* g_TraceSpanLookup[TRACE_SPAN_COUNT] =
+{
+    "phase",   // TRACE_SPAN_PHASE
+    "parse",   // TRACE_SPAN_PARSE
+    "entries", // TRACE_SPAN_ENTRIES
+    "order",   // TRACE_SPAN_ORDER
+    "render"   // TRACE_SPAN_RENDER
+};
+
+/** lookup table to find what the count of each --trace
+    span is or NULL when it has no count
+*/
+static const char* g_TraceCountLookup[TRACE_SPAN_COUNT] =
+{
+    NULL,      // TRACE_SPAN_PHASE
+    "entries", // TRACE_SPAN_PARSE
+    "entries", // TRACE_SPAN_ENTRIES
+    "entries", // TRACE_SPAN_ORDER
+    "bytes"    // TRACE_SPAN_RENDER
+};
+
+/** lookup table to find the name of each MemoryKind_t
+*/
+static const char* g_MemoryKindLookup[MEMORY_COUNT] =
+{
+    "entries",  // MEMORY_ENTRIES
+    "text",     // MEMORY_TEXT
+    "sections", // MEMORY_SECTIONS
+    "traverse", // MEMORY_TRAVERSE
+    "output",   // MEMORY_OUTPUT
+    "threads",  // MEMORY_THREADS
+    "rank",     // MEMORY_RANK
+    "highlight" // MEMORY_HIGHLIGHT
+};
+
+/** every block allocated by MemoryAlloc() and
+    MemoryRealloc()
+*/
+static Memory_t g_Memory;
+
+/** the trace every thread records to or NULL when there
+    is no --trace
+*/
+static Trace_t* g_Trace = NULL;
+
+/** the ring of the calling thread. see TraceGetRing()
+*/
+static RESUME_THREAD_LOCAL TraceRing_t* g_TraceRing = NULL;
+
+/** set by ServerSignalStop() to stop ServerRun()
+*/
+static volatile sig_atomic_t g_ServerStop = 0;
+
+#if defined(RESUME_GENERATED_DATA)
+// static tables written by --generate. they define
+// g_GeneratedSections, g_GeneratedEntries, g_GeneratedPool,
+// and the number of records in each
+#include RESUME_GENERATED_DATA
+#endif
+
+//
+// MARK: HELPER MACROS
+//
+
+/** indicate a param is not used
+*/
+#define PARAM_NOT_USED(var) (void)var;
+
+/** check if the character is whitespace
+*/
+#define IS_WHITESPACE(c) ((c) <= ' ')
+
+/** skip whitespace including most non-printable characters
+*/
+#define SKIP_WHITESPACE(ptr)\
+while(IS_WHITESPACE(*ptr))\
+{\
+    if((*ptr) == '\0')\
+    {\
+        break;\
+    }\
+    ptr++;\
+}
+
+/** skip all characters until null-terminator is found
+*/
+#define SKIP_TO_NULL(ptr)\
+while((*ptr) != '\0')\
+{\
+    ptr++;\
+}
+
+/** atomic operations on RESUME_ATOMIC() types.
+    they are plain reads and writes without threads
+*/
+#if defined(RESUME_THREADS)
+#define ATOMIC_INIT(ptr, value)      atomic_init((ptr), (value))
+#define ATOMIC_LOAD(ptr)             atomic_load(ptr)
+#define ATOMIC_STORE(ptr, value)     atomic_store((ptr), (value))
+#define ATOMIC_FETCH_ADD(ptr, value) atomic_fetch_add((ptr), (value))
+#define ATOMIC_COMPARE_EXCHANGE(ptr, expected, desired) \
+    atomic_compare_exchange_weak((ptr), (expected), (desired))
+#else
+#define ATOMIC_INIT(ptr, value)      ((*(ptr)) = (value))
+#define ATOMIC_LOAD(ptr)             (*(ptr))
+#define ATOMIC_STORE(ptr, value)     ((*(ptr)) = (value))
+#define ATOMIC_FETCH_ADD(ptr, value) (((*(ptr)) += (value)) - (value))
+#define ATOMIC_COMPARE_EXCHANGE(ptr, expected, desired) \
+    (((*(ptr)) == (*(expected))) ? (((*(ptr)) = (desired)), 1) : (((*(expected)) = (*(ptr))), 0))
+#endif
+
+//
+// MARK: SOURCE
+//
+
+// MARK: --- MAIN ---
+
+/**********************************************************/
+static void MainPrintHelp(
+    const char* programName)
+{
+    printf("Usage: %s [options]\n", programName);
+    printf("\n");
+    printf("  options:\n");
+    printf("\n");
+    printf("    -a               display all entries. overrides -e\n");
+    printf("\n");
+    printf("    -e [count]       extend entry display\n");
+    printf("        count:\n");
+    printf("          1 - %d     this number of additional entries will\n", RESUME_MAX_LINES_PER_PAGE);
+    printf("                     be shown in each section when available\n");
+    printf("\n");
+    printf("    -f [format]      format of the resume output\n");
+    printf("        format:\n");
+    printf("          html       single-file HTML\n");
+    printf("          text       single-file plain text *default*\n");
+    printf("\n");
+    printf("    -h               this help text\n");
+    printf("\n");
+    printf("    -o [format:dest] write the resume in a format to a\n");
+    printf("                     destination. use \"%s\" as dest for\n", MAIN_OUTPUT_STDOUT);
+    printf("                     standard out. repeat up to %d times\n", MAIN_MAX_OUTPUTS);
+    printf("                     to write several outputs from a\n");
+    printf("                     single run. overrides -f\n");
+    printf("        example:\n");
+    printf("          -o text:resume.txt -o html:resume.html\n");
+    printf("\n");
+    printf("    -v               version\n");
+    printf("\n");
+    printf("    -j [file]        read sections from a json file instead\n");
+    printf("                     of the built-in json data\n");
+    printf("\n");
+    printf("    --rank [file]    display the entries of each section\n");
+    printf("                     most relevant to the keywords or job\n");
+    printf("                     description in file first\n");
+    printf("\n");
+    printf("    --highlight [file] mark each keyword in file in every\n");
+    printf("                     displayed entry. one keyword per line\n");
+    printf("                     or separated by ','\n");
+    printf("\n");
+    printf("    --compile [file] save the resume as a snapshot file\n");
+    printf("                     instead of displaying it. can not be\n");
+    printf("                     used with --serve\n");
+    printf("\n");
+    printf("    --generate [file] save the resume as static c tables\n");
+    printf("                     instead of displaying it. build with\n");
+    printf("                     -DRESUME_GENERATED_DATA='\"file\"'\n");
+    printf("                     to start with the resume built in\n");
+    printf("\n");
+    printf("    --snapshot [file] display the resume from a snapshot\n");
+    printf("                     file saved by --compile. can not be\n");
+    printf("                     used with -j\n");
+    printf("\n");
+    printf("    --serve [socket] load the resume once and answer render\n");
+    printf("                     requests on a unix domain socket until\n");
+    printf("                     stopped. each request is one line of\n");
+    printf("                     -a, -e, -f, and -H options. use\n");
+    printf("                     double quotes around a section name\n");
+    printf("                     with spaces. each response is\n");
+    printf("                     \"OK [length]\" and the resume or\n");
+    printf("                     \"ERROR [exit code]\"\n");
+    printf("\n");
+    printf("    --http [port]    load the resume once and answer http\n");
+    printf("                     requests on 127.0.0.1 until stopped.\n");
+    printf("                     replaces --serve. query parameters:\n");
+    printf("          format=html or format=text\n");
+    printf("          hide=[section] repeat for each section\n");
+    printf("          extend=[count] same as -e\n");
+    printf("          all            same as -a\n");
+    printf("        example:\n");
+    printf("          http://127.0.0.1:8080/?format=html&extend=2\n");
+    printf("\n");
+    printf("    --watch          reload the -j json file whenever it\n");
+    printf("                     changes while using --serve or --http\n");
+    printf("\n");
+    printf("    --stats          print the time and memory of each phase,\n");
+    printf("                     the entries of each section, the memory\n");
+    printf("                     of each part of the resume, and the\n");
+    printf("                     bytes rendered to standard error\n");
+    printf("\n");
+    printf("    --trace [file]   write a chrome trace-event json file with\n");
+    printf("                     the time of each phase and the parse,\n");
+    printf("                     order, and render of each section on\n");
+    printf("                     each thread. open it with perfetto\n");
+    printf("\n");
+    printf("    --threads [count] fill, order, and render the resume on\n");
+    printf("                     up to count threads. 1 - %d\n", RESUME_MAX_THREADS);
+    printf("\n");
+    printf("    --batch [file]   render every line of a manifest in a\n");
+    printf("                     single process. each line is a json\n");
+    printf("                     file, format:destination the same as\n");
+    printf("                     -o, and any -a, -e, -f, or -H options.\n");
+    printf("                     use double quotes around a section\n");
+    printf("                     name with spaces. uses --threads or\n");
+    printf("                     one thread per processor\n");
+    printf("        example:\n");
+    printf("          alice.json html:alice.html -e 2 -H Projects\n");
+    printf("          bob.json text:bob.txt -H \"Work History\"\n");
+    printf("\n");
+    printf("    --cache [file]   skip --batch jobs whose json file,\n");
+    printf("                     options, and version are the same as\n");
+    printf("                     the last run that used this file\n");
+    printf("\n");
+    printf("    --bench [spec]   generate a resume and print the median\n");
+    printf("                     and p99 time of each phase. spec is\n");
+    printf("                     comma separated key=value pairs:\n");
+    printf("          iterations=[count] timed runs. default 100\n");
+    printf("          sections=[count]   default 8\n");
+    printf("          entries=[count]    per section. default 12\n");
+    printf("          text=[min]-[max]   text length. default 20-120\n");
+    printf("          years=[min]-[max]  start years. default 1990-2026\n");
+    printf("          ongoing=[percent]  no end date. default 20\n");
+    printf("          display=[count]    display_max. default 5\n");
+    printf("          newest=[weight]    newest_first. default 2\n");
+    printf("          oldest=[weight]    oldest_first. default 1\n");
+    printf("          random=[weight]    random. default 1\n");
+    printf("          seed=[number]      default 1\n");
+    printf("        example:\n");
+    printf("          --bench iterations=500,sections=20,text=10-400\n");
+    printf("\n");
+    printf("    --bench-json [spec] time the json functions over flat,\n");
+    printf("                     nested, escaped, and pretty-printed\n");
+    printf("                     json and print MB/s and cycles per\n");
+    printf("                     byte of each. spec is the same as\n");
+    printf("                     --bench with these keys:\n");
+    printf("          iterations=[count] timed runs. default 100\n");
+    printf("          size=[bytes]       per corpus. default 262144\n");
+    printf("          depth=[count]      nested objects. default 32\n");
+    printf("          seed=[number]      default 1\n");
+    printf("\n");
+    printf("    --bench-memory [spec] load the built-in resume and a\n");
+    printf("                     resume generated from spec on a single\n");
+    printf("                     thread and check the allocations and\n");
+    printf("                     peak memory of each phase against a\n");
+    printf("                     budget. rendering again into the same\n");
+    printf("                     buffer must not allocate. exits with\n");
+    printf("                     %d when a phase is over budget. spec\n", EXIT_BENCH_OVER_BUDGET);
+    printf("                     is the same as --bench\n");
+    printf("\n");
+    printf("    --golden [dir]   render the built-in and a generated\n");
+    printf("                     resume with -a, -e 3, -H, and two\n");
+    printf("                     random seeds in both formats. each\n");
+    printf("                     output is compared to its golden file\n");
+    printf("                     in dir and its fastest render time to\n");
+    printf("                     %s. exits with %d when an\n", GOLDEN_BASELINE_FILE, EXIT_GOLDEN_MISMATCH);
+    printf("                     output is different, %d when a\n", EXIT_GOLDEN_MISSING);
+    printf("                     golden file or the baseline is\n");
+    printf("                     missing, or %d when it is more\n", EXIT_GOLDEN_SLOWER);
+    printf("                     than %d%% slower\n", GOLDEN_MAX_SLOWER_PERCENT);
+    printf("\n");
+    printf("    --golden-update [dir] write every golden file and the\n");
+    printf("                     baseline in dir. dir is created if\n");
+    printf("                     it does not exist\n");
+    printf("\n");
+}
+
+/**********************************************************/
+static void MainPrintVersion(void)
+{
+    printf("%s Resume v%d.%02d.%02d\n", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+    printf("\n");
+}
+
+/**********************************************************/
+static Result_t MainParseFormat(
+    const char* arg,
+    Format_t* format)
+{
+    Result_t result = RESULT_OK;
+
+    switch(arg[0])
+    {
+    case 'H': // fall-through
+    case 'h':
+    {
+        (*format) = FORMAT_HTML;
+    }
+    break;
+
+    case 'T': // fall-through
+    case 't':
+    {
+        (*format) = FORMAT_TEXT;
+    }
+    break;
+
+    default:
+    {
+        // unknown format
+        result = RESULT_ERROR;
+    }
+    break;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t MainWriteOutput(
+    const char* destination,
+    OutputBuffer_t* output)
+{
+    Result_t result = RESULT_ERROR;
+
+    if(strcmp(destination, MAIN_OUTPUT_STDOUT) == 0)
+    {
+        result = OutputBufferWrite(output, stdout);
+    }
+    else
+    {
+        // binary mode so the bytes written to the file
+        // exactly match the rendered output
+        FILE* file = fopen(destination, "wb");
+        if(file)
+        {
+            result = OutputBufferWrite(output, file);
+            if(fclose(file) != 0)
+            {
+                // failed to flush the file
+                result = RESULT_ERROR;
+            }
+        }
+        else
+        {
+            // cannot open the destination
+        }
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t MainWriteOutputs(
+    const char* destination,
+    OutputBuffer_t* outputs,
+    int outputCount)
+{
+    Result_t result = RESULT_ERROR;
+
+    if(strcmp(destination, MAIN_OUTPUT_STDOUT) == 0)
+    {
+        result = OutputBufferWriteAll(outputs, outputCount, stdout);
+    }
+    else
+    {
+        // binary mode so the bytes written to the file
+        // exactly match the rendered output
+        FILE* file = fopen(destination, "wb");
+        if(file)
+        {
+            result = OutputBufferWriteAll(outputs, outputCount, file);
+            if(fclose(file) != 0)
+            {
+                // failed to flush the file
+                result = RESULT_ERROR;
+            }
+        }
+        else
+        {
+            // cannot open the destination
+        }
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static int MainParseResumeOption(
+    int argc,
+    char** argv,
+    int* index,
+    ResumeOptions_t* options)
+{
+    int exitCode = EXIT_OK;
+    char* arg = argv[(*index)];
+
+    if(strcmp(arg, "-H") == 0)
+    {
+        // hidden section title expected
+        (*index)++;
+        if((*index) < argc)
+        {
+            arg = argv[(*index)];
+            if(arg)
+            {
+                if(options->m_HideSectionCount < RESUME_OPTIONS_MAX_HIDDEN_SECTIONS)
+                {
+                    options->m_HideSectionName[options->m_HideSectionCount] = arg;
+                    options->m_HideSectionCount++;
+                }
+                else
+                {
+                    // out of resume options hidden sections
+                }
+            }
+            else
+            {
+                // invalid section name
+            }
+        }
+        else
+        {
+            // missing section name
+        }
+    }
+    else if(strcmp(arg, "-f") == 0)
+    {
+        // format expected
+        (*index)++;
+        if((*index) < argc)
+        {
+            arg = argv[(*index)];
+            if(arg)
+            {
+                if(MainParseFormat(arg, &options->m_DisplayFormat) == RESULT_ERROR)
+                {
+                    exitCode = EXIT_FORMAT_UNKNOWN_ARG;
+                    printf("Error: unknown format arg \"%s\"\n", arg);
+                }
+            }
+            else
+            {
+                exitCode = EXIT_FORMAT_ARG_MISSING;
+                printf("Error: format arg data is missing\n");
+            }
+        }
+        else
+        {
+            exitCode = EXIT_FORMAT_SELECTION_MISSING;
+            printf("Error: format selection is missing\n");
+        }
+    }
+    else if(strcmp(arg, "-a") == 0)
+    {
+        options->m_ExtendedDisplayCount = DISPLAY_ALL;
+    }
+    else if(strcmp(arg, "-e") == 0)
+    {
+        // additional entry count expected
+        (*index)++;
+        if((*index) < argc)
+        {
+            arg = argv[(*index)];
+            if(arg)
+            {
+                int count;
+                int argLength = (int)strlen(arg);
+                int numberLength;
+                if((StringToInt(arg, argLength, &count, &numberLength) != RESULT_OK) ||
+                   (numberLength != argLength))
+                {
+                    // parsing failed or
+                    // count does not fit in an int
+                    count = 0;
+                }
+
+                if((count >= 1) && (count <= RESUME_MAX_LINES_PER_PAGE))
+                {
+                    if(options->m_ExtendedDisplayCount != DISPLAY_ALL)
+                    {
+                        options->m_ExtendedDisplayCount = count;
+                    }
+                    else
+                    {
+                        // display all option
+                        // already selected.
+                        // changes to this
+                        // option are ignored
+                    }
+                }
+                else
+                {
+                    exitCode = EXIT_EXTENDED_COUNT_INVALID;
+                    printf("Error: invalid extended count \"%s\"\n", arg);
+                }
+            }
+            else
+            {
+                exitCode = EXIT_EXTENDED_COUNT_ARG_MISSING;
+                printf("Error: extended count arg data is missing\n");
+            }
+        }
+        else
+        {
+            exitCode = EXIT_EXTENDED_COUNT_MISSING;
+            printf("Error: extended count is missing\n");
+        }
+    }
+    else
+    {
+        // not a resume option
+        exitCode = EXIT_UNKNOWN_ARG;
+    }
+
+    return exitCode;
+}
+
+/**********************************************************/
+static Result_t MainReadFile(
+    const char* path,
+    OutputBuffer_t* output)
+{
+    Result_t result = RESULT_ERROR;
+
+    // binary mode so the bytes read exactly
+    // match the file
+    FILE* file = fopen(path, "rb");
+    if(file)
+    {
+        size_t readLength;
+        do
+        {
+            // read directly into the buffer in chunks
+            // so the file size is not needed
+            readLength = 0;
+            if(OutputBufferReserve(output, OUTPUT_BUFFER_INITIAL_SIZE) == RESULT_OK)
+            {
+                readLength = fread(&output->m_OutputData[output->m_OutputLength], 1, OUTPUT_BUFFER_INITIAL_SIZE, file);
+                output->m_OutputLength += (int)readLength;
+            }
+        }
+        while(readLength == OUTPUT_BUFFER_INITIAL_SIZE);
+
+        if((ferror(file) == 0) &&
+           (OutputBufferAppend(output, "", 1) == RESULT_OK))
+        {
+            result = output->m_OutputResult;
+        }
+        else
+        {
+            // failed to read the entire file
+        }
+        fclose(file);
+    }
+    else
+    {
+        // cannot open the file
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static int MainSplitArgs(
+    char* line,
+    int lineLength,
+    char** args,
+    int argMax)
+{
+    int argCount = 0;
+    int pos = 0;
+    while(pos < lineLength)
+    {
+        if(IS_WHITESPACE(line[pos]))
+        {
+            // '\r' is also skipped here
+            pos++;
+        }
+        else if(argCount < argMax)
+        {
+            // quotes are removed by moving the rest of
+            // the arg back over them
+            int write = pos;
+            int isQuoted = 0;
+            args[argCount] = &line[pos];
+            argCount++;
+            while((pos < lineLength) && ((isQuoted) || (!IS_WHITESPACE(line[pos]))))
+            {
+                if(line[pos] == '"')
+                {
+                    isQuoted = !isQuoted;
+                }
+                else
+                {
+                    line[write] = line[pos];
+                    write++;
+                }
+                pos++;
+            }
+            line[write] = '\0';
+        }
+        else
+        {
+            // too many args
+            return INVALID_POSITION;
+        }
+    }
+
+    return argCount;
+}
+
+/**********************************************************/
+static int MainBatch(
+    const char* path,
+    const char* cachePath,
+    ResumeOptions_t* options)
+{
+    int exitCode = EXIT_OK;
+    int threadCount = options->m_ThreadCount;
+    int failedCount;
+    Batch_t batch;
+
+#if defined(RESUME_THREADS)
+    if(threadCount < 1)
+    {
+        // one thread per processor
+        long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (processorCount > RESUME_MAX_THREADS) ? RESUME_MAX_THREADS : (int)processorCount;
+    }
+#endif
+    if(threadCount < 1)
+    {
+        threadCount = 1;
+    }
+
+    BatchInit(&batch, cachePath, options);
+    if((BatchLoadManifest(&batch, path) == RESULT_ERROR) ||
+       (BatchLoadCache(&batch) == RESULT_ERROR))
+    {
+        BatchDeInit(&batch);
+        return EXIT_BATCH_MANIFEST_INVALID;
+    }
+    BatchMatchCache(&batch);
+
+    failedCount = BatchRun(&batch, threadCount);
+    if(failedCount == INVALID_POSITION)
+    {
+        exitCode = EXIT_BATCH_ERROR;
+        printf("Error: cannot start batch\n");
+    }
+    else
+    {
+        int stolenCount = 0;
+        int skippedCount = 0;
+        int skippedByTimeCount = 0;
+        int index = 0;
+        while(index < batch.m_BatchWorkerCount)
+        {
+            stolenCount += batch.m_BatchWorkers[index].m_WorkerStolen;
+            skippedCount += batch.m_BatchWorkers[index].m_WorkerSkipped;
+            skippedByTimeCount += batch.m_BatchWorkers[index].m_WorkerSkippedByTime;
+            index++;
+        }
+        printf("Rendered %d of %d resumes on %d threads. %d jobs were stolen\n",
+            (batch.m_BatchJobCount - failedCount - skippedCount),
+            batch.m_BatchJobCount,
+            batch.m_BatchWorkerCount,
+            stolenCount);
+        if(cachePath)
+        {
+            printf("Skipped %d resumes that were up to date. %d json files were not read\n",
+                skippedCount,
+                skippedByTimeCount);
+            if(BatchSaveCache(&batch) == RESULT_ERROR)
+            {
+                exitCode = EXIT_BATCH_ERROR;
+                printf("Error: failed to write batch cache \"%s\"\n", cachePath);
+            }
+        }
+        else
+        {
+            // every job was rendered
+        }
+        if(failedCount > 0)
+        {
+            exitCode = EXIT_BATCH_ERROR;
+        }
+    }
+    BatchDeInit(&batch);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static int MainBench(
+    const char* spec,
+    ResumeOptions_t* options)
+{
+    int exitCode = EXIT_OK;
+    Bench_t bench;
+
+    BenchInit(&bench, options);
+    if(BenchParseSpec(&bench, spec) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_SPEC_INVALID;
+    }
+    else if(BenchGenerate(&bench) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_ERROR;
+        printf("Error: failed to generate the benchmark resume\n");
+    }
+    else if(BenchRun(&bench) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_ERROR;
+    }
+    else
+    {
+        BenchReport(&bench);
+    }
+    BenchDeInit(&bench);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static int MainBenchJson(
+    const char* spec)
+{
+    int exitCode = EXIT_OK;
+    ResumeOptions_t options;
+    Bench_t bench;
+
+    // the resume options are not used
+    memset(&options, 0, sizeof(options));
+
+    BenchInit(&bench, &options);
+    if(BenchParseSpec(&bench, spec) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_SPEC_INVALID;
+    }
+    else if(BenchJsonRun(&bench) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_ERROR;
+    }
+    else
+    {
+        // results were printed
+    }
+    BenchDeInit(&bench);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static int MainBenchMemory(
+    const char* spec,
+    ResumeOptions_t* options)
+{
+    int exitCode = EXIT_OK;
+    int overBudget = 0;
+    Bench_t bench;
+
+    BenchInit(&bench, options);
+    if(BenchParseSpec(&bench, spec) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_SPEC_INVALID;
+    }
+    else if(BenchMemoryRun(&bench, &overBudget) == RESULT_ERROR)
+    {
+        exitCode = EXIT_BENCH_ERROR;
+    }
+    else if(overBudget > 0)
+    {
+        exitCode = EXIT_BENCH_OVER_BUDGET;
+        printf("Error: %d phases are over budget\n", overBudget);
+    }
+    else
+    {
+        printf("Every phase is within budget\n");
+    }
+    BenchDeInit(&bench);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static int MainGolden(
+    const char* directory,
+    Result_t update,
+    ResumeOptions_t* options)
+{
+    int exitCode = EXIT_OK;
+    Golden_t golden;
+
+    GoldenInit(&golden, directory, update, options);
+    if(GoldenRun(&golden) == RESULT_ERROR)
+    {
+        exitCode = EXIT_GOLDEN_ERROR;
+    }
+    else
+    {
+        printf("Checked %d outputs. %d are different, %d are missing, %d are slower, and %d were recorded\n",
+            golden.m_GoldenChecked,
+            golden.m_GoldenMismatched,
+            golden.m_GoldenMissing,
+            golden.m_GoldenSlower,
+            golden.m_GoldenRecorded);
+        if(golden.m_GoldenMismatched > 0)
+        {
+            exitCode = EXIT_GOLDEN_MISMATCH;
+        }
+        else if(golden.m_GoldenMissing > 0)
+        {
+            exitCode = EXIT_GOLDEN_MISSING;
+        }
+        else if(golden.m_GoldenSlower > 0)
+        {
+            exitCode = EXIT_GOLDEN_SLOWER;
+        }
+        else
+        {
+            // every output matches
+        }
+    }
+    GoldenDeInit(&golden);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static int64_t MainStatsBegin(
+    MainStats_t* me)
+{
+    MemoryCounters_t counters;
+    MemoryGetCounters(MEMORY_COUNT, &counters);
+    me->m_StatsAllocStart = (counters.m_CountAllocs + counters.m_CountReallocs);
+    MemoryResetPhasePeak();
+
+    return TimeNowNano();
+}
+
+/**********************************************************/
+static void MainStatsAdd(
+    MainStats_t* me,
+    StatsPhase_t phase,
+    int64_t start)
+{
+    MemoryCounters_t counters;
+    int64_t peak = MemoryGetPhasePeak();
+
+    me->m_StatsPhase[phase] += (TimeNowNano() - start);
+    MemoryGetCounters(MEMORY_COUNT, &counters);
+    me->m_StatsAllocs[phase] += ((counters.m_CountAllocs + counters.m_CountReallocs) - me->m_StatsAllocStart);
+    if(peak > me->m_StatsPeak[phase])
+    {
+        me->m_StatsPeak[phase] = peak;
+    }
+    TraceEnd(TRACE_SPAN_PHASE, g_StatsPhaseLookup[phase], 0, start);
+}
+
+/**********************************************************/
+static void MainStatsLoad(
+    LoadPhase_t phase,
+    void* userData)
+{
+    MainStats_t* me = (MainStats_t*)userData;
+
+    if(me->m_StatsLoadPhase != STATS_PHASE_COUNT)
+    {
+        MainStatsAdd(me, me->m_StatsLoadPhase, me->m_StatsLoadStart);
+    }
+    else
+    {
+        // no phase has started yet
+    }
+
+    switch(phase)
+    {
+    case LOAD_PHASE_FILL:
+    {
+        me->m_StatsLoadPhase = STATS_PHASE_FILL_HARD_CODED;
+    }
+    break;
+
+    case LOAD_PHASE_FILL_JSON:
+    {
+        me->m_StatsLoadPhase = STATS_PHASE_FILL_JSON;
+    }
+    break;
+
+    case LOAD_PHASE_ORDER:
+    {
+        me->m_StatsLoadPhase = STATS_PHASE_ORDER;
+    }
+    break;
+
+    default:
+    {
+        // the load is done
+        me->m_StatsLoadPhase = STATS_PHASE_COUNT;
+    }
+    break;
+    }
+
+    if(me->m_StatsLoadPhase != STATS_PHASE_COUNT)
+    {
+        me->m_StatsLoadStart = MainStatsBegin(me);
+    }
+    else
+    {
+        // nothing else is timed
+    }
+}
+
+/**********************************************************/
+static int MainWriteTrace(
+    const char* destination,
+    int exitCode)
+{
+    Trace_t* trace = g_Trace;
+    OutputBuffer_t output;
+
+    if(trace == NULL)
+    {
+        // no --trace
+        return exitCode;
+    }
+
+    // every thread that recorded events has stopped
+    g_Trace = NULL;
+
+    OutputBufferInit(&output);
+    if((TraceWrite(trace, &output) == RESULT_ERROR) ||
+       (MainWriteOutput(destination, &output) == RESULT_ERROR))
+    {
+        printf("Error: failed to write trace \"%s\"\n", destination);
+        if(exitCode == EXIT_OK)
+        {
+            exitCode = EXIT_TRACE_WRITE_ERROR;
+        }
+    }
+    else
+    {
+        // trace written
+    }
+    OutputBufferDeInit(&output);
+    TraceDeInit(trace);
+
+    return exitCode;
+}
+
+/**********************************************************/
+static void MainStatsPrint(
+    MainStats_t* me,
+    Resume_t* resume)
+{
+    int64_t total = 0;
+    int sectionCount = 0;
+    int phase = 0;
+    int kind;
+    int format;
+    Section_t section;
+    SectionData_t* sectionData;
+
+    fprintf(stderr, "\n");
+    fprintf(stderr, "    %-24s %12s %10s %12s\n", "phase", "ms", "allocs", "peak KB");
+    do
+    {
+        fprintf(stderr, "    %-24s %12.3f %10lld %12.1f\n",
+            g_StatsPhaseLookup[phase],
+            ((double)me->m_StatsPhase[phase] / NANO_PER_MILLI),
+            (long long)me->m_StatsAllocs[phase],
+            ((double)me->m_StatsPeak[phase] / 1024.0));
+        total += me->m_StatsPhase[phase];
+        phase++;
+    }
+    while(phase < STATS_PHASE_COUNT);
+    fprintf(stderr, "    %-24s %12.3f\n", "total", ((double)total / NANO_PER_MILLI));
+
+    fprintf(stderr, "\n");
+    fprintf(stderr, "    %-24s %8s %8s %-13s %12s\n", "section", "entries", "shown", "order", "order ms");
+    section = 0;
+    sectionData = ResumeGetSectionData(resume, section);
+    while(sectionData)
+    {
+        int displayMax = ResumeOptionsGetDisplayMax(&resume->m_ResumeOptions, sectionData);
+        int shown = sectionData->m_SectionEntries.m_EntriesUsed;
+        if((displayMax != DISPLAY_ALL) && (displayMax < shown))
+        {
+            shown = displayMax;
+        }
+        fprintf(stderr, "    %-24.24s %8d %8d %-13s %12.3f\n",
+            sectionData->m_SectionTitle,
+            sectionData->m_SectionEntries.m_EntriesUsed,
+            shown,
+            g_OrderLookup[sectionData->m_SectionOrder],
+            ((double)sectionData->m_SectionOrderNano / NANO_PER_MILLI));
+        sectionCount++;
+        section++;
+        sectionData = ResumeGetSectionData(resume, section);
+    }
+    fprintf(stderr, "    %d entries in %d sections\n",
+        resume->m_ResumeAllEntries.m_ManagedEntries.m_EntriesUsed,
+        sectionCount);
+
+    fprintf(stderr, "\n");
+    fprintf(stderr, "    %-24s %10s %10s %10s %12s %12s %12s\n", "memory", "allocs", "reallocs", "frees", "bytes KB", "live KB", "peak KB");
+    kind = 0;
+    do
+    {
+        MemoryCounters_t counters;
+        MemoryGetCounters((MemoryKind_t)kind, &counters);
+        fprintf(stderr, "    %-24s %10lld %10lld %10lld %12.1f %12.1f %12.1f\n",
+            (kind < MEMORY_COUNT) ? g_MemoryKindLookup[kind] : "total",
+            (long long)counters.m_CountAllocs,
+            (long long)counters.m_CountReallocs,
+            (long long)counters.m_CountFrees,
+            ((double)counters.m_CountBytes / 1024.0),
+            ((double)counters.m_CountLive / 1024.0),
+            ((double)counters.m_CountPeak / 1024.0));
+        kind++;
+    }
+    while(kind <= MEMORY_COUNT);
+
+    fprintf(stderr, "\n");
+    format = 0;
+    do
+    {
+        if(me->m_StatsRendered[format] > 0)
+        {
+            fprintf(stderr, "    rendered %d bytes of %s\n", me->m_StatsRendered[format], (format == FORMAT_HTML) ? "html" : "text");
+        }
+        format++;
+    }
+    while(format < FORMAT_COUNT);
+    fprintf(stderr, "    wrote %lld bytes\n", (long long)me->m_StatsWritten);
+}
+
+/**********************************************************/
+static Result_t MainGetFileInfo(
+    const char* path,
+    int64_t* size,
+    int64_t* modified)
+{
+#if defined(RESUME_STAT)
+    struct stat fileStat;
+    if(stat(path, &fileStat) == 0)
+    {
+        (*size) = (int64_t)fileStat.st_size;
+#if defined(RESUME_STAT_NANO)
+        (*modified) = ((int64_t)fileStat.st_mtim.tv_sec * NANO_PER_SECOND) + (int64_t)fileStat.st_mtim.tv_nsec;
+#else
+        (*modified) = ((int64_t)fileStat.st_mtime * NANO_PER_SECOND);
+#endif
+        return RESULT_OK;
+    }
+#else
+    PARAM_NOT_USED(path);
+    PARAM_NOT_USED(size);
+    PARAM_NOT_USED(modified);
+#endif
+
+    return RESULT_ERROR;
+}
+
+/**********************************************************/
+static int MainServeRequest(
+    char* request,
+    int requestLength,
+    ServerResponse_t* response,
+    void* userData)
+{
+    MainServe_t* serve = (MainServe_t*)userData;
+    ResumeOptions_t options = serve->m_ServeOptions;
+    SharedOutput_t* body = NULL;
+    char* args[MAIN_SERVE_MAX_ARGS];
+    int argCount;
+    int exitCode = EXIT_OK;
+    int lineLength;
+    int pos;
+    char* newline = (char*)memchr(request, '\n', requestLength);
+
+    if(newline == NULL)
+    {
+        // request is not complete yet
+        return 0;
+    }
+
+    // split the line into args in place
+    lineLength = (int)(newline - request);
+    (*newline) = '\0';
+    argCount = MainSplitArgs(request, lineLength, args, MAIN_SERVE_MAX_ARGS);
+    if(argCount == INVALID_POSITION)
+    {
+        // too many args
+        exitCode = EXIT_UNKNOWN_ARG;
+        argCount = 0;
+    }
+
+    // each request starts with the options selected
+    // when the server started
+    pos = 0;
+    while((pos < argCount) && (exitCode == EXIT_OK))
+    {
+        exitCode = MainParseResumeOption(argCount, args, &pos, &options);
+        pos++;
+    }
+
+    if(exitCode == EXIT_OK)
+    {
+        // sections were ordered once when the resume was
+        // loaded so rendering never sorts
+        Resume_t* resume = ResumeSharedRead(serve->m_ServeShared, SERVER_RESUME_READER);
+        body = RenderCacheGet(&serve->m_ServeCache, resume, &options);
+        ResumeSharedDone(serve->m_ServeShared, SERVER_RESUME_READER);
+        if(body == NULL)
+        {
+            exitCode = EXIT_OUTPUT_WRITE_ERROR;
+        }
+    }
+
+    if(exitCode == EXIT_OK)
+    {
+        // the cached render is sent by reference
+        OutputBufferPrintf(&response->m_ResponseBytes, "OK %d\n", body->m_SharedBuffer.m_OutputLength);
+        ServerResponseAttach(response, body);
+    }
+    else
+    {
+        OutputBufferPrintf(&response->m_ResponseBytes, "ERROR %d\n", exitCode);
+    }
+
+    // the line and its '\n' are used
+    return (lineLength + 1);
+}
+
+/**********************************************************/
+static int MainHttpRequest(
+    char* request,
+    int requestLength,
+    ServerResponse_t* response,
+    void* userData)
+{
+    MainServe_t* serve = (MainServe_t*)userData;
+    OutputBuffer_t* responseBytes = &response->m_ResponseBytes;
+    ResumeOptions_t options = serve->m_ServeOptions;
+    SharedOutput_t* body;
+    Resume_t* resume;
+    char* args[MAIN_SERVE_MAX_ARGS];
+    int argCount = 0;
+    int exitCode = EXIT_OK;
+    Result_t keepAlive = RESULT_NO;
+    Result_t sendBody = RESULT_YES;
+    char etag[MAIN_HTTP_ETAG_LENGTH];
+    char headers[MAIN_HTTP_HEADERS_LENGTH];
+    const char* contentType;
+    const char* value;
+    int valueLength;
+    char* target;
+    char* version;
+    char* query;
+    char* newline;
+    char* headersStart;
+    int headersLength;
+    int requestUsed = 0;
+    int pos = 0;
+
+    // the request ends at the first empty line
+    do
+    {
+        newline = (char*)memchr(&request[pos], '\n', (requestLength - pos));
+        if(newline == NULL)
+        {
+            // request is not complete yet
+            return 0;
+        }
+        pos = (int)(newline - request) + 1;
+        if((pos < requestLength) && (request[pos] == '\n'))
+        {
+            requestUsed = (pos + 1);
+        }
+        else if(((pos + 1) < requestLength) &&
+                (request[pos] == '\r') &&
+                (request[pos + 1] == '\n'))
+        {
+            requestUsed = (pos + 2);
+        }
+        else
+        {
+            // another header line
+        }
+    }
+    while(requestUsed == 0);
+
+    // split the request line into the method,
+    // target, and version in place
+    newline = (char*)memchr(request, '\n', requestUsed);
+    headersStart = (newline + 1);
+    headersLength = (int)(&request[requestUsed] - headersStart);
+    if((newline > request) && (newline[-1] == '\r'))
+    {
+        newline--;
+    }
+    (*newline) = '\0';
+    target = strchr(request, ' ');
+    version = NULL;
+    if(target)
+    {
+        (*target) = '\0';
+        target++;
+        version = strchr(target, ' ');
+        if(version)
+        {
+            (*version) = '\0';
+            version++;
+        }
+        else
+        {
+            // version is missing
+        }
+    }
+    else
+    {
+        // target is missing
+    }
+
+    if(version == NULL)
+    {
+        MainHttpWriteResponse(responseBytes, "400 Bad Request", MAIN_HTTP_TEXT_HEADER, "bad request\n", 12, RESULT_YES, RESULT_NO);
+        return INVALID_POSITION;
+    }
+
+    if(strcmp(version, "HTTP/1.1") == 0)
+    {
+        // connections stay open unless closed
+        keepAlive = RESULT_YES;
+    }
+    else if(strcmp(version, "HTTP/1.0") == 0)
+    {
+        // connections close unless kept alive
+        keepAlive = RESULT_NO;
+    }
+    else
+    {
+        MainHttpWriteResponse(responseBytes, "505 HTTP Version Not Supported", MAIN_HTTP_TEXT_HEADER, "http version not supported\n", 27, RESULT_YES, RESULT_NO);
+        return INVALID_POSITION;
+    }
+
+    valueLength = HttpFindHeader(headersStart, headersLength, "Connection", &value);
+    if(valueLength != INVALID_POSITION)
+    {
+        if(HttpListHasToken(value, valueLength, "close") == RESULT_YES)
+        {
+            keepAlive = RESULT_NO;
+        }
+        else if(HttpListHasToken(value, valueLength, "keep-alive") == RESULT_YES)
+        {
+            keepAlive = RESULT_YES;
+        }
+        else
+        {
+            // use the default of the version
+        }
+    }
+    else
+    {
+        // use the default of the version
+    }
+
+    // a request body cannot be skipped reliably so the
+    // connection is closed instead of reading the body
+    // as the next request
+    valueLength = HttpFindHeader(headersStart, headersLength, "Content-Length", &value);
+    if(((valueLength != INVALID_POSITION) && ((valueLength != 1) || (value[0] != '0'))) ||
+       (HttpFindHeader(headersStart, headersLength, "Transfer-Encoding", &value) != INVALID_POSITION))
+    {
+        MainHttpWriteResponse(responseBytes, "400 Bad Request", MAIN_HTTP_TEXT_HEADER, "request body not supported\n", 27, RESULT_YES, RESULT_NO);
+        return INVALID_POSITION;
+    }
+
+    if(strcmp(request, "HEAD") == 0)
+    {
+        // same headers as GET
+        sendBody = RESULT_NO;
+    }
+    else if(strcmp(request, "GET") != 0)
+    {
+        MainHttpWriteResponse(responseBytes, "405 Method Not Allowed", (MAIN_HTTP_TEXT_HEADER "Allow: GET, HEAD\r\n"), "method not allowed\n", 19, RESULT_YES, keepAlive);
+        return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+    }
+    else
+    {
+        // GET
+    }
+
+    query = strchr(target, '?');
+    if(query)
+    {
+        (*query) = '\0';
+        query++;
+    }
+    else
+    {
+        // no query parameters
+    }
+
+    if(strcmp(target, "/") != 0)
+    {
+        MainHttpWriteResponse(responseBytes, "404 Not Found", MAIN_HTTP_TEXT_HEADER, "not found\n", 10, sendBody, keepAlive);
+        return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+    }
+
+    // convert the query parameters into the same
+    // options used on the command line
+    while((query) && (exitCode == EXIT_OK))
+    {
+        char* name = query;
+        char* argValue = NULL;
+
+        query = strchr(query, '&');
+        if(query)
+        {
+            (*query) = '\0';
+            query++;
+        }
+        else
+        {
+            // last parameter
+        }
+
+        argValue = strchr(name, '=');
+        if(argValue)
+        {
+            (*argValue) = '\0';
+            argValue++;
+            argValue[HttpUrlDecode(argValue, (int)strlen(argValue))] = '\0';
+        }
+        else
+        {
+            // parameter without a value
+        }
+        name[HttpUrlDecode(name, (int)strlen(name))] = '\0';
+
+        if(name[0] == '\0')
+        {
+            // ignore empty parameters such as "?&"
+        }
+        else if((argCount + 2) > MAIN_SERVE_MAX_ARGS)
+        {
+            // too many parameters
+            exitCode = EXIT_UNKNOWN_ARG;
+        }
+        else if(strcmp(name, "all") == 0)
+        {
+            args[argCount] = (char*)"-a";
+            argCount++;
+        }
+        else if(argValue == NULL)
+        {
+            // every other parameter needs a value
+            exitCode = EXIT_UNKNOWN_ARG;
+        }
+        else if(strcmp(name, "format") == 0)
+        {
+            args[argCount] = (char*)"-f";
+            args[argCount + 1] = argValue;
+            argCount += 2;
+        }
+        else if(strcmp(name, "hide") == 0)
+        {
+            args[argCount] = (char*)"-H";
+            args[argCount + 1] = argValue;
+            argCount += 2;
+        }
+        else if(strcmp(name, "extend") == 0)
+        {
+            args[argCount] = (char*)"-e";
+            args[argCount + 1] = argValue;
+            argCount += 2;
+        }
+        else
+        {
+            exitCode = EXIT_UNKNOWN_ARG;
+        }
+    }
+
+    // each request starts with the options selected
+    // when the server started
+    pos = 0;
+    while((pos < argCount) && (exitCode == EXIT_OK))
+    {
+        exitCode = MainParseResumeOption(argCount, args, &pos, &options);
+        pos++;
+    }
+
+    if(exitCode != EXIT_OK)
+    {
+        MainHttpWriteResponse(responseBytes, "400 Bad Request", MAIN_HTTP_TEXT_HEADER, "invalid query parameter\n", 24, sendBody, keepAlive);
+        return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+    }
+
+    // the ETag changes whenever the rendered
+    // resume could be different
+    resume = ResumeSharedRead(serve->m_ServeShared, SERVER_RESUME_READER);
+    snprintf(
+        etag,
+        sizeof(etag),
+        "\"%08x-%08x-%08x\"",
+        serve->m_ServeSeed,
+        (unsigned int)resume->m_ResumeGeneration,
+        (unsigned int)ResumeOptionsHash(&options));
+
+    valueLength = HttpFindHeader(headersStart, headersLength, "If-None-Match", &value);
+    if((valueLength != INVALID_POSITION) &&
+       (HttpETagMatches(value, valueLength, etag) == RESULT_YES))
+    {
+        // the client already has this resume
+        ResumeSharedDone(serve->m_ServeShared, SERVER_RESUME_READER);
+        snprintf(headers, sizeof(headers), "Cache-Control: no-cache\r\nETag: %s\r\n", etag);
+        MainHttpWriteResponse(responseBytes, "304 Not Modified", headers, NULL, INVALID_POSITION, RESULT_NO, keepAlive);
+        return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+    }
+
+    // sections were ordered once when the resume was
+    // loaded so rendering never sorts
+    body = RenderCacheGet(&serve->m_ServeCache, resume, &options);
+
+    // the body belongs to the cache
+    // not the resume
+    ResumeSharedDone(serve->m_ServeShared, SERVER_RESUME_READER);
+    if(body == NULL)
+    {
+        MainHttpWriteResponse(responseBytes, "500 Internal Server Error", MAIN_HTTP_TEXT_HEADER, "render failed\n", 14, sendBody, keepAlive);
+        return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+    }
+
+    // see IMPORTANT NOTES
+    if(options.m_DisplayFormat == FORMAT_HTML)
+    {
+        contentType = "text/html; charset=ISO-8859-1";
+    }
+    else
+    {
+        contentType = "text/plain; charset=ISO-8859-1";
+    }
+    snprintf(headers, sizeof(headers), "Content-Type: %s\r\nCache-Control: no-cache\r\nETag: %s\r\n", contentType, etag);
+    MainHttpWriteResponse(
+        responseBytes,
+        "200 OK",
+        headers,
+        NULL,
+        body->m_SharedBuffer.m_OutputLength,
+        RESULT_NO,
+        keepAlive);
+    if(sendBody == RESULT_YES)
+    {
+        // the cached render is sent by reference
+        ServerResponseAttach(response, body);
+    }
+    else
+    {
+        // HEAD request
+    }
+
+    return (keepAlive == RESULT_YES) ? requestUsed : INVALID_POSITION;
+}
+
+/**********************************************************/
+static void MainHttpWriteResponse(
+    OutputBuffer_t* response,
+    const char* status,
+    const char* headers,
+    const char* body,
+    int bodyLength,
+    Result_t sendBody,
+    Result_t keepAlive)
+{
+    OutputBufferPrintf(
+        response,
+        "HTTP/1.1 %s\r\nConnection: %s\r\n%s",
+        status,
+        (keepAlive == RESULT_YES) ? "keep-alive" : "close",
+        headers);
+    if(bodyLength != INVALID_POSITION)
+    {
+        OutputBufferPrintf(response, "Content-Length: %d\r\n\r\n", bodyLength);
+        if(sendBody == RESULT_YES)
+        {
+            OutputBufferAppend(response, body, bodyLength);
+        }
+        else
+        {
+            // HEAD request
+        }
+    }
+    else
+    {
+        // no body
+        OutputBufferAppend(response, "\r\n", 2);
+    }
+}
+
+// MARK: --- MEMORY ---
+
+/**********************************************************/
+static void* MemoryAlloc(
+    MemoryKind_t kind,
+    size_t size)
+{
+    MemoryHeader_t* header = (MemoryHeader_t*)malloc(sizeof(MemoryHeader_t) + size);
+    if(header == NULL)
+    {
+        // failed to allocate memory
+        return NULL;
+    }
+    header->m_HeaderSize = (int64_t)size;
+    header->m_HeaderKind = kind;
+
+    (void)ATOMIC_FETCH_ADD(&g_Memory.m_MemoryAllocs[kind], 1);
+    (void)ATOMIC_FETCH_ADD(&g_Memory.m_MemoryBytes[kind], (int64_t)size);
+    MemoryAddLive(kind, (int64_t)size);
+
+    // the block starts after the header
+    return (header + 1);
+}
+
+/**********************************************************/
+static void* MemoryRealloc(
+    MemoryKind_t kind,
+    void* data,
+    size_t size)
+{
+    MemoryHeader_t* header;
+    int64_t previousSize;
+
+    if(data == NULL)
+    {
+        return MemoryAlloc(kind, size);
+    }
+
+    header = ((MemoryHeader_t*)data - 1);
+    previousSize = header->m_HeaderSize;
+    kind = (MemoryKind_t)header->m_HeaderKind;
+    header = (MemoryHeader_t*)realloc(header, (sizeof(MemoryHeader_t) + size));
+    if(header == NULL)
+    {
+        // failed to allocate memory.
+        // data was not changed
+        return NULL;
+    }
+    header->m_HeaderSize = (int64_t)size;
+
+    (void)ATOMIC_FETCH_ADD(&g_Memory.m_MemoryReallocs[kind], 1);
+    (void)ATOMIC_FETCH_ADD(&g_Memory.m_MemoryBytes[kind], (int64_t)size);
+    MemoryAddLive(kind, ((int64_t)size - previousSize));
+
+    return (header + 1);
+}
+
+/**********************************************************/
+static void MemoryFree(
+    void* data)
+{
+    MemoryHeader_t* header;
+    MemoryKind_t kind;
+
+    if(data == NULL)
+    {
+        // nothing to free
+        return;
+    }
+
+    header = ((MemoryHeader_t*)data - 1);
+    kind = (MemoryKind_t)header->m_HeaderKind;
+    (void)ATOMIC_FETCH_ADD(&g_Memory.m_MemoryFrees[kind], 1);
+    MemoryAddLive(kind, -header->m_HeaderSize);
+    free(header);
+}
+
+/**********************************************************/
+static void MemoryAddLive(
+    MemoryKind_t kind,
+    int64_t bytes)
+{
+    int64_t live = (ATOMIC_FETCH_ADD(&g_Memory.m_MemoryLive[kind], bytes) + bytes);
+    MemoryRaisePeak(&g_Memory.m_MemoryPeak[kind], live);
+
+    live = (ATOMIC_FETCH_ADD(&g_Memory.m_MemoryLive[MEMORY_COUNT], bytes) + bytes);
+    MemoryRaisePeak(&g_Memory.m_MemoryPeak[MEMORY_COUNT], live);
+    MemoryRaisePeak(&g_Memory.m_MemoryPhasePeak, live);
+}
+
+/**********************************************************/
+static void MemoryRaisePeak(
+    RESUME_ATOMIC(int64_t)* peak,
+    int64_t live)
+{
+    int64_t current = ATOMIC_LOAD(peak);
+    while(live > current)
+    {
+        // current is updated when another thread
+        // changed the peak first
+        if(ATOMIC_COMPARE_EXCHANGE(peak, &current, live))
+        {
+            break;
+        }
+    }
+}
+
+/**********************************************************/
+static void MemoryGetCounters(
+    MemoryKind_t kind,
+    MemoryCounters_t* counters)
+{
+    int index = kind;
+    int last = kind;
+
+    if(kind == MEMORY_COUNT)
+    {
+        // add up every kind
+        index = 0;
+        last = (MEMORY_COUNT - 1);
+    }
+
+    memset(counters, 0, sizeof(MemoryCounters_t));
+    do
+    {
+        counters->m_CountAllocs += ATOMIC_LOAD(&g_Memory.m_MemoryAllocs[index]);
+        counters->m_CountReallocs += ATOMIC_LOAD(&g_Memory.m_MemoryReallocs[index]);
+        counters->m_CountFrees += ATOMIC_LOAD(&g_Memory.m_MemoryFrees[index]);
+        counters->m_CountBytes += ATOMIC_LOAD(&g_Memory.m_MemoryBytes[index]);
+        index++;
+    }
+    while(index <= last);
+    counters->m_CountLive = ATOMIC_LOAD(&g_Memory.m_MemoryLive[kind]);
+    counters->m_CountPeak = ATOMIC_LOAD(&g_Memory.m_MemoryPeak[kind]);
+}
+
+/**********************************************************/
+static void MemoryResetPhasePeak(void)
+{
+    ATOMIC_STORE(&g_Memory.m_MemoryPhasePeak, ATOMIC_LOAD(&g_Memory.m_MemoryLive[MEMORY_COUNT]));
+}
+
+/**********************************************************/
+static int64_t MemoryGetPhasePeak(void)
+{
+    return ATOMIC_LOAD(&g_Memory.m_MemoryPhasePeak);
+}
+
+// MARK: --- STRING ---
+
+/**********************************************************/
+static Result_t SetText(
+    char** dest,
+    const char* src)
+{
+    // set the text with practically no upper bounds
+    return SetTextSubstr(dest, src, MAX_STRING_LENGTH);
+}
+
+/**********************************************************/
+static Result_t SetTextSubstr(
+    char** dest,
+    const char* src,
+    int srcLength)
+{
+    Result_t result = RESULT_OK;
+
+    if(dest)
+    {
+        unsigned long length = 0;
+
+        // remove the current text
+        if((*dest) != g_EmptyText)
+        {
+            MemoryFree((*dest));
+        }
+
+        // get the string length
+        if(src)
+        {
+            length = strlen(src);
+            if(srcLength < length)
+            {
+                length = srcLength;
+            }
+        }
+
+        if(length > 0)
+        {
+            // allocate memory for the text and null-terminater
+            // then copy the text
+            (*dest) = (char*)MemoryAlloc(MEMORY_TEXT, ((length + 1) * sizeof(char)));
+            if((*dest))
+            {
+                memcpy((*dest), src, length);
+                (*dest)[length] = '\0';
+            }
+            else
+            {
+                // failed to allocated memory
+                result = RESULT_ERROR;
+
+                // safe to use shared empty text because
+                // all functions check for this
+                (*dest) = (char*)g_EmptyText;
+            }
+        }
+        else
+        {
+            // set zero length clears the text
+
+            // safe to use shared empty text because
+            // all functions check for this
+            (*dest) = (char*)g_EmptyText;
+        }
+    }
+    else
+    {
+        // dest is invalid
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static int FindLowestSetBit(
+    unsigned int bits)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(bits);
+#else
+    int bit = 0;
+    while((bits & 1) == 0)
+    {
+        bits >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/**********************************************************/
+static int HtmlFindSpecialChar(
+    const char* text,
+    int textLength)
+{
+    int pos = 0;
+
+#if defined(RESUME_SIMD_SSE2)
+    // compare 16 characters at a time against every
+    // special character. most text has none so this
+    // loop runs at close to the speed of memcpy()
+    const __m128i lessThan    = _mm_set1_epi8('<');
+    const __m128i greaterThan = _mm_set1_epi8('>');
+    const __m128i ampersand   = _mm_set1_epi8('&');
+    const __m128i quote       = _mm_set1_epi8('"');
+    const __m128i apostrophe  = _mm_set1_epi8('\'');
+    while((pos + 16) <= textLength)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)&text[pos]);
+        __m128i match = _mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, lessThan),
+                _mm_cmpeq_epi8(chunk, greaterThan)),
+            _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(chunk, ampersand),
+                    _mm_cmpeq_epi8(chunk, quote)),
+                _mm_cmpeq_epi8(chunk, apostrophe)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(match);
+        if(mask != 0)
+        {
+            // found at least one special character
+            return (pos + FindLowestSetBit(mask));
+        }
+        pos += 16;
+    }
+#endif
+
+    // check the remaining characters one at a time
+    while(pos < textLength)
+    {
+        if(HtmlGetEntity(text[pos]))
+        {
+            return pos;
+        }
+        pos++;
+    }
+
+    return textLength;
+}
+
+/**********************************************************/
+static const char* HtmlGetEntity(
+    char c)
+{
+    const char* entity;
+
+    switch(c)
+    {
+    case '<':
+    {
+        entity = "&lt;";
+    }
+    break;
+
+    case '>':
+    {
+        entity = "&gt;";
+    }
+    break;
+
+    case '&':
+    {
+        entity = "&amp;";
+    }
+    break;
+
+    case '"':
+    {
+        entity = "&quot;";
+    }
+    break;
+
+    case '\'':
+    {
+        entity = "&#39;";
+    }
+    break;
+
+    default:
+    {
+        // not a special character
+        entity = NULL;
+    }
+    break;
+    }
+
+    return entity;
+}
+
+/**********************************************************/
+static ResumeString_t ResumeStringFind(
+    const char* text,
+    int textLength)
+{
+    ResumeString_t id;
+
+    // select the only string that could match.
+    // strings with the same length are told apart by
+    // the first character where they differ
+    switch(textLength)
+    {
+    case 4:
+    {
+        id = (text[0] == 'n') ? RESUME_STRING_ID_NAME : RESUME_STRING_ID_TEXT;
+    }
+    break;
+
+    case 5:
+    {
+        id = RESUME_STRING_ID_ORDER;
+    }
+    break;
+
+    case 6:
+    {
+        id = RESUME_STRING_ID_RANDOM;
+    }
+    break;
+
+    case 7:
+    {
+        id = RESUME_STRING_ID_ENTRIES;
+    }
+    break;
+
+    case 8:
+    {
+        id = RESUME_STRING_ID_DATE_END;
+    }
+    break;
+
+    case 10:
+    {
+        id = (text[5] == 'o') ? RESUME_STRING_ID_DATE_ORDER : RESUME_STRING_ID_DATE_START;
+    }
+    break;
+
+    case 11:
+    {
+        id = (text[1] == 'a') ? RESUME_STRING_ID_DATE_OPTION : RESUME_STRING_ID_DISPLAY_MAX;
+    }
+    break;
+
+    case 12:
+    {
+        id = (text[0] == 'n') ? RESUME_STRING_ID_NEWEST_FIRST : RESUME_STRING_ID_OLDEST_FIRST;
+    }
+    break;
+
+    case 14:
+    {
+        id = RESUME_STRING_ID_SHOW_YEAR_ONLY;
+    }
+    break;
+
+    default:
+    {
+        // no resume string has this length
+        id = RESUME_STRING_ID_UNKNOWN;
+    }
+    break;
+    }
+
+    // confirm the match. checking the null-terminator
+    // of the resume string makes sure the lengths match
+    if(id != RESUME_STRING_ID_UNKNOWN)
+    {
+        const char* resumeString = g_ResumeStringLookup[id];
+        if((memcmp(text, resumeString, textLength) != 0) ||
+           (resumeString[textLength] != '\0'))
+        {
+            // not a resume string
+            id = RESUME_STRING_ID_UNKNOWN;
+        }
+    }
+    else
+    {
+        // no resume string has this length
+    }
+
+    return id;
+}
+
+/**********************************************************/
+static Result_t StringToInt(
+    const char* text,
+    int textLength,
+    int* value,
+    int* numberLength)
+{
+    Result_t result = RESULT_OK;
+    uint64_t digits = 0;
+    int exponent = 0;
+    int isNegative = 0;
+    int isWhole = 1;
+    int isOverflow = 0;
+    int pos = 0;
+    int start;
+
+    if((pos < textLength) && (text[pos] == '-'))
+    {
+        isNegative = 1;
+        pos++;
+    }
+
+    // integer digits.
+    // at least one is required
+    start = pos;
+    while((pos < textLength) && (text[pos] >= '0') && (text[pos] <= '9'))
+    {
+        if(digits < STRING_TO_INT_DIGITS_MAX)
+        {
+            digits = (digits * 10) + (uint64_t)(text[pos] - '0');
+        }
+        else
+        {
+            // too many digits to keep.
+            // any digit still counts toward the value
+            exponent++;
+            isWhole &= (text[pos] == '0');
+        }
+        pos++;
+    }
+    if(pos == start)
+    {
+        // not a number
+        result = RESULT_ERROR;
+    }
+
+    // optional fraction
+    if((result == RESULT_OK) && (pos < textLength) && (text[pos] == '.'))
+    {
+        pos++;
+        start = pos;
+        while((pos < textLength) && (text[pos] >= '0') && (text[pos] <= '9'))
+        {
+            if(digits < STRING_TO_INT_DIGITS_MAX)
+            {
+                digits = (digits * 10) + (uint64_t)(text[pos] - '0');
+                exponent--;
+            }
+            else
+            {
+                // too many digits to keep
+                isWhole &= (text[pos] == '0');
+            }
+            pos++;
+        }
+        if(pos == start)
+        {
+            // json requires a digit after the decimal
+            result = RESULT_ERROR;
+        }
+    }
+
+    // optional exponent
+    if((result == RESULT_OK) && (pos < textLength) && ((text[pos] == 'e') || (text[pos] == 'E')))
+    {
+        int exponentValue = 0;
+        int isExponentNegative = 0;
+        pos++;
+        if((pos < textLength) && ((text[pos] == '-') || (text[pos] == '+')))
+        {
+            isExponentNegative = (text[pos] == '-');
+            pos++;
+        }
+        start = pos;
+        while((pos < textLength) && (text[pos] >= '0') && (text[pos] <= '9'))
+        {
+            if(exponentValue < STRING_TO_INT_EXPONENT_MAX)
+            {
+                exponentValue = (exponentValue * 10) + (text[pos] - '0');
+            }
+            else
+            {
+                // exponent is already too large
+                // for any int
+            }
+            pos++;
+        }
+        if(pos == start)
+        {
+            // json requires a digit in the exponent
+            result = RESULT_ERROR;
+        }
+        else if(isExponentNegative)
+        {
+            exponent -= exponentValue;
+        }
+        else
+        {
+            exponent += exponentValue;
+        }
+    }
+
+    if(result == RESULT_OK)
+    {
+        if(digits != 0)
+        {
+            uint64_t maxDigits = isNegative ? ((uint64_t)INT_MAX + 1) : (uint64_t)INT_MAX;
+
+            // remove the fraction.
+            // digits only reaches 0 after removing a
+            // digit that is not 0
+            while((exponent < 0) && (digits != 0))
+            {
+                if((digits % 10) != 0)
+                {
+                    // fraction is not 0
+                    isWhole = 0;
+                }
+                digits /= 10;
+                exponent++;
+            }
+
+            // apply the exponent
+            while((exponent > 0) && (!isOverflow))
+            {
+                if(digits <= (maxDigits / 10))
+                {
+                    digits *= 10;
+                    exponent--;
+                }
+                else
+                {
+                    // too large
+                    isOverflow = 1;
+                }
+            }
+            if(digits > maxDigits)
+            {
+                // too large
+                isOverflow = 1;
+            }
+        }
+        else
+        {
+            // 0 with any exponent is still 0.
+            // dropped digits can only follow a digit
+            // that is not 0 so isWhole is 1 here
+        }
+
+        if(isOverflow)
+        {
+            result = RESULT_WARNING;
+            if(value)
+            {
+                (*value) = isNegative ? INT_MIN : INT_MAX;
+            }
+        }
+        else if(isWhole)
+        {
+            if(value)
+            {
+                (*value) = isNegative ? (int)(0 - (int64_t)digits) : (int)digits;
+            }
+        }
+        else
+        {
+            // not a whole number
+            result = RESULT_ERROR;
+        }
+    }
+
+    if(numberLength)
+    {
+        (*numberLength) = pos;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t StringToDigits(
+    const char* text,
+    int textLength,
+    int* value,
+    int* digitCount)
+{
+    int number = 0;
+    int pos = 0;
+
+    while((pos < textLength) && (text[pos] >= '0') && (text[pos] <= '9'))
+    {
+        number = (number * 10) + (text[pos] - '0');
+        pos++;
+    }
+
+    if(digitCount)
+    {
+        (*digitCount) = pos;
+    }
+
+    if(pos == 0)
+    {
+        // not a digit
+        return RESULT_ERROR;
+    }
+
+    (*value) = number;
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static int FindUppercase(
+    const char* text,
+    int maxChars)
+{
+    int pos = 0;
+    while(pos < maxChars)
+    {
+        char current = text[pos];
+        if(current == '\0')
+        {
+            // end of string.
+            // uppercase character not found
+            return INVALID_POSITION;
+        }
+        else if(current != (char)tolower(current))
+        {
+            // current is uppercase
+            return pos;
+        }
+        pos++;
+    }
+    // finished max characters.
+    // uppercase character not found
+    return INVALID_POSITION;
+}
+
+/**********************************************************/
+static uint32_t HashFnv1a(
+    uint32_t hash,
+    const void* data,
+    int dataLength)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    int pos = 0;
+    while(pos < dataLength)
+    {
+        hash ^= bytes[pos];
+        hash *= HASH_FNV_PRIME;
+        pos++;
+    }
+
+    return hash;
+}
+
+/**********************************************************/
+static uint64_t HashFnv1a64(
+    uint64_t hash,
+    const void* data,
+    int dataLength)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    int pos = 0;
+    while(pos < dataLength)
+    {
+        hash ^= bytes[pos];
+        hash *= HASH_FNV64_PRIME;
+        pos++;
+    }
+
+    return hash;
+}
+
+// MARK: --- OUTPUT BUFFER ---
+
+/**********************************************************/
+static void OutputBufferInit(
+    OutputBuffer_t* me)
+{
+    me->m_OutputData = NULL;
+    me->m_OutputLength = 0;
+    me->m_OutputMax = 0;
+    me->m_OutputResult = RESULT_OK;
+}
+
+/**********************************************************/
+static void OutputBufferDeInit(
+    OutputBuffer_t* me)
+{
+    if(me->m_OutputData)
+    {
+        MemoryFree(me->m_OutputData);
+        me->m_OutputData = NULL;
+    }
+    me->m_OutputLength = 0;
+    me->m_OutputMax = 0;
+    me->m_OutputResult = RESULT_OK;
+}
+
+/**********************************************************/
+static void OutputBufferClear(
+    OutputBuffer_t* me)
+{
+    me->m_OutputLength = 0;
+    me->m_OutputResult = RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t OutputBufferReserve(
+    OutputBuffer_t* me,
+    int length)
+{
+    int max = me->m_OutputMax;
+
+    if((length < 0) || (length > (MAX_STRING_LENGTH - me->m_OutputLength)))
+    {
+        // the buffer cannot be this large
+        me->m_OutputResult = RESULT_ERROR;
+        return RESULT_ERROR;
+    }
+
+    if((me->m_OutputLength + length) <= max)
+    {
+        // resize not needed
+        return RESULT_OK;
+    }
+
+    // double the size until the text fits to keep the
+    // number of reallocations small for large resumes
+    if(max < OUTPUT_BUFFER_INITIAL_SIZE)
+    {
+        max = OUTPUT_BUFFER_INITIAL_SIZE;
+    }
+    while((me->m_OutputLength + length) > max)
+    {
+        if(max > (MAX_STRING_LENGTH / 2))
+        {
+            max = MAX_STRING_LENGTH;
+        }
+        else
+        {
+            max *= 2;
+        }
+    }
+
+    char* data = (char*)MemoryRealloc(MEMORY_OUTPUT, me->m_OutputData, max);
+    if(data)
+    {
+        me->m_OutputData = data;
+        me->m_OutputMax = max;
+    }
+    else
+    {
+        // failed to allocate memory
+        me->m_OutputResult = RESULT_ERROR;
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t OutputBufferAppend(
+    OutputBuffer_t* me,
+    const char* text,
+    int textLength)
+{
+    if(OutputBufferReserve(me, textLength) == RESULT_OK)
+    {
+        memcpy(&me->m_OutputData[me->m_OutputLength], text, textLength);
+        me->m_OutputLength += textLength;
+        return RESULT_OK;
+    }
+
+    // no space for the text
+    return RESULT_ERROR;
+}
+
+/**********************************************************/
+static Result_t OutputBufferAppendText(
+    OutputBuffer_t* me,
+    const char* text)
+{
+    return OutputBufferAppend(me, text, (int)strlen(text));
+}
+
+/**********************************************************/
+static Result_t OutputBufferAppendHtml(
+    OutputBuffer_t* me,
+    const char* text,
+    int textLength)
+{
+    int pos = 0;
+
+    // reserve space for the text assuming nothing
+    // needs to be escaped. entities grow the buffer
+    // as they are found
+    if(OutputBufferReserve(me, textLength) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+
+    while(pos < textLength)
+    {
+        // copy everything up to the next special
+        // character in a single append
+        int runLength = HtmlFindSpecialChar(&text[pos], (textLength - pos));
+        if(runLength > 0)
+        {
+            if(OutputBufferAppend(me, &text[pos], runLength) == RESULT_ERROR)
+            {
+                return RESULT_ERROR;
+            }
+            pos += runLength;
+        }
+
+        if(pos < textLength)
+        {
+            // replace the special character
+            if(OutputBufferAppendText(me, HtmlGetEntity(text[pos])) == RESULT_ERROR)
+            {
+                return RESULT_ERROR;
+            }
+            pos++;
+        }
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t OutputBufferPrintf(
+    OutputBuffer_t* me,
+    const char* format,
+    ...)
+{
+    Result_t result = RESULT_ERROR;
+    va_list args;
+    va_list argsCopy;
+    int length;
+
+    // try to format the text into the space that is
+    // already available before growing the buffer.
+    // a small reserve makes sure there is always space
+    // for the null-terminator written by vsnprintf()
+    if(OutputBufferReserve(me, 1) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+
+    va_start(args, format);
+    va_copy(argsCopy, args);
+    length = vsnprintf(&me->m_OutputData[me->m_OutputLength], (me->m_OutputMax - me->m_OutputLength), format, args);
+    if(length < 0)
+    {
+        // format error
+        me->m_OutputResult = RESULT_ERROR;
+    }
+    else if(length < (me->m_OutputMax - me->m_OutputLength))
+    {
+        // the text fit in the available space
+        me->m_OutputLength += length;
+        result = RESULT_OK;
+    }
+    else if(OutputBufferReserve(me, (length + 1)) == RESULT_OK)
+    {
+        // format again now that there is enough space
+        vsnprintf(&me->m_OutputData[me->m_OutputLength], (me->m_OutputMax - me->m_OutputLength), format, argsCopy);
+        me->m_OutputLength += length;
+        result = RESULT_OK;
+    }
+    else
+    {
+        // no space for the text
+    }
+    va_end(argsCopy);
+    va_end(args);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t OutputBufferWrite(
+    OutputBuffer_t* me,
+    FILE* stream)
+{
+    if(me->m_OutputLength > 0)
+    {
+        if(fwrite(me->m_OutputData, 1, me->m_OutputLength, stream) != (size_t)me->m_OutputLength)
+        {
+            // failed to write all of the text
+            return RESULT_ERROR;
+        }
+    }
+
+    if(fflush(stream) != 0)
+    {
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t OutputBufferWriteAll(
+    OutputBuffer_t* buffers,
+    int bufferCount,
+    FILE* stream)
+{
+    int index = 0;
+
+#if defined(RESUME_WRITEV)
+    struct iovec parts[OUTPUT_BUFFER_MAX_WRITE_PARTS];
+    int fd;
+
+    if(fflush(stream) != 0)
+    {
+        return RESULT_ERROR;
+    }
+    fd = fileno(stream);
+
+    while(index < bufferCount)
+    {
+        int partCount = 0;
+        int partIndex = 0;
+
+        // empty buffers are skipped
+        while((index < bufferCount) && (partCount < OUTPUT_BUFFER_MAX_WRITE_PARTS))
+        {
+            if(buffers[index].m_OutputLength > 0)
+            {
+                parts[partCount].iov_base = buffers[index].m_OutputData;
+                parts[partCount].iov_len = (size_t)buffers[index].m_OutputLength;
+                partCount++;
+            }
+            index++;
+        }
+
+        while(partIndex < partCount)
+        {
+            ssize_t written = writev(fd, &parts[partIndex], (partCount - partIndex));
+            if(written < 0)
+            {
+                if(errno != EINTR)
+                {
+                    return RESULT_ERROR;
+                }
+                written = 0;
+            }
+
+            // skip every part that was completely written
+            // then the written bytes of the next part
+            while((partIndex < partCount) && ((size_t)written >= parts[partIndex].iov_len))
+            {
+                written -= (ssize_t)parts[partIndex].iov_len;
+                partIndex++;
+            }
+            if(partIndex < partCount)
+            {
+                parts[partIndex].iov_base = ((char*)parts[partIndex].iov_base + written);
+                parts[partIndex].iov_len -= (size_t)written;
+            }
+        }
+    }
+
+    return RESULT_OK;
+#else
+    while(index < bufferCount)
+    {
+        if(OutputBufferWrite(&buffers[index], stream) == RESULT_ERROR)
+        {
+            return RESULT_ERROR;
+        }
+        index++;
+    }
+
+    return RESULT_OK;
+#endif
+}
+
+// MARK: --- SHARED OUTPUT ---
+
+/**********************************************************/
+static SharedOutput_t* SharedOutputCreate(void)
+{
+    SharedOutput_t* me = (SharedOutput_t*)MemoryAlloc(MEMORY_OUTPUT, sizeof(SharedOutput_t));
+    if(me == NULL)
+    {
+        // failed to allocate memory
+        return NULL;
+    }
+
+    OutputBufferInit(&me->m_SharedBuffer);
+    me->m_SharedReferences = 1;
+
+    return me;
+}
+
+/**********************************************************/
+static void SharedOutputRetain(
+    SharedOutput_t* me)
+{
+    me->m_SharedReferences++;
+}
+
+/**********************************************************/
+static void SharedOutputRelease(
+    SharedOutput_t* me)
+{
+    me->m_SharedReferences--;
+    if(me->m_SharedReferences == 0)
+    {
+        OutputBufferDeInit(&me->m_SharedBuffer);
+        MemoryFree(me);
+    }
+}
+
+// MARK: --- TIME AND DATE ---
+
+/** used by GetDaysInMonth() to check if the
+    year is a leap year.
+    it's always a leap year every 400 years.
+    it's also a leap year every 4 years except
+    every 100 years.
+*/
+#define IS_LEAP_YEAR(year) (((year % 400) == 0) || (((year % 4) == 0) && ((year % 100) != 0)))
+
+/**********************************************************/
+static int GetDaysInMonth(
+    int month,
+    int year)
+{
+    int days;
+
+    switch(month)
+    {
+    case MONTH_FEB:
+    {
+        if(IS_LEAP_YEAR(year))
+        {
+            days = 29;
+        }
+        else
+        {
+            days = 28;
+        }
+    }
+    break;
+
+    case MONTH_SEP: // fall-through
+    case MONTH_APR: // fall-through
+    case MONTH_JUN: // fall-through
+    case MONTH_NOV:
+    {
+        days = 30;
+    }
+    break;
+
+    default:
+    {
+        days = 31;
+    }
+    break;
+
+    }
+
+    return days;
+}
+
+/**********************************************************/
+static int TimeToDateString(
+    time_t time,
+    char* dest,
+    int destLength,
+    DateOption_t dateOption)
+{
+    int pos = 0;
+#if defined(RESUME_THREADS)
+    // sections can be rendered on several threads
+    struct tm tmData;
+    struct tm* tm = gmtime_r(&time, &tmData);
+#else
+    struct tm* tm = gmtime(&time);
+#endif
+    int year = 0;
+    int month = 0;
+    int day = 0;
+
+    if(tm)
+    {
+        year = tm->tm_year + 1900;
+        month = tm->tm_mon + 1;
+        day = tm->tm_mday;
+    }
+    else
+    {
+        // time is out of range.
+        // display it like any other invalid date
+    }
+
+    // sanity checks to prevent string
+    // format buffer overflow
+    if((year < 1900) || (year > 9999))
+    {
+        year = 0;
+    }
+    if((month < 0) || (month > 99))
+    {
+        month = 0;
+    }
+    if((day < 0) || (day > 99))
+    {
+        day = 0;
+    }
+
+    if((dateOption & DATE_OPTION_HIDE_YEAR) != DATE_OPTION_HIDE_YEAR)
+    {
+        snprintf(&dest[pos], (destLength - pos), "%04d", year);
+        pos += 4;
+    }
+
+    if((dateOption & DATE_OPTION_HIDE_MONTH) != DATE_OPTION_HIDE_MONTH)
+    {
+        if(pos > 0)
+        {
+            dest[pos] = '-';
+            pos++;
+        }
+        snprintf(&dest[pos], (destLength - pos), "%02d", month);
+        pos += 2;
+
+        if((dateOption & DATE_OPTION_HIDE_DAY) != DATE_OPTION_HIDE_DAY)
+        {
+            if(pos > 0)
+            {
+                dest[pos] = '-';
+                pos++;
+            }
+            snprintf(&dest[pos], (destLength - pos), "%02d", day);
+            pos += 2;
+        }
+    }
+    else
+    {
+        // month is hidden.
+        // it is too confusing to allow the day to be shown
+        // without the month so no additional date fields
+        // are filled here
+    }
+
+    return pos;
+}
+
+/**********************************************************/
+static Result_t TimeFromDateString(
+    time_t* time,
+    const char* date)
+{
+    Result_t result = RESULT_OK;
+
+    if(time)
+    {
+        (*time) = TIMESTAMP_UNSET;
+    }
+    else
+    {
+        // time to update is missing
+        result = RESULT_WARNING;
+    }
+
+    if(date)
+    {
+        if(date[0] != '\0')
+        {
+            struct tm tm  = { 0 };
+            int pos = 0;
+            int fieldLength;
+            int fieldsFound = 0;
+            if(StringToDigits(&date[pos], DATE_STRING_YEAR_DIGITS, &tm.tm_year, &fieldLength) == RESULT_OK)
+            {
+                pos += fieldLength;
+                if(date[pos] == DATE_STRING_SEPARATOR)
+                {
+                    pos++;
+                    if(StringToDigits(&date[pos], DATE_STRING_MONTH_DIGITS, &tm.tm_mon, &fieldLength) == RESULT_OK)
+                    {
+                        pos += fieldLength;
+                        if(date[pos] == DATE_STRING_SEPARATOR)
+                        {
+                            pos++;
+                            if(StringToDigits(&date[pos], DATE_STRING_DAY_DIGITS, &tm.tm_mday, &fieldLength) == RESULT_OK)
+                            {
+                                fieldsFound = 3;
+                            }
+                        }
+                    }
+                }
+            }
+            if(fieldsFound == 3)
+            {
+                tm.tm_mon--;
+                if((tm.tm_mon >= MONTH_JAN) &&
+                    (tm.tm_mon <= MONTH_DEC))
+                {
+                    int daysInMonth = GetDaysInMonth(tm.tm_mon, tm.tm_year);
+                    if((tm.tm_mday >= 1) &&
+                        (tm.tm_mday <= daysInMonth))
+                    {
+                        if((tm.tm_year < 1984) ||
+                            (tm.tm_year > 2084))
+                        {
+                            // I'm either in diapers or over
+                            // 100 years old.
+                            // consider this a warning :)
+                            result = RESULT_WARNING;
+                        }
+                        tm.tm_year -= 1900;
+                        if(time)
+                        {
+                            (*time) = mktime(&tm);
+                        }
+                        else
+                        {
+                            // time to update is missing
+                            result = RESULT_WARNING;
+                        }
+                    }
+                    else
+                    {
+                        // invalid day
+                        result = RESULT_ERROR;
+                    }
+                }
+                else
+                {
+                    // invalid month
+                    result = RESULT_ERROR;
+                }
+            }
+            else
+            {
+                // invalid date format
+                result = RESULT_ERROR;
+            }
+        }
+        else
+        {
+            // empty date.
+            // this is ok.
+        }
+    }
+    else
+    {
+        // no date.
+        // this is ok.
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static int64_t TimeNowNano(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    if(clock_gettime(CLOCK_MONOTONIC, &now) == 0)
+    {
+        return (((int64_t)now.tv_sec * NANO_PER_SECOND) + (int64_t)now.tv_nsec);
+    }
+#endif
+
+    // processor time is close enough for a single thread
+    return (int64_t)(((double)clock() * NANO_PER_SECOND) / CLOCKS_PER_SEC);
+}
+
+// MARK: --- ENTRIES ---
+
+/**********************************************************/
+static void EntriesInit(
+    Entries_t* me)
+{
+    me->m_Entries = NULL;
+    me->m_EntriesMax = 0;
+    me->m_EntriesUsed = 0;
+    me->m_EntriesMemory = MEMORY_SECTIONS;
+}
+
+/**********************************************************/
+static void EntriesDeInit(
+    Entries_t* me)
+{
+    if(me->m_Entries)
+    {
+        MemoryFree(me->m_Entries);
+        me->m_Entries = NULL;
+        me->m_EntriesMax = 0;
+    }
+    me->m_EntriesUsed = 0;
+}
+
+/**********************************************************/
+static Result_t EntriesResize(
+    Entries_t* me,
+    int max)
+{
+    Result_t result = RESULT_ERROR;
+
+    if(me->m_EntriesMax >= max)
+    {
+        // resize not needed
+        result =  RESULT_OK;
+    }
+    else if(max > 0)
+    {
+        Entry_t** entries = (Entry_t**)MemoryRealloc(me->m_EntriesMemory, me->m_Entries, sizeof(Entry_t*) * max);
+        if(entries)
+        {
+            me->m_Entries = entries;
+            me->m_EntriesMax = max;
+            result = RESULT_OK;
+        }
+        else
+        {
+            // error. failed to allocate memory
+        }
+    }
+    else
+    {
+        // warning. invalid max value
+        result = RESULT_WARNING;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t EntriesAppend(
+    Entries_t* me,
+    Entry_t* entry)
+{
+    Result_t result = RESULT_ERROR;
+
+    if(entry == NULL)
+    {
+        // warning. cannot append null entry
+        result = RESULT_WARNING;
+    }
+    else if(EntriesResize(me, (me->m_EntriesUsed + 1)) == RESULT_OK)
+    {
+        me->m_Entries[me->m_EntriesUsed] = entry;
+        me->m_EntriesUsed++;
+        result = RESULT_OK;
+    }
+    else
+    {
+        // error. cannot resize
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t EntriesInsertAt(
+    Entries_t* me,
+    Entry_t* entry,
+    int index)
+{
+    Result_t result = RESULT_ERROR;
+
+    if(entry == NULL)
+    {
+        // warning. cannot insert null entry
+        result = RESULT_WARNING;
+    }
+    else if((index < 0) || (index > me->m_EntriesUsed))
+    {
+        // error. cannot insert at this index
+        result = RESULT_WARNING;
+    }
+    else if(EntriesResize(me, (me->m_EntriesUsed + 1)) == RESULT_OK)
+    {
+        // shift all entries >= index before inserting the entry
+        int shiftIndex = (me->m_EntriesUsed - 1);
+        while(shiftIndex >= index)
+        {
+            me->m_Entries[shiftIndex + 1] = me->m_Entries[shiftIndex];
+            shiftIndex--;
+        }
+        me->m_Entries[index] = entry;
+        me->m_EntriesUsed++;
+        result = RESULT_OK;
+    }
+    else
+    {
+        // error. cannot resize
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t CallbackEntryIsOlder(
+    Entry_t* entry,
+    EntryTime_t entryTime,
+    void* userData)
+{
+    Entry_t* compareToEntry = (Entry_t*)userData;
+    if(compareToEntry->m_EntryTimestamp[entryTime] == TIMESTAMP_UNSET)
+    {
+        // the entry is always older when comparing
+        // against an entry with no timestamp
+        return RESULT_OK;
+    }
+    else if(entry->m_EntryTimestamp[entryTime] != TIMESTAMP_UNSET)
+    {
+        // both entries have a timestamp.
+        // check if entry is older (smaller timestamp)
+        if(entry->m_EntryTimestamp[entryTime] < compareToEntry->m_EntryTimestamp[entryTime])
+        {
+            // the entry is older
+            return RESULT_OK;
+        }
+    }
+
+    // allow search to continue
+    return RESULT_NEXT;
+}
+
+/**********************************************************/
+static Result_t CallbackEntryIsNewer(
+    Entry_t* entry,
+    EntryTime_t entryTime,
+    void* userData)
+{
+    Entry_t* compareToEntry = (Entry_t*)userData;
+    if(entry->m_EntryTimestamp[entryTime] == TIMESTAMP_UNSET)
+    {
+        // the entry is always newer when
+        // it has no timestamp
+        return RESULT_OK;
+    }
+    else if(compareToEntry->m_EntryTimestamp[entryTime] != TIMESTAMP_UNSET)
+    {
+        // both entries have a timestamp.
+        // check if entry is newer (larger timestamp)
+        if(entry->m_EntryTimestamp[entryTime] > compareToEntry->m_EntryTimestamp[entryTime])
+        {
+            // the entry is newer
+            return RESULT_OK;
+        }
+    }
+
+    // allow search to continue
+    return RESULT_NEXT;
+}
+
+/**********************************************************/
+static int EntriesFind(
+    Entries_t* me,
+    EntriesFindCallback_t findCallback,
+    EntryTime_t entryTime,
+    void* userData)
+{
+    int index = 0;
+    while(index < me->m_EntriesUsed)
+    {
+        Result_t result = findCallback(
+            me->m_Entries[index],
+            entryTime,
+            userData);
+        if(result == RESULT_OK)
+        {
+            // callback found desired entry at this index
+            return index;
+        }
+        else if(result == RESULT_ERROR)
+        {
+            // callback has canceled this search
+            break;
+        }
+        index++;
+    }
+
+    return INVALID_POSITION;
+}
+
+/**********************************************************/
+static Entry_t* EntriesTakeLast(
+    Entries_t* me)
+{
+    Entry_t* entry = NULL;
+
+    if(me->m_EntriesUsed > 0)
+    {
+        me->m_EntriesUsed--;
+        entry = me->m_Entries[me->m_EntriesUsed];
+    }
+
+    return entry;
+}
+
+// MARK: --- ENTRIES TRAVERSE ---
+
+/**********************************************************/
+static void EntriesTraverseInit(
+    EntriesTraverse_t* me)
+{
+    EntriesInit(&me->m_EntriesTraverse);
+    me->m_EntriesTraverse.m_EntriesMemory = MEMORY_TRAVERSE;
+    me->m_EntriesTraverseNumber = INVALID_POSITION;
+}
+
+/**********************************************************/
+static void EntriesTraverseDeInit(
+    EntriesTraverse_t* me)
+{
+    EntriesDeInit(&me->m_EntriesTraverse);
+    me->m_EntriesTraverseNumber = INVALID_POSITION;
+}
+
+/**********************************************************/
+static Entry_t* EntriesTraverseFirst(
+    EntriesTraverse_t* me,
+    Entries_t* entries,
+    Order_t order,
+    EntryTime_t entryTime)
+{
+    Entry_t* firstEntry = NULL;
+
+    if(entries == NULL)
+    {
+        // entries is missing
+        me->m_EntriesTraverseNumber = INVALID_POSITION;
+        return NULL;
+    }
+
+    me->m_EntriesTraverseNumber = 0;
+
+    if(entries->m_EntriesUsed > 0)
+    {
+        if(EntriesResize(&me->m_EntriesTraverse, entries->m_EntriesUsed) == RESULT_OK)
+        {
+            int entryIndex;
+            Entry_t* insertEntry;
+            EntriesFindCallback_t findCallback = NULL;
+
+            // select the callback to use for the
+            // insertion sort
+            switch(order)
+            {
+            case ORDER_RANDOM:
+            {
+                // no sorting necessary. just select
+                // random positions to insert the entries.
+                me->m_EntriesTraverse.m_EntriesUsed = 0;
+                EntriesAppend(&me->m_EntriesTraverse, entries->m_Entries[0]);
+
+                entryIndex = 1;
+                while(entryIndex < entries->m_EntriesUsed)
+                {
+                    int insertIndex = rand() % (me->m_EntriesTraverse.m_EntriesUsed + 1);
+                    insertEntry = entries->m_Entries[entryIndex];
+                    EntriesInsertAt(&me->m_EntriesTraverse, insertEntry, insertIndex);
+                    entryIndex++;
+                }
+            }
+            break;
+
+            case ORDER_OLDEST_FIRST:
+            {
+                // perform insertion sort by looking for
+                // a newer entry and inserting the older
+                // entry before it
+                findCallback = CallbackEntryIsNewer;
+            }
+            break;
+
+            case ORDER_NEWEST_FIRST: // fall-through
+            default:
+            {
+                // perform insertion sort by looking for
+                // an older entry and inserting the newer
+                // entry before it
+                findCallback = CallbackEntryIsOlder;
+            }
+            break;
+            }
+
+            if(findCallback)
+            {
+                // create the ordered entries by adding the
+                // first entry to the empty array and then
+                // continuing with a basic insertion sort
+                me->m_EntriesTraverse.m_EntriesUsed = 0;
+                EntriesAppend(&me->m_EntriesTraverse, entries->m_Entries[0]);
+
+                entryIndex = 1;
+                while(entryIndex < entries->m_EntriesUsed)
+                {
+                    int insertIndex;
+
+                    // use the find callback to select
+                    // a position in the traverse
+                    // entries array
+                    insertEntry = entries->m_Entries[entryIndex];
+                    insertIndex = EntriesFind(&me->m_EntriesTraverse, findCallback, entryTime, insertEntry);
+                    if(insertIndex != INVALID_POSITION)
+                    {
+                        // found entry at insertIndex.
+                        // place this entry before it
+                        EntriesInsertAt(&me->m_EntriesTraverse, insertEntry, insertIndex);
+                    }
+                    else
+                    {
+                        // entry can be placed at the end
+                        EntriesAppend(&me->m_EntriesTraverse, insertEntry);
+                    }
+                    entryIndex++;
+                }
+            }
+            else
+            {
+                // not using insertion sort
+            }
+
+            firstEntry = EntriesTraverseNext(me);
+        }
+        else
+        {
+            // error. failed to resize the entries
+        }
+    }
+    else
+    {
+        // no entries
+    }
+
+    return firstEntry;
+}
+
+/**********************************************************/
+static Entry_t* EntriesTraverseNext(
+    EntriesTraverse_t* me)
+{
+    Entry_t* entry = NULL;
+
+    if(me->m_EntriesTraverseNumber < 0)
+    {
+        // error. must first call EntriesTraverseFirst()
+        return NULL;
+    }
+
+    if(me->m_EntriesTraverseNumber < me->m_EntriesTraverse.m_EntriesUsed)
+    {
+        entry = me->m_EntriesTraverse.m_Entries[me->m_EntriesTraverseNumber];
+        me->m_EntriesTraverseNumber++;
+    }
+    else
+    {
+        // no more entries
+    }
+
+    return entry;
+}
+
+// MARK: --- MANAGED ENTRIES ---
+
+/**********************************************************/
+static Result_t ManagedEntriesInit(
+    ManagedEntries_t* me,
+    int max)
+{
+    EntriesInit(&me->m_ManagedEntries);
+    me->m_ManagedEntries.m_EntriesMemory = MEMORY_ENTRIES;
+    me->m_ManagedEntriesError = ENTRY_STATE_UNKNOWN;
+    return EntriesResize(&me->m_ManagedEntries, max);
+}
+
+/**********************************************************/
+static void ManagedEntriesDeInit(
+    ManagedEntries_t* me)
+{
+    ManagedEntriesClear(me);
+    EntriesDeInit(&me->m_ManagedEntries);
+}
+
+/**********************************************************/
+static void ManagedEntriesClear(
+    ManagedEntries_t* me)
+{
+    Entry_t* entry = EntriesTakeLast(&me->m_ManagedEntries);
+    while(entry)
+    {
+        entry->m_EntryReferences--;
+        if(entry->m_EntryReferences == 0)
+        {
+            EntryDeInit(entry);
+            MemoryFree(entry);
+        }
+        else
+        {
+            // still owned by another resume
+        }
+        entry = EntriesTakeLast(&me->m_ManagedEntries);
+    }
+
+    me->m_ManagedEntriesError = ENTRY_STATE_UNKNOWN;
+}
+
+/**********************************************************/
+static Entry_t* ManagedEntriesAppend(
+    ManagedEntries_t* me,
+    const char* text,
+    const char* start,
+    const char* end)
+{
+    // set the text with practically no upper bounds
+    return ManagedEntriesAppendSubstr(me, text, MAX_STRING_LENGTH, start, end);
+}
+
+/**********************************************************/
+static Entry_t* ManagedEntriesAppendSubstr(
+    ManagedEntries_t* me,
+    const char* text,
+    int textLength,
+    const char* start,
+    const char* end)
+{
+    time_t timeStart = TIMESTAMP_UNSET;
+    time_t timeEnd = TIMESTAMP_UNSET;
+    Entry_t* entry = NULL;
+
+    if(me->m_ManagedEntries.m_EntriesUsed == me->m_ManagedEntries.m_EntriesMax)
+    {
+        // no entries available
+        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_FULL;
+        return NULL;
+    }
+
+    // make sure text is valid
+    if(text)
+    {
+        if(text[0] == '\0')
+        {
+            // empty text is not allowed
+            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_TEXT_EMPTY;
+            return NULL;
+        }
+    }
+    else
+    {
+        // text is missing
+        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_TEXT_MISSING;
+        return NULL;
+    }
+
+    // make sure dates are valid
+    if(start)
+    {
+        if(TimeFromDateString(&timeStart, start) == RESULT_ERROR)
+        {
+            // start date is optional, but this date
+            // could not parsed
+            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_START_DATE;
+            return NULL;
+        }
+
+        if(end)
+        {
+            if(TimeFromDateString(&timeEnd, end) == RESULT_ERROR)
+            {
+                // end date is optional, but this date
+                // could not parsed
+                me->m_ManagedEntriesError = ENTRY_STATE_ERROR_END_DATE;
+                return NULL;
+            }
+        }
+        else
+        {
+            // no end date. this is ok
+        }
+    }
+    else
+    {
+        // no start date. this is probably ok
+        if(end)
+        {
+            // cannot have end date without start date
+            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_START_DATE_MISSING;
+            return NULL;
+        }
+    }
+
+    // create the entry and place it in the array
+    entry = (Entry_t*)MemoryAlloc(MEMORY_ENTRIES, sizeof(Entry_t));
+    if(entry)
+    {
+        EntryInit(entry);
+        if(EntrySetTextSubstr(entry, text, textLength) == RESULT_OK)
+        {
+            // save the previously parsed dates
+            entry->m_EntryTimestamp[ENTRY_TIME_START] = timeStart;
+            entry->m_EntryTimestamp[ENTRY_TIME_END] = timeEnd;
+
+            // place the entry at the end of the array.
+            // not using EntriesAppend() because managed
+            // entries array is already sized during init
+            me->m_ManagedEntries.m_Entries[me->m_ManagedEntries.m_EntriesUsed] = entry;
+            me->m_ManagedEntries.m_EntriesUsed++;
+
+            me->m_ManagedEntriesError = ENTRY_STATE_OK;
+        }
+        else
+        {
+            // could not set entry text
+            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_SET_TEXT;
+            EntryDeInit(entry);
+            MemoryFree(entry);
+            entry = NULL;
+        }
+    }
+    else
+    {
+        // could not allocate entry
+        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_ALLOC;
+    }
+
+    return entry;
+}
+
+/**********************************************************/
+static Entry_t* ManagedEntriesAppendShared(
+    ManagedEntries_t* me,
+    Entry_t* source)
+{
+    if(me->m_ManagedEntries.m_EntriesUsed == me->m_ManagedEntries.m_EntriesMax)
+    {
+        // no entries available
+        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_FULL;
+        return NULL;
+    }
+
+    // the managed entries array is already
+    // sized during init
+    source->m_EntryReferences++;
+    me->m_ManagedEntries.m_Entries[me->m_ManagedEntries.m_EntriesUsed] = source;
+    me->m_ManagedEntries.m_EntriesUsed++;
+
+    me->m_ManagedEntriesError = ENTRY_STATE_OK;
+
+    return source;
+}
+
+/**********************************************************/
+static Result_t ManagedEntriesMove(
+    ManagedEntries_t* me,
+    ManagedEntries_t* source)
+{
+    Result_t result = RESULT_OK;
+    int count = source->m_ManagedEntries.m_EntriesUsed;
+    int index = 0;
+
+    while(index < count)
+    {
+        if(me->m_ManagedEntries.m_EntriesUsed == me->m_ManagedEntries.m_EntriesMax)
+        {
+            // no entries available
+            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_FULL;
+            result = RESULT_ERROR;
+            break;
+        }
+        me->m_ManagedEntries.m_Entries[me->m_ManagedEntries.m_EntriesUsed] = source->m_ManagedEntries.m_Entries[index];
+        me->m_ManagedEntries.m_EntriesUsed++;
+        index++;
+    }
+
+    // entries that did not fit still belong to the source
+    memmove(
+        source->m_ManagedEntries.m_Entries,
+        &source->m_ManagedEntries.m_Entries[index],
+        (size_t)(count - index) * sizeof(Entry_t*));
+    source->m_ManagedEntries.m_EntriesUsed = (count - index);
+
+    return result;
+}
+
+// MARK: --- ENTRY ---
+
+/**********************************************************/
+static void EntryInit(
+    Entry_t* me)
+{
+    int index;
+    // safe to use shared empty text because
+    // all functions check for this
+    me->m_EntryText = (char*)g_EmptyText;
+    me->m_EntryReferences = 1;
+
+    index = 0;
+    do
+    {
+        me->m_EntryTimestamp[index] = TIMESTAMP_UNSET;
+        index++;
+    }
+    while(index < ENTRY_TIME_COUNT);
+}
+
+/**********************************************************/
+static void EntryDeInit(
+    Entry_t* me)
+{
+    int index;
+    SetText(&me->m_EntryText, NULL);
+
+    index = 0;
+    do
+    {
+        me->m_EntryTimestamp[index] = TIMESTAMP_UNSET;
+        index++;
+    }
+    while(index < ENTRY_TIME_COUNT);
+}
+
+/**********************************************************/
+static Result_t EntrySetText(
+    Entry_t* me,
+    const char* text)
+{
+    return SetText(&me->m_EntryText, text);
+}
+
+/**********************************************************/
+static Result_t EntrySetTextSubstr(
+    Entry_t* me,
+    const char* text,
+    int textLength)
+{
+    return SetTextSubstr(&me->m_EntryText, text, textLength);
+}
+
+/**********************************************************/
+static int EntryTimeToString(
+    Entry_t* me,
+    char* dest,
+    int destLength,
+    EntryTime_t entryTime,
+    DateOption_t dateOption)
+{
+    int pos = 0;
+    char fillChar = ' ';
+
+    if((dest == NULL) || (destLength <= 0))
+    {
+        // invalid destination
+        return 0;
+    }
+
+    if(entryTime == ENTRY_TIME_START)
+    {
+        if((dateOption & DATE_OPTION_HIDE_START) != DATE_OPTION_HIDE_START)
+        {
+            // start time selected and not hidden.
+
+            // select a fill character to make it easier
+            // to follow a line when only partial data
+            // info is displayed
+            fillChar = '.';
+
+            if(me->m_EntryTimestamp[ENTRY_TIME_START] != TIMESTAMP_UNSET)
+            {
+                // TimeToDateString() will check if both
+                // start and end are hidden.
+                // this entry is the start so force end
+                // to be hidden.
+                dateOption |= DATE_OPTION_HIDE_END;
+
+                pos += TimeToDateString(
+                    me->m_EntryTimestamp[ENTRY_TIME_START],
+                    &dest[pos],
+                    (destLength - pos),
+                    dateOption);
+            }
+            else
+            {
+                // no start time
+            }
+        }
+        else
+        {
+            // entire start date is hidden
+        }
+    }
+    else if(entryTime == ENTRY_TIME_END)
+    {
+        if((dateOption & DATE_OPTION_HIDE_END) != DATE_OPTION_HIDE_END)
+        {
+            // end time selected and not hidden.
+
+            // select a fill character to make it easier
+            // to follow a line when only partial data
+            // info is displayed
+            fillChar = '.';
+
+            if(me->m_EntryTimestamp[ENTRY_TIME_END] != TIMESTAMP_UNSET)
+            {
+                // TimeToDateString() will check if both
+                // start and end are hidden.
+                // this entry is the end so force start
+                // to be hidden.
+                dateOption |= DATE_OPTION_HIDE_START;
+
+                pos += TimeToDateString(
+                    me->m_EntryTimestamp[ENTRY_TIME_END],
+                    &dest[pos],
+                    (destLength - pos),
+                    dateOption);
+            }
+            else
+            {
+                // no end time.
+                // use "present"
+                static const char presentString[] = "present";
+                if((destLength - pos) >= ((int)sizeof(presentString) - 1))
+                {
+                    memcpy(&dest[pos], presentString, (sizeof(presentString) - 1));
+                    pos += (sizeof(presentString) - 1);
+                }
+                else
+                {
+                    // not enough space for "present"
+                }
+            }
+        }
+        else
+        {
+            // entire end date is hidden
+        }
+    }
+
+    // fill remaining length
+    memset(&dest[pos], fillChar, (destLength - pos));
+
+    return pos;
+}
+
+// MARK: --- SECTION DATA ---
+
+/**********************************************************/
+static void SectionDataInit(
+    SectionData_t* me)
+{
+    // safe to use shared empty text because
+    // all functions check for this
+    me->m_SectionTitle = (char*)g_EmptyText;
+
+    // default to display all entries from newest to oldest
+    // (descending order)
+    me->m_SectionDisplayMax = DISPLAY_ALL;
+    me->m_SectionOrder = ORDER_NEWEST_FIRST;
+    me->m_SectionOrderEntryTime = ENTRY_TIME_START;
+
+    // default to display no date information
+    me->m_SectionDateOption = DATE_OPTION_HIDE_ALL;
+
+    EntriesInit(&me->m_SectionEntries);
+    EntriesTraverseInit(&me->m_SectionOrdered);
+
+    // not filled from json yet
+    me->m_SectionFingerprint = 0;
+
+    // not ordered yet
+    me->m_SectionOrderNano = 0;
+
+    // default to no next section
+    me->m_SectionNext = NULL;
+}
+
+/**********************************************************/
+static void SectionDataDeInit( // recursive
+    SectionData_t* me)
+{
+    if(me->m_SectionNext)
+    {
+        // runtime sections are allocated by
+        // ResumeInsertSection()
+        SectionDataDeInit(me->m_SectionNext); // recursive
+        MemoryFree(me->m_SectionNext);
+        me->m_SectionNext = NULL;
+    }
+    SetText(&me->m_SectionTitle, NULL);
+    EntriesDeInit(&me->m_SectionEntries);
+    EntriesTraverseDeInit(&me->m_SectionOrdered);
+}
+
+/**********************************************************/
+static void SectionDataClear(
+    SectionData_t* me)
+{
+    // keep both entry arrays
+    Entries_t entries = me->m_SectionEntries;
+    Entries_t ordered = me->m_SectionOrdered.m_EntriesTraverse;
+
+    SetText(&me->m_SectionTitle, NULL);
+    SectionDataInit(me);
+
+    entries.m_EntriesUsed = 0;
+    ordered.m_EntriesUsed = 0;
+    me->m_SectionEntries = entries;
+    me->m_SectionOrdered.m_EntriesTraverse = ordered;
+}
+
+/**********************************************************/
+static Result_t SectionDataSetTitle(
+    SectionData_t* me,
+    const char* title)
+{
+    return SetText(&me->m_SectionTitle, title);
+}
+
+/**********************************************************/
+static Result_t SectionDataSetTitleSubstr(
+    SectionData_t* me,
+    const char* title,
+    int titleLength)
+{
+    return SetTextSubstr(&me->m_SectionTitle, title, titleLength);
+}
+
+/**********************************************************/
+static Result_t SectionDataIncludeEntry(
+    SectionData_t* me,
+    Entry_t* entry)
+{
+    // the previous order no longer includes every entry
+    me->m_SectionOrdered.m_EntriesTraverseNumber = INVALID_POSITION;
+
+    return EntriesAppend(&me->m_SectionEntries, entry);
+}
+
+/**********************************************************/
+static Entries_t* SectionDataGetOrderedEntries(
+    SectionData_t* me)
+{
+    if(me->m_SectionOrdered.m_EntriesTraverseNumber == INVALID_POSITION)
+    {
+        // not ordered yet.
+        // the traverse keeps a sorted copy of the entries
+        // so the section entries stay in the order added
+        int64_t start = TimeNowNano();
+        Entry_t* firstEntry = EntriesTraverseFirst(
+            &me->m_SectionOrdered,
+            &me->m_SectionEntries,
+            me->m_SectionOrder,
+            me->m_SectionOrderEntryTime);
+        me->m_SectionOrderNano = (TimeNowNano() - start);
+        TraceEnd(TRACE_SPAN_ORDER, me->m_SectionTitle, me->m_SectionEntries.m_EntriesUsed, start);
+        if((firstEntry == NULL) &&
+           (me->m_SectionEntries.m_EntriesUsed > 0))
+        {
+            // failed to order the entries.
+            // try again next time
+            me->m_SectionOrdered.m_EntriesTraverseNumber = INVALID_POSITION;
+            return NULL;
+        }
+    }
+
+    return &me->m_SectionOrdered.m_EntriesTraverse;
+}
+
+/**********************************************************/
+static Result_t SectionDataIncludeEntries(
+    SectionData_t* me,
+    Entry_t* entries,
+    int entryCount,
+    Result_t isOrdered)
+{
+    Result_t result = RESULT_OK;
+    int entryIndex;
+
+    if(entryCount <= 0)
+    {
+        // nothing to include
+        return RESULT_OK;
+    }
+
+    if(EntriesResize(&me->m_SectionEntries, (me->m_SectionEntries.m_EntriesUsed + entryCount)) != RESULT_OK)
+    {
+        // cannot fit the entries
+        return RESULT_ERROR;
+    }
+
+    entryIndex = 0;
+    do
+    {
+        me->m_SectionEntries.m_Entries[me->m_SectionEntries.m_EntriesUsed] = &entries[entryIndex];
+        me->m_SectionEntries.m_EntriesUsed++;
+        entryIndex++;
+    }
+    while(entryIndex < entryCount);
+
+    if((isOrdered == RESULT_YES) &&
+       (me->m_SectionEntries.m_EntriesUsed == entryCount))
+    {
+        // the display order is the order given so
+        // there is nothing to sort
+        if(EntriesResize(&me->m_SectionOrdered.m_EntriesTraverse, entryCount) == RESULT_OK)
+        {
+            memcpy(me->m_SectionOrdered.m_EntriesTraverse.m_Entries,
+                   me->m_SectionEntries.m_Entries,
+                   (sizeof(Entry_t*) * entryCount));
+            me->m_SectionOrdered.m_EntriesTraverse.m_EntriesUsed = entryCount;
+            me->m_SectionOrdered.m_EntriesTraverseNumber = 0;
+        }
+        else
+        {
+            // cannot fit the order
+            me->m_SectionOrdered.m_EntriesTraverseNumber = INVALID_POSITION;
+            result = RESULT_ERROR;
+        }
+    }
+    else
+    {
+        // sort on the next render
+        me->m_SectionOrdered.m_EntriesTraverseNumber = INVALID_POSITION;
+    }
+
+    return result;
+}
+
+// MARK: --- JSON ---
+
+/**********************************************************/
+static int JsonValueDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState)
+{
+    int length = 0;
+    char current = (*json);
+    if(current == '[')
+    {
+        length = JsonArrayDataLength(json, jsonState); // recursive
+    }
+    else if(current == '{')
+    {
+        length = JsonObjectDataLength(json, jsonState); // recursive
+    }
+    else if(current == '"')
+    {
+        length = JsonStringDataLength(json, jsonState);
+    }
+    else if((current == '-') || ((current >= '0') && (current <= '9')))
+    {
+        // decimal '.' is not checked here because 
+        // json numbers cannot have a leading decimal.
+        // see JSON_STATE_ERROR_LEADING_DECIMAL
+        length = JsonNumberDataLength(json, jsonState);
+    }
+    else if(FindUppercase(json, JSON_VALUE_KEYWORD_MAX_LENGTH) == INVALID_POSITION)
+    {
+        // check for json keywords
+        if(strncmp(json, g_JsonKeywordTrue, (sizeof(g_JsonKeywordTrue)-1)) == 0)
+        {
+            // true
+            length = (sizeof(g_JsonKeywordTrue)-1);
+        }
+        else if(strncmp(json, g_JsonKeywordFalse, (sizeof(g_JsonKeywordFalse)-1)) == 0)
+        {
+            // false
+            length = (sizeof(g_JsonKeywordFalse)-1);
+        }
+        else if(strncmp(json, g_JsonKeywordNull, (sizeof(g_JsonKeywordNull)-1)) == 0)
+        {
+            // null
+            length = (sizeof(g_JsonKeywordNull)-1);
+        }
+        else
+        {
+            // not a json keyword
+        }
+    }
+    else
+    {
+        // there are no json keywords
+        // that contain uppercase characters.
+        (*jsonState) = JSON_STATE_ERROR_VALUE_CASE;
+    }
+
+    if(length == 0)
+    {
+        (*jsonState) = JSON_STATE_ERROR_VALUE_INVALID;
+    }
+
+    return length;
+}
+
+/**********************************************************/
+static int JsonNumberDataLength(
+    const char* json,
+    JsonState_t* jsonState)
+{
+    int decimalPos = INVALID_POSITION;
+    int start = 0;
+    int pos;
+    char current;
+
+    if(json[0] == '-')
+    {
+        // negative number
+        start = 1;
+    }
+
+    pos = start;
+    current = json[pos];
+    while (current != '\0')
+    {
+        if(current == '.')
+        {
+            // found decimal point
+            if(pos > start)
+            {
+                if(decimalPos == INVALID_POSITION)
+                {
+                    decimalPos = pos;
+                }
+                else
+                {
+                    // cannot have more than one decimal point.
+                    (*jsonState) = JSON_STATE_ERROR_TOO_MANY_DECIMALS;
+                    // invalid number
+                    return 0;
+                }
+            }
+            else
+            {
+                // must have a leading number
+                (*jsonState) = JSON_STATE_ERROR_LEADING_DECIMAL;
+                return 0;
+            }
+        }
+        else if(((current == 'e') || (current == 'E')) && (pos > start))
+        {
+            // exponent ends the number
+            int exponentStart;
+            pos++;
+            current = json[pos];
+            if((current == '-') || (current == '+'))
+            {
+                pos++;
+                current = json[pos];
+            }
+            exponentStart = pos;
+            while((current >= '0') && (current <= '9'))
+            {
+                pos++;
+                current = json[pos];
+            }
+            if(pos == exponentStart)
+            {
+                // exponent digits are missing
+                (*jsonState) = JSON_STATE_ERROR_MISSING_EXPONENT;
+                return 0;
+            }
+            return pos;
+        }
+        else if((current < '0') || (current > '9'))
+        {
+            // not a number.
+            // let the caller determine if the character(s)
+            // following the number are valid.
+            break;
+        }
+        pos++;
+        current = json[pos];
+    }
+
+    if(pos == start)
+    {
+        // a '-' must be followed by a number
+        return 0;
+    }
+
+    // end of number
+    return pos;
+}
+
+/**********************************************************/
+static int JsonStringDataLength(
+    const char* json,
+    JsonState_t* jsonState)
+{
+    int pos;
+    char current;
+
+    if(json[0] != '"')
+    {
+        // quoted string must start with a quote
+        (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_START;
+        return 0;
+    }
+
+    pos = 1;
+    current = json[pos];
+    while (current != '\0')
+    {
+        if(current == '"')
+        {
+            // end of quoted string
+            return (pos + 1);
+        }
+        else if(current == '\\')
+        {
+            // escape next character
+            pos++;
+            current = json[pos];
+            if(current == '\0')
+            {
+                // missing escaped character
+                (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_ESCAPED_CHAR;
+                break;
+            }
+        }
+        pos++;
+        current = json[pos];
+    }
+
+    // end of quoted string not found
+    (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_END;
+
+    return 1;
+}
+
+/**********************************************************/
+static int JsonArrayDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState)
+{
+    int pos;
+    char current;
+
+    if(json[0] != '[')
+    {
+        // array must start with a bracket
+        (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_START;
+        return 0;
+    }
+
+    pos = 1;
+    current = json[pos];
+    while (current != '\0')
+    {
+        if(current == ']')
+        {
+            // end of array
+            return (pos + 1);
+        }
+        else
+        {
+            const char* currentPtr = &json[pos];
+            const char* skipPtr = JsonSkip(currentPtr, jsonState); // recursive
+            if(skipPtr != currentPtr)
+            {
+                pos += (int)(skipPtr - currentPtr);
+                current = json[pos];
+            }
+            else
+            {
+                // failed to skip json data.
+                // check jsonState for details.
+                // cannot find the end of the array
+                break;
+            }
+        }
+    }
+
+    // end of array not found
+    (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_END;
+
+    return 1;
+}
+
+/**********************************************************/
+static int JsonObjectDataLength( // recursive
+    const char* json,
+    JsonState_t* jsonState)
+{
+    int pos;
+    char current;
+
+    if(json[0] != '{')
+    {
+        // object must start with a brace
+        (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_START;
+        return 0;
+    }
+
+    pos = 1;
+    current = json[pos];
+    while (current != '\0')
+    {
+        if(current == '}')
+        {
+            // end of object
+            return (pos + 1);
+        }
+        else
+        {
+            const char* currentPtr = &json[pos];
+            const char* skipPtr = JsonSkip(currentPtr, jsonState); // recursive
+            if(skipPtr != currentPtr)
+            {
+                pos += (int)(skipPtr - currentPtr);
+                current = json[pos];
+            }
+            else
+            {
+                // failed to skip json data.
+                // check jsonState for details.
+                // cannot find the end of the object
+                break;
+            }
+        }
+    }
+
+    // end of object not found
+    (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_END;
+
+    return 1;
+}
+
+/**********************************************************/
+static const char* JsonSkip( // recursive
+    const char* json,
+    JsonState_t* jsonState)
+{
+    const char* ptr = json;
+    char current = (*ptr);
+    switch(current)
+    {
+        case '[':
+        {
+            // find closing ']'
+            int dataLength = JsonArrayDataLength(ptr, jsonState); // recursive
+            if(dataLength >= 2)
+            {
+                ptr += dataLength;
+                SKIP_WHITESPACE(ptr);
+                current = (*ptr);
+                // ignoring all data after the end of the array.
+                // no additional checks necessary
+            }
+            else
+            {
+                // array data length must be
+                // at least 2 characters for the
+                // start and end of the array.
+                // check jsonState for details.
+                // no change made to ptr
+            }
+        }
+        break;
+        case '{':
+        {
+            // find closing '}'
+            int dataLength = JsonObjectDataLength(ptr, jsonState); // recursive
+            if(dataLength >= 2)
+            {
+                ptr += dataLength;
+                SKIP_WHITESPACE(ptr);
+                current = (*ptr);
+                // ignoring all data after the end of the object.
+                // no additional checks necessary
+            }
+            else
+            {
+                // array data length must be
+                // at least 2 characters for the
+                // start and end of the array.
+                // check jsonState for details.
+                // no change made to ptr
+            }
+        }
+        break;
+        case '"':
+        {
+            // find closing '"'
+            int dataLength = JsonStringDataLength(ptr, jsonState);
+            if(dataLength >= 2)
+            {
+                ptr += dataLength;
+                SKIP_WHITESPACE(ptr);
+                current = (*ptr);
+                // a string is only valid when
+                // followed by a valid character
+                if((current != ',') &&
+                   (current != ']') &&
+                   (current != '}') &&
+                   (current != ':') &&
+                   (current != '\0'))
+                {
+                    // a valid character was not found
+                    (*jsonState) = JSON_STATE_ERROR_STRING_INVALID_FOLLOWER;
+                    // pretend nothing happened
+                    ptr = json;
+                }
+            }
+            else
+            {
+                // string data length must be
+                // at least 2 characters for the
+                // start and end of the quoted string.
+                // check jsonState for details.
+                // no change made to ptr
+            }
+        }
+        break;
+
+        case ':':
+        {
+            // skip the ':' and the value
+            int valueLength;
+            const char* valuePtr;
+            ptr++;
+            SKIP_WHITESPACE(ptr);
+            valueLength = JsonValueDataLength(ptr, jsonState); // recursive
+            if(valueLength > 0)
+            {
+                ptr += valueLength;
+                SKIP_WHITESPACE(ptr);
+                current = (*ptr);
+                // a value is only valid when
+                // followed by a valid character
+                if((current != ',') &&
+                    (current != ']') &&
+                    (current != '}') &&
+                    (current != '\0'))
+                {
+                    // a valid character was not found
+                    (*jsonState) = JSON_STATE_ERROR_VALUE_INVALID_FOLLOWER;
+                    // pretend nothing happened
+                    ptr = json;
+                }
+            }
+            else
+            {
+                // failed to skip the value.
+                // check jsonState for details.
+                // pretend nothing happened
+                ptr = json;
+            }
+        }
+        break;
+
+        case ',':
+        {
+            ptr++;
+            SKIP_WHITESPACE(ptr);
+            current = (*ptr);
+            // a comma is only valid when
+            // followed by a valid character
+            if(current != '{' &&
+               current != '[' &&
+               current != '"')
+            {
+                // a valid character was not found
+                (*jsonState) = JSON_STATE_ERROR_COMMA_INVALID_FOLLOWER;
+                // pretend nothing happened
+                ptr = json;
+            }
+        }
+        break;
+
+        default:
+        {
+            // whitespace or unexpected character
+            if(IS_WHITESPACE(*ptr))
+            {
+                ptr++;
+                SKIP_WHITESPACE(ptr);
+                current = (*ptr);
+            }
+            else
+            {
+                (*jsonState) = JSON_STATE_ERROR_UNEXPECTED_CHAR;
+            }
+        }
+        break;
+    }
+
+    return ptr;
+}
+
+/**********************************************************/
+static const char* JsonSkipToKeyValue( // recursive
+    const char* json,
+    const char* key,
+    JsonState_t* jsonState)
+{
+    char current;
+    SKIP_WHITESPACE(json);
+    current = (*json);
+    while((current != '\0') &&
+          (current != '}'))
+    {
+        int keyLength;
+
+        if(current == ',')
+        {
+            // there are more keys
+            json++;
+            SKIP_WHITESPACE(json);
+            current = (*json);
+        }
+        else
+        {
+            // maybe this is the first key
+        }
+
+        keyLength = JsonStringDataLength(json, jsonState);
+        if(keyLength >= 2)
+        {
+            // found a key in quotes
+            if(strncmp((json + 1), key, (keyLength - 2)) == 0)
+            {
+                // skip the key
+                json += keyLength;
+                SKIP_WHITESPACE(json);
+                current = (*json);
+                if(current == ':')
+                {
+                    json++;
+                    SKIP_WHITESPACE(json);
+                    current = (*json);
+                    // now at value
+                    break;
+                }
+                else
+                {
+                    // expected ':'
+                    (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_VALUE_START;
+                    SKIP_TO_NULL(json);
+                    break;
+                }
+            }
+            else
+            {
+                // not the correct key.
+                const char* ptr;
+
+                // skip the key and the value
+                json += keyLength;
+                SKIP_WHITESPACE(json);
+                ptr = json;
+                json = JsonSkip(ptr, jsonState);
+                if(json == ptr)
+                {
+                    // failed to skip json data.
+                    // check jsonState for details.
+                    SKIP_TO_NULL(json);
+                    break;
+                }
+                current = (*json);
+            }
+        }
+        else
+        {
+            // could not find a key
+            (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_KEY;
+            SKIP_TO_NULL(json);
+            break;
+        }
+    }
+
+    return json;
+}
+
+/**********************************************************/
+static const char* JsonSkipToNextValue( // recursive
+    const char* json,
+    const char** key,
+    int* keyLength,
+    JsonState_t* jsonState)
+{
+    char current;
+
+    (*key) = NULL;
+    (*keyLength) = 0;
+
+    SKIP_WHITESPACE(json);
+    current = (*json);
+    while((current != '\0') &&
+          (current != '}'))
+    {
+        if(current == ',')
+        {
+            // there are more keys
+            json++;
+            SKIP_WHITESPACE(json);
+            current = (*json);
+        }
+        else
+        {
+            // maybe this is the first key
+        }
+
+        (*keyLength) = JsonStringDataLength(json, jsonState);
+        if((*keyLength) >= 2)
+        {
+            // found a key in quotes
+            (*key) = json;
+
+            // skip the key
+            json += (*keyLength);
+            SKIP_WHITESPACE(json);
+            current = (*json);
+            if(current == ':')
+            {
+                json++;
+                SKIP_WHITESPACE(json);
+                current = (*json);
+                // now at value
+                break;
+            }
+            else
+            {
+                // expected ':'
+                (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_VALUE_START;
+                SKIP_TO_NULL(json);
+                break;
+            }
+        }
+        else
+        {
+            // could not find a key
+            (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_KEY;
+            SKIP_TO_NULL(json);
+            break;
+        }
+    }
+
+    return json;
+}
+
+/**********************************************************/
+static const char* JsonArrayNextIndex( // recursive
+    const char* json,
+    int* currentIndex,
+    JsonState_t* jsonState)
+{
+    char current;
+
+    SKIP_WHITESPACE(json);
+    current = (*json);
+    if((current== ']') ||
+       (current == '\0'))
+    {
+        // at end of array
+        (*currentIndex) = INVALID_POSITION;
+        return json;
+    }
+
+    // json is expected to be a non-whitespace
+    // character after a ',' or '['
+    if((*currentIndex) == INVALID_POSITION)
+    {
+        // index 0
+        (*currentIndex) = 0;
+    }
+    else
+    {
+        // find the next index.
+        const char* skipPtr = JsonSkip(json, jsonState); // recursive
+        if(skipPtr != json)
+        {
+            if((*skipPtr) == ',')
+            {
+                // found the next index
+                (*currentIndex) = (*currentIndex) + 1;
+                json = (skipPtr + 1);
+                SKIP_WHITESPACE(json);
+                current = (*json);
+            }
+            else if(((*skipPtr) == ']') ||
+                    ((*skipPtr) == '\0'))
+            {
+                // found the end of the array
+                (*currentIndex) = INVALID_POSITION;
+                json = skipPtr;
+                current = (*json);
+            }
+            else
+            {
+                // unexpected character
+                (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_NEXT_OR_END_CHAR;
+                SKIP_TO_NULL(json);
+                (*currentIndex) = INVALID_POSITION;
+            }
+        }
+        else
+        {
+            // failed to skip json data.
+            // check jsonState for details.
+            // cannot find the end of the array element
+            SKIP_TO_NULL(json);
+            (*currentIndex) = INVALID_POSITION;
+        }
+    }
+
+    return json;
+}
+
+/**********************************************************/
+static int JsonFindEscapeChar(
+    const char* json,
+    int jsonLength)
+{
+    int pos = 0;
+
+#if defined(RESUME_SIMD_SSE2)
+    // check 16 characters at a time. most strings have
+    // no escape sequences so this is usually the only
+    // loop that runs
+    const __m128i escape = _mm_set1_epi8('\\');
+    while((pos + 16) <= jsonLength)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)&json[pos]);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, escape));
+        if(mask != 0)
+        {
+            return (pos + FindLowestSetBit(mask));
+        }
+        pos += 16;
+    }
+#endif
+
+    // check the remaining characters one at a time
+    while(pos < jsonLength)
+    {
+        if(json[pos] == '\\')
+        {
+            return pos;
+        }
+        pos++;
+    }
+
+    return jsonLength;
+}
+
+/** used by JsonStringDecode() to convert a
+    hex digit to its value or -1 if invalid
+*/
+#define JSON_HEX_DIGIT_VALUE(c) \
+    ((((c) >= '0') && ((c) <= '9')) ? ((c) - '0') : \
+     (((c) >= 'a') && ((c) <= 'f')) ? ((c) - 'a' + 10) : \
+     (((c) >= 'A') && ((c) <= 'F')) ? ((c) - 'A' + 10) : -1)
+
+/**********************************************************/
+static int JsonStringDecode(
+    const char* json,
+    int jsonLength,
+    char* dest,
+    JsonState_t* jsonState)
+{
+    int pos = 0;
+    int destPos = 0;
+
+    while(pos < jsonLength)
+    {
+        // copy everything up to the next escape
+        // character in a single copy
+        int runLength = JsonFindEscapeChar(&json[pos], (jsonLength - pos));
+        memcpy(&dest[destPos], &json[pos], runLength);
+        pos += runLength;
+        destPos += runLength;
+
+        if(pos < jsonLength)
+        {
+            char current;
+
+            // skip the '\\'
+            pos++;
+            if(pos >= jsonLength)
+            {
+                // missing escaped character
+                (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_ESCAPED_CHAR;
+                return INVALID_POSITION;
+            }
+
+            current = json[pos];
+            pos++;
+            switch(current)
+            {
+            case '"':  // fall-through
+            case '\\': // fall-through
+            case '/':  dest[destPos] = current; break;
+            case 'b':  dest[destPos] = '\b';    break;
+            case 'f':  dest[destPos] = '\f';    break;
+            case 'n':  dest[destPos] = '\n';    break;
+            case 'r':  dest[destPos] = '\r';    break;
+            case 't':  dest[destPos] = '\t';    break;
+
+            case 'u':
+            {
+                int codePoint = 0;
+                int digit = 0;
+                if((pos + JSON_UNICODE_ESCAPE_DIGITS) > jsonLength)
+                {
+                    // not enough hex digits
+                    (*jsonState) = JSON_STATE_ERROR_STRING_INVALID_ESCAPE;
+                    return INVALID_POSITION;
+                }
+                do
+                {
+                    int value = JSON_HEX_DIGIT_VALUE(json[pos]);
+                    if(value < 0)
+                    {
+                        // not a hex digit
+                        (*jsonState) = JSON_STATE_ERROR_STRING_INVALID_ESCAPE;
+                        return INVALID_POSITION;
+                    }
+                    codePoint = ((codePoint << 4) | value);
+                    pos++;
+                    digit++;
+                }
+                while(digit < JSON_UNICODE_ESCAPE_DIGITS);
+
+                if((codePoint >= 0xD800) && (codePoint <= 0xDBFF) &&
+                   ((pos + 2 + JSON_UNICODE_ESCAPE_DIGITS) <= jsonLength) &&
+                   (json[pos] == '\\') && (json[pos + 1] == 'u'))
+                {
+                    // a utf-16 surrogate pair is always
+                    // outside of latin-1. skip the low
+                    // surrogate so the pair becomes a
+                    // single replacement character
+                    pos += (2 + JSON_UNICODE_ESCAPE_DIGITS);
+                }
+
+                if((codePoint > 0) && (codePoint <= 0xFF))
+                {
+                    // latin-1 matches the first 256
+                    // unicode code points
+                    dest[destPos] = (char)codePoint;
+                }
+                else
+                {
+                    // cannot be stored as latin-1 or
+                    // would end the null-terminated string
+                    dest[destPos] = JSON_UNICODE_REPLACEMENT_CHAR;
+                }
+            }
+            break;
+
+            default:
+            {
+                // this character cannot be escaped
+                (*jsonState) = JSON_STATE_ERROR_STRING_INVALID_ESCAPE;
+                return INVALID_POSITION;
+            }
+            break;
+            }
+            destPos++;
+        }
+    }
+
+    return destPos;
+}
+
+/**********************************************************/
+static Result_t JsonStringGetText(
+    const char* json,
+    int jsonLength,
+    OutputBuffer_t* scratch,
+    const char** text,
+    int* textLength,
+    JsonState_t* jsonState)
+{
+    int length;
+
+    if(jsonLength < 2)
+    {
+        // quoted string must have a start and end quote
+        (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_END;
+        return RESULT_ERROR;
+    }
+
+    // skip the quotes
+    json++;
+    length = (jsonLength - 2);
+
+    if(JsonFindEscapeChar(json, length) == length)
+    {
+        // nothing to decode.
+        // use the text in place
+        (*text) = json;
+        (*textLength) = length;
+        return RESULT_OK;
+    }
+
+    // decode into the scratch buffer including
+    // space for a null-terminator
+    OutputBufferClear(scratch);
+    if(OutputBufferReserve(scratch, (length + 1)) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+    length = JsonStringDecode(json, length, scratch->m_OutputData, jsonState);
+    if(length == INVALID_POSITION)
+    {
+        return RESULT_ERROR;
+    }
+    scratch->m_OutputData[length] = '\0';
+    scratch->m_OutputLength = length;
+
+    (*text) = scratch->m_OutputData;
+    (*textLength) = length;
+    return RESULT_OK;
+}
+
+// MARK: --- SERVER ---
+
+/**********************************************************/
+static void ServerInit(
+    Server_t* me,
+    ServerRequestCallback_t callback,
+    void* userData)
+{
+    me->m_ServerSocket = INVALID_POSITION;
+    me->m_ServerEpoll = INVALID_POSITION;
+    me->m_ServerUnixPath = NULL;
+    me->m_ServerCallback = callback;
+    me->m_ServerUserData = userData;
+    me->m_ServerConnections = NULL;
+    me->m_ServerConnectionCount = 0;
+}
+
+/**********************************************************/
+static void ServerDeInit(
+    Server_t* me)
+{
+    while(me->m_ServerConnections)
+    {
+        ServerConnectionClose(me, me->m_ServerConnections);
+    }
+
+#if defined(RESUME_SERVE)
+    if(me->m_ServerSocket != INVALID_POSITION)
+    {
+        close(me->m_ServerSocket);
+    }
+    if(me->m_ServerEpoll != INVALID_POSITION)
+    {
+        close(me->m_ServerEpoll);
+    }
+    if(me->m_ServerUnixPath)
+    {
+        unlink(me->m_ServerUnixPath);
+    }
+#endif
+
+    me->m_ServerSocket = INVALID_POSITION;
+    me->m_ServerEpoll = INVALID_POSITION;
+    me->m_ServerUnixPath = NULL;
+}
+
+/**********************************************************/
+static Result_t ServerListenUnix(
+    Server_t* me,
+    const char* path)
+{
+#if defined(RESUME_SERVE)
+    struct sockaddr_un address;
+    struct stat pathStat;
+
+    if((me->m_ServerSocket != INVALID_POSITION) ||
+       (strlen(path) >= sizeof(address.sun_path)))
+    {
+        // already listening or path is too long
+        return RESULT_ERROR;
+    }
+
+    if(stat(path, &pathStat) == 0)
+    {
+        if(S_ISSOCK(pathStat.st_mode))
+        {
+            // replace a socket left by a previous server
+            unlink(path);
+        }
+        else
+        {
+            // never remove a file that is not a socket
+            return RESULT_ERROR;
+        }
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, path, strlen(path));
+
+    me->m_ServerSocket = socket(AF_UNIX, (SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC), 0);
+    if(me->m_ServerSocket < 0)
+    {
+        me->m_ServerSocket = INVALID_POSITION;
+        return RESULT_ERROR;
+    }
+
+    if(bind(me->m_ServerSocket, (struct sockaddr*)&address, sizeof(address)) != 0)
+    {
+        // cannot create the socket file
+        return RESULT_ERROR;
+    }
+    me->m_ServerUnixPath = path;
+
+    return ServerListenStart(me);
+#else
+    PARAM_NOT_USED(me);
+    PARAM_NOT_USED(path);
+
+    // not supported on this platform
+    return RESULT_ERROR;
+#endif
+}
+
+/**********************************************************/
+static Result_t ServerListenTcp(
+    Server_t* me,
+    int port)
+{
+#if defined(RESUME_SERVE)
+    struct sockaddr_in address;
+    int reuseAddress = 1;
+
+    if((me->m_ServerSocket != INVALID_POSITION) ||
+       (port < 1) ||
+       (port > SERVER_PORT_MAX))
+    {
+        // already listening or invalid port
+        return RESULT_ERROR;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    me->m_ServerSocket = socket(AF_INET, (SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC), 0);
+    if(me->m_ServerSocket < 0)
+    {
+        me->m_ServerSocket = INVALID_POSITION;
+        return RESULT_ERROR;
+    }
+
+    // a restarted server can use the port again without
+    // waiting for old connections to time out
+    setsockopt(me->m_ServerSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    if(bind(me->m_ServerSocket, (struct sockaddr*)&address, sizeof(address)) != 0)
+    {
+        // port is in use
+        return RESULT_ERROR;
+    }
+
+    return ServerListenStart(me);
+#else
+    PARAM_NOT_USED(me);
+    PARAM_NOT_USED(port);
+
+    // not supported on this platform
+    return RESULT_ERROR;
+#endif
+}
+
+#if defined(RESUME_SERVE)
+/**********************************************************/
+static Result_t ServerListenStart(
+    Server_t* me)
+{
+    struct epoll_event event;
+
+    if(listen(me->m_ServerSocket, SERVER_LISTEN_BACKLOG) != 0)
+    {
+        return RESULT_ERROR;
+    }
+
+    me->m_ServerEpoll = epoll_create1(EPOLL_CLOEXEC);
+    if(me->m_ServerEpoll < 0)
+    {
+        me->m_ServerEpoll = INVALID_POSITION;
+        return RESULT_ERROR;
+    }
+
+    // the listening socket is the only event without
+    // a connection
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if(epoll_ctl(me->m_ServerEpoll, EPOLL_CTL_ADD, me->m_ServerSocket, &event) != 0)
+    {
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+#endif
+
+/**********************************************************/
+static Result_t ServerRun(
+    Server_t* me)
+{
+#if defined(RESUME_SERVE)
+    Result_t result = RESULT_OK;
+    struct epoll_event events[SERVER_MAX_EVENTS];
+
+    if(me->m_ServerEpoll == INVALID_POSITION)
+    {
+        // not listening
+        return RESULT_ERROR;
+    }
+
+    g_ServerStop = 0;
+    signal(SIGINT, ServerSignalStop);
+    signal(SIGTERM, ServerSignalStop);
+
+    while(g_ServerStop == 0)
+    {
+        int eventIndex;
+        int eventCount = epoll_wait(me->m_ServerEpoll, events, SERVER_MAX_EVENTS, -1);
+        if(eventCount < 0)
+        {
+            if(errno != EINTR)
+            {
+                // epoll failed
+                result = RESULT_ERROR;
+                break;
+            }
+            // interrupted by a signal.
+            // check if the server should stop
+            continue;
+        }
+
+        eventIndex = 0;
+        while(eventIndex < eventCount)
+        {
+            ServerConnection_t* connection = (ServerConnection_t*)events[eventIndex].data.ptr;
+            uint32_t eventFlags = events[eventIndex].events;
+            if(connection == NULL)
+            {
+                // new connections on the listening socket
+                ServerAccept(me);
+            }
+            else
+            {
+                Result_t connectionResult = RESULT_OK;
+                if(eventFlags & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                {
+                    connectionResult = ServerConnectionRead(me, connection);
+                }
+                if((connectionResult == RESULT_OK) && (eventFlags & EPOLLOUT))
+                {
+                    connectionResult = ServerConnectionWrite(me, connection);
+                }
+                if(connectionResult == RESULT_ERROR)
+                {
+                    ServerConnectionClose(me, connection);
+                }
+            }
+            eventIndex++;
+        }
+    }
+
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+
+    return result;
+#else
+    PARAM_NOT_USED(me);
+
+    // not supported on this platform
+    return RESULT_ERROR;
+#endif
+}
+
+#if defined(RESUME_SERVE)
+/**********************************************************/
+static void ServerAccept(
+    Server_t* me)
+{
+    do
+    {
+        ServerConnection_t* connection;
+        struct epoll_event event;
+        int connectionSocket = accept(me->m_ServerSocket, NULL, NULL);
+        if(connectionSocket < 0)
+        {
+            // no more waiting connections
+            break;
+        }
+
+        if(me->m_ServerConnectionCount >= SERVER_MAX_CONNECTIONS)
+        {
+            // too many open connections
+            close(connectionSocket);
+            continue;
+        }
+
+        if(fcntl(connectionSocket, F_SETFL, O_NONBLOCK) != 0)
+        {
+            // connection would block the server
+            close(connectionSocket);
+            continue;
+        }
+
+        connection = (ServerConnection_t*)malloc(sizeof(ServerConnection_t));
+        if(connection == NULL)
+        {
+            // failed to allocate connection
+            close(connectionSocket);
+            continue;
+        }
+
+        connection->m_ConnectionSocket = connectionSocket;
+        OutputBufferInit(&connection->m_ConnectionInput);
+        ServerResponseInit(&connection->m_ConnectionResponse);
+        connection->m_ConnectionClose = RESULT_NO;
+        connection->m_ConnectionPaused = RESULT_NO;
+        connection->m_ConnectionEvents = EPOLLIN;
+
+        // add to the start of the linked-list
+        connection->m_ConnectionPrevious = NULL;
+        connection->m_ConnectionNext = me->m_ServerConnections;
+        if(me->m_ServerConnections)
+        {
+            me->m_ServerConnections->m_ConnectionPrevious = connection;
+        }
+        me->m_ServerConnections = connection;
+        me->m_ServerConnectionCount++;
+
+        memset(&event, 0, sizeof(event));
+        event.events = connection->m_ConnectionEvents;
+        event.data.ptr = connection;
+        if(epoll_ctl(me->m_ServerEpoll, EPOLL_CTL_ADD, connectionSocket, &event) != 0)
+        {
+            // cannot wait for requests
+            ServerConnectionClose(me, connection);
+        }
+    }
+    while(1);
+}
+
+/**********************************************************/
+static Result_t ServerConnectionRead(
+    Server_t* me,
+    ServerConnection_t* connection)
+{
+    OutputBuffer_t* input = &connection->m_ConnectionInput;
+    Result_t result = RESULT_OK;
+
+    while(result == RESULT_OK)
+    {
+        ssize_t readLength;
+
+        if(connection->m_ConnectionPaused == RESULT_YES)
+        {
+            // leave the rest in the socket until
+            // ServerConnectionWrite() sends enough output
+            break;
+        }
+
+        if(OutputBufferReserve(input, SERVER_MAX_REQUEST_LENGTH) == RESULT_ERROR)
+        {
+            // failed to allocate memory
+            return RESULT_ERROR;
+        }
+
+        readLength = recv(connection->m_ConnectionSocket, &input->m_OutputData[input->m_OutputLength], SERVER_MAX_REQUEST_LENGTH, 0);
+        if(readLength == 0)
+        {
+            // closed by the client.
+            // send any response already waiting
+            ServerConnectionWrite(me, connection);
+            return RESULT_ERROR;
+        }
+        else if(readLength < 0)
+        {
+            if(errno == EINTR)
+            {
+                // try again
+                continue;
+            }
+            else if((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                // everything was read
+                break;
+            }
+            // connection failed
+            return RESULT_ERROR;
+        }
+
+        if(connection->m_ConnectionClose == RESULT_YES)
+        {
+            // ignore requests after the last one
+            continue;
+        }
+        input->m_OutputLength += (int)readLength;
+
+        if(ServerConnectionAnswer(me, connection) == RESULT_ERROR)
+        {
+            // request is too long
+            return RESULT_ERROR;
+        }
+
+        result = ServerConnectionWrite(me, connection);
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ServerConnectionAnswer(
+    Server_t* me,
+    ServerConnection_t* connection)
+{
+    OutputBuffer_t* input = &connection->m_ConnectionInput;
+    ServerResponse_t* response = &connection->m_ConnectionResponse;
+    int used = 0;
+
+    // answer every complete request
+    connection->m_ConnectionPaused = RESULT_NO;
+    while((used < input->m_OutputLength) &&
+          (connection->m_ConnectionClose == RESULT_NO))
+    {
+        int requestUsed;
+        if(ServerResponseGetPending(response) >= SERVER_MAX_PENDING_OUTPUT)
+        {
+            // wait for the client to read the responses
+            connection->m_ConnectionPaused = RESULT_YES;
+            break;
+        }
+
+        requestUsed = me->m_ServerCallback(
+            &input->m_OutputData[used],
+            (input->m_OutputLength - used),
+            response,
+            me->m_ServerUserData);
+        if(requestUsed > 0)
+        {
+            used += requestUsed;
+        }
+        else if(requestUsed == 0)
+        {
+            // wait for the rest of the request
+            break;
+        }
+        else
+        {
+            // close once the response is sent
+            connection->m_ConnectionClose = RESULT_YES;
+        }
+    }
+
+    // keep any partial request at the start
+    // of the buffer
+    if(used > 0)
+    {
+        memmove(input->m_OutputData, &input->m_OutputData[used], (input->m_OutputLength - used));
+        input->m_OutputLength -= used;
+    }
+    if((connection->m_ConnectionPaused == RESULT_NO) &&
+       (input->m_OutputLength > SERVER_MAX_REQUEST_LENGTH))
+    {
+        // request is too long
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t ServerConnectionWrite(
+    Server_t* me,
+    ServerConnection_t* connection)
+{
+    ServerResponse_t* response = &connection->m_ConnectionResponse;
+    Result_t writeWaiting;
+    uint32_t events;
+
+    do
+    {
+        writeWaiting = RESULT_NO;
+        if(ServerResponseQueueBytes(response) == RESULT_ERROR)
+        {
+            // failed to allocate memory
+            return RESULT_ERROR;
+        }
+
+        while(response->m_ResponsePartFirst < response->m_ResponsePartCount)
+        {
+            // every part is sent with a single call so
+            // a shared render is never copied
+            struct iovec parts[SERVER_MAX_WRITE_PARTS];
+            struct msghdr message;
+            ssize_t sentLength;
+            int partIndex = response->m_ResponsePartFirst;
+            int partCount = 0;
+            int partSent = response->m_ResponsePartSent;
+
+            while((partIndex < response->m_ResponsePartCount) && (partCount < SERVER_MAX_WRITE_PARTS))
+            {
+                ServerPart_t* part = &response->m_ResponseParts[partIndex];
+                const char* data = (part->m_PartShared) ?
+                    part->m_PartShared->m_SharedBuffer.m_OutputData :
+                    &response->m_ResponseBytes.m_OutputData[part->m_PartOffset];
+                parts[partCount].iov_base = (void*)&data[partSent];
+                parts[partCount].iov_len = (size_t)(part->m_PartLength - partSent);
+                partSent = 0;
+                partCount++;
+                partIndex++;
+            }
+
+            // sendmsg() is writev() for a socket. MSG_NOSIGNAL
+            // so a closed client does not stop the server
+            // with SIGPIPE
+            memset(&message, 0, sizeof(message));
+            message.msg_iov = parts;
+            message.msg_iovlen = (size_t)partCount;
+            sentLength = sendmsg(connection->m_ConnectionSocket, &message, MSG_NOSIGNAL);
+            if(sentLength >= 0)
+            {
+                ServerResponseSent(response, (int)sentLength);
+            }
+            else if(errno == EINTR)
+            {
+                // try again
+            }
+            else if((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                // socket is full
+                writeWaiting = RESULT_YES;
+                break;
+            }
+            else
+            {
+                // connection failed
+                return RESULT_ERROR;
+            }
+        }
+
+        if(writeWaiting == RESULT_NO)
+        {
+            // everything was sent
+            ServerResponseClear(response);
+            if(connection->m_ConnectionClose == RESULT_YES)
+            {
+                return RESULT_ERROR;
+            }
+        }
+
+        if((connection->m_ConnectionPaused == RESULT_NO) ||
+           (ServerResponseGetPending(response) >= SERVER_MAX_PENDING_OUTPUT))
+        {
+            // no requests can be answered yet
+            break;
+        }
+
+        // enough output was sent to answer the
+        // requests that were waiting
+        if(ServerConnectionAnswer(me, connection) == RESULT_ERROR)
+        {
+            // request is too long
+            return RESULT_ERROR;
+        }
+    }
+    while(1);
+
+    // only wait for the socket to accept more output
+    // while there is output waiting and only wait for
+    // more requests while the connection is not paused
+    events = 0;
+    if(writeWaiting == RESULT_YES)
+    {
+        events |= EPOLLOUT;
+    }
+    if(connection->m_ConnectionPaused == RESULT_NO)
+    {
+        events |= EPOLLIN;
+    }
+    if(events != connection->m_ConnectionEvents)
+    {
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = events;
+        event.data.ptr = connection;
+        if(epoll_ctl(me->m_ServerEpoll, EPOLL_CTL_MOD, connection->m_ConnectionSocket, &event) != 0)
+        {
+            return RESULT_ERROR;
+        }
+        connection->m_ConnectionEvents = events;
+    }
+
+    return RESULT_OK;
+}
+#endif
+
+/**********************************************************/
+static void ServerConnectionClose(
+    Server_t* me,
+    ServerConnection_t* connection)
+{
+    // remove from the linked-list
+    if(connection->m_ConnectionPrevious)
+    {
+        connection->m_ConnectionPrevious->m_ConnectionNext = connection->m_ConnectionNext;
+    }
+    else
+    {
+        me->m_ServerConnections = connection->m_ConnectionNext;
+    }
+    if(connection->m_ConnectionNext)
+    {
+        connection->m_ConnectionNext->m_ConnectionPrevious = connection->m_ConnectionPrevious;
+    }
+    me->m_ServerConnectionCount--;
+
+#if defined(RESUME_SERVE)
+    // closing the socket also removes it from epoll
+    close(connection->m_ConnectionSocket);
+#endif
+
+    OutputBufferDeInit(&connection->m_ConnectionInput);
+    ServerResponseDeInit(&connection->m_ConnectionResponse);
+    free(connection);
+}
+
+#if defined(RESUME_SERVE)
+/**********************************************************/
+static void ServerResponseInit(
+    ServerResponse_t* me)
+{
+    OutputBufferInit(&me->m_ResponseBytes);
+    me->m_ResponseParts = NULL;
+    me->m_ResponsePartCount = 0;
+    me->m_ResponsePartMax = 0;
+    me->m_ResponsePartFirst = 0;
+    me->m_ResponsePartSent = 0;
+    me->m_ResponseBytesQueued = 0;
+    me->m_ResponsePending = 0;
+}
+#endif
+
+/**********************************************************/
+static void ServerResponseDeInit(
+    ServerResponse_t* me)
+{
+    ServerResponseClear(me);
+    OutputBufferDeInit(&me->m_ResponseBytes);
+    if(me->m_ResponseParts)
+    {
+        MemoryFree(me->m_ResponseParts);
+        me->m_ResponseParts = NULL;
+    }
+    me->m_ResponsePartMax = 0;
+}
+
+/**********************************************************/
+static void ServerResponseClear(
+    ServerResponse_t* me)
+{
+    // parts that were not sent still own their output
+    int partIndex = me->m_ResponsePartFirst;
+    while(partIndex < me->m_ResponsePartCount)
+    {
+        if(me->m_ResponseParts[partIndex].m_PartShared)
+        {
+            SharedOutputRelease(me->m_ResponseParts[partIndex].m_PartShared);
+        }
+        partIndex++;
+    }
+
+    OutputBufferClear(&me->m_ResponseBytes);
+    me->m_ResponsePartCount = 0;
+    me->m_ResponsePartFirst = 0;
+    me->m_ResponsePartSent = 0;
+    me->m_ResponseBytesQueued = 0;
+    me->m_ResponsePending = 0;
+}
+
+/**********************************************************/
+static Result_t ServerResponseAttach(
+    ServerResponse_t* me,
+    SharedOutput_t* shared)
+{
+    if(ServerResponseQueueBytes(me) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+    if(shared->m_SharedBuffer.m_OutputLength == 0)
+    {
+        // nothing to send
+        return RESULT_OK;
+    }
+    if(ServerResponseAddPart(me, shared, 0, shared->m_SharedBuffer.m_OutputLength) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+    SharedOutputRetain(shared);
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t ServerResponseQueueBytes(
+    ServerResponse_t* me)
+{
+    int length = (me->m_ResponseBytes.m_OutputLength - me->m_ResponseBytesQueued);
+    if(me->m_ResponseBytes.m_OutputResult == RESULT_ERROR)
+    {
+        // a response is missing bytes
+        return RESULT_ERROR;
+    }
+    if(length == 0)
+    {
+        // every byte is in a part
+        return RESULT_OK;
+    }
+    if(ServerResponseAddPart(me, NULL, me->m_ResponseBytesQueued, length) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+    me->m_ResponseBytesQueued += length;
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t ServerResponseAddPart(
+    ServerResponse_t* me,
+    SharedOutput_t* shared,
+    int offset,
+    int length)
+{
+    ServerPart_t* part;
+
+    if(me->m_ResponsePartCount == me->m_ResponsePartMax)
+    {
+        int partMax = (me->m_ResponsePartMax + SERVER_RESPONSE_PARTS_GROW);
+        ServerPart_t* parts = (ServerPart_t*)MemoryRealloc(MEMORY_OUTPUT, me->m_ResponseParts, ((size_t)partMax * sizeof(ServerPart_t)));
+        if(parts == NULL)
+        {
+            // failed to allocate memory
+            return RESULT_ERROR;
+        }
+        me->m_ResponseParts = parts;
+        me->m_ResponsePartMax = partMax;
+    }
+
+    part = &me->m_ResponseParts[me->m_ResponsePartCount];
+    part->m_PartShared = shared;
+    part->m_PartOffset = offset;
+    part->m_PartLength = length;
+    me->m_ResponsePartCount++;
+    me->m_ResponsePending += length;
+
+    return RESULT_OK;
+}
+
+#if defined(RESUME_SERVE)
+/**********************************************************/
+static int ServerResponseGetPending(
+    ServerResponse_t* me)
+{
+    // bytes not in a part yet are waiting too
+    return me->m_ResponsePending + (me->m_ResponseBytes.m_OutputLength - me->m_ResponseBytesQueued);
+}
+
+/**********************************************************/
+static void ServerResponseSent(
+    ServerResponse_t* me,
+    int sentLength)
+{
+    me->m_ResponsePending -= sentLength;
+    sentLength += me->m_ResponsePartSent;
+    while((me->m_ResponsePartFirst < me->m_ResponsePartCount) &&
+          (sentLength >= me->m_ResponseParts[me->m_ResponsePartFirst].m_PartLength))
+    {
+        ServerPart_t* part = &me->m_ResponseParts[me->m_ResponsePartFirst];
+        sentLength -= part->m_PartLength;
+        if(part->m_PartShared)
+        {
+            SharedOutputRelease(part->m_PartShared);
+            part->m_PartShared = NULL;
+        }
+        me->m_ResponsePartFirst++;
+    }
+    me->m_ResponsePartSent = sentLength;
+}
+#endif
+
+#if defined(RESUME_SERVE)
+/**********************************************************/
+static void ServerSignalStop(
+    int signalNumber)
+{
+    PARAM_NOT_USED(signalNumber);
+    g_ServerStop = 1;
+}
+#endif
+
+// MARK: --- HTTP ---
+
+/**********************************************************/
+static int HttpFindHeader(
+    const char* headers,
+    int headersLength,
+    const char* name,
+    const char** value)
+{
+    int nameLength = (int)strlen(name);
+    int pos = 0;
+    while(pos < headersLength)
+    {
+        const char* line = &headers[pos];
+        const char* lineEnd = (const char*)memchr(line, '\n', (headersLength - pos));
+        int lineLength = (lineEnd) ? (int)(lineEnd - line) : (headersLength - pos);
+
+        if((lineLength > nameLength) && (line[nameLength] == ':'))
+        {
+            int index = 0;
+            while((index < nameLength) &&
+                  (tolower((unsigned char)line[index]) == tolower((unsigned char)name[index])))
+            {
+                index++;
+            }
+
+            if(index == nameLength)
+            {
+                // skip the ':' and trim whitespace
+                // including the '\r'
+                int valueStart = (nameLength + 1);
+                while((valueStart < lineLength) && (IS_WHITESPACE(line[valueStart])))
+                {
+                    valueStart++;
+                }
+                while((lineLength > valueStart) && (IS_WHITESPACE(line[lineLength - 1])))
+                {
+                    lineLength--;
+                }
+                (*value) = &line[valueStart];
+                return (lineLength - valueStart);
+            }
+            else
+            {
+                // different header
+            }
+        }
+        else
+        {
+            // different header
+        }
+        pos += (lineLength + 1);
+    }
+
+    return INVALID_POSITION;
+}
+
+/**********************************************************/
+static Result_t HttpListHasToken(
+    const char* list,
+    int listLength,
+    const char* token)
+{
+    int tokenLength = (int)strlen(token);
+    int pos = 0;
+    while(pos < listLength)
+    {
+        int itemStart;
+        int itemEnd;
+
+        while((pos < listLength) && (IS_WHITESPACE(list[pos])))
+        {
+            pos++;
+        }
+        itemStart = pos;
+        while((pos < listLength) && (list[pos] != ','))
+        {
+            pos++;
+        }
+        itemEnd = pos;
+        while((itemEnd > itemStart) && (IS_WHITESPACE(list[itemEnd - 1])))
+        {
+            itemEnd--;
+        }
+
+        if((itemEnd - itemStart) == tokenLength)
+        {
+            int index = 0;
+            while((index < tokenLength) &&
+                  (tolower((unsigned char)list[itemStart + index]) == tolower((unsigned char)token[index])))
+            {
+                index++;
+            }
+            if(index == tokenLength)
+            {
+                return RESULT_YES;
+            }
+            else
+            {
+                // different token
+            }
+        }
+        else
+        {
+            // different token
+        }
+
+        // skip the ','
+        pos++;
+    }
+
+    return RESULT_NO;
+}
+
+/**********************************************************/
+static Result_t HttpETagMatches(
+    const char* list,
+    int listLength,
+    const char* etag)
+{
+    int etagLength = (int)strlen(etag);
+    int pos = 0;
+    while(pos < listLength)
+    {
+        int itemStart;
+        int itemEnd;
+
+        while((pos < listLength) && ((IS_WHITESPACE(list[pos])) || (list[pos] == ',')))
+        {
+            pos++;
+        }
+        if(((pos + 2) < listLength) && (list[pos] == 'W') && (list[pos + 1] == '/'))
+        {
+            // compare weak ETags as if they were strong
+            pos += 2;
+        }
+        else
+        {
+            // strong ETag or "*"
+        }
+
+        // ETags are quoted and may contain ','
+        itemStart = pos;
+        if((pos < listLength) && (list[pos] == '"'))
+        {
+            pos++;
+            while((pos < listLength) && (list[pos] != '"'))
+            {
+                pos++;
+            }
+            if(pos < listLength)
+            {
+                // include the closing quote
+                pos++;
+            }
+            else
+            {
+                // missing closing quote
+            }
+        }
+        else
+        {
+            while((pos < listLength) && (list[pos] != ',') && (!IS_WHITESPACE(list[pos])))
+            {
+                pos++;
+            }
+        }
+        itemEnd = pos;
+
+        if(((itemEnd - itemStart) == 1) && (list[itemStart] == '*'))
+        {
+            // matches any ETag
+            return RESULT_YES;
+        }
+        else if(((itemEnd - itemStart) == etagLength) &&
+                (memcmp(&list[itemStart], etag, etagLength) == 0))
+        {
+            return RESULT_YES;
+        }
+        else
+        {
+            // different ETag
+        }
+    }
+
+    return RESULT_NO;
+}
+
+/**********************************************************/
+static int HttpUrlDecode(
+    char* text,
+    int textLength)
+{
+    int readPos = 0;
+    int writePos = 0;
+    while(readPos < textLength)
+    {
+        char current = text[readPos];
+        if(current == '+')
+        {
+            current = ' ';
+        }
+        else if((current == '%') && ((readPos + 2) < textLength))
+        {
+            int decoded = 0;
+            int index = 1;
+            do
+            {
+                char digit = text[readPos + index];
+                char lower = (char)tolower((unsigned char)digit);
+                if((digit >= '0') && (digit <= '9'))
+                {
+                    decoded = (decoded * 16) + (digit - '0');
+                }
+                else if((lower >= 'a') && (lower <= 'f'))
+                {
+                    decoded = (decoded * 16) + (lower - 'a' + 10);
+                }
+                else
+                {
+                    // not an escape
+                    decoded = INVALID_POSITION;
+                    break;
+                }
+                index++;
+            }
+            while(index <= 2);
+
+            if(decoded != INVALID_POSITION)
+            {
+                current = (char)decoded;
+                readPos += 2;
+            }
+            else
+            {
+                // keep the '%'
+            }
+        }
+        else
+        {
+            // not encoded
+        }
+        text[writePos] = current;
+        writePos++;
+        readPos++;
+    }
+
+    return writePos;
+}
+
+// MARK: --- SNAPSHOT ---
+
+/**********************************************************/
+static void SnapshotInit(
+    Snapshot_t* me)
+{
+    me->m_SnapshotData = NULL;
+    me->m_SnapshotSize = 0;
+    me->m_SnapshotIsMapped = RESULT_NO;
+}
+
+/**********************************************************/
+static Result_t SnapshotOpen(
+    Snapshot_t* me,
+    const char* path)
+{
+    Result_t result = RESULT_ERROR;
+
+#if defined(RESUME_MMAP)
+    int fd = open(path, O_RDONLY);
+    if(fd >= 0)
+    {
+        struct stat fileStat;
+        if((fstat(fd, &fileStat) == 0) &&
+           (fileStat.st_size >= (off_t)sizeof(SnapshotHeader_t)) &&
+           (fileStat.st_size <= MAX_STRING_LENGTH))
+        {
+            void* data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(data != MAP_FAILED)
+            {
+                me->m_SnapshotData = (const char*)data;
+                me->m_SnapshotSize = (int)fileStat.st_size;
+                me->m_SnapshotIsMapped = RESULT_YES;
+                result = RESULT_OK;
+            }
+            else
+            {
+                // cannot map the file
+            }
+        }
+        else
+        {
+            // not a snapshot or too large
+        }
+
+        // the mapping stays valid after the file is closed
+        close(fd);
+    }
+    else
+    {
+        // cannot open the file
+    }
+#else
+    FILE* file = fopen(path, "rb");
+    if(file)
+    {
+        long fileSize = -1;
+        if(fseek(file, 0, SEEK_END) == 0)
+        {
+            fileSize = ftell(file);
+        }
+
+        if((fileSize >= (long)sizeof(SnapshotHeader_t)) &&
+           (fileSize <= MAX_STRING_LENGTH) &&
+           (fseek(file, 0, SEEK_SET) == 0))
+        {
+            char* data = (char*)malloc((size_t)fileSize);
+            if(data)
+            {
+                if(fread(data, 1, (size_t)fileSize, file) == (size_t)fileSize)
+                {
+                    me->m_SnapshotData = data;
+                    me->m_SnapshotSize = (int)fileSize;
+                    me->m_SnapshotIsMapped = RESULT_NO;
+                    result = RESULT_OK;
+                }
+                else
+                {
+                    // cannot read the file
+                    free(data);
+                }
+            }
+            else
+            {
+                // failed to allocate memory
+            }
+        }
+        else
+        {
+            // not a snapshot or too large
+        }
+        fclose(file);
+    }
+    else
+    {
+        // cannot open the file
+    }
+#endif
+
+    return result;
+}
+
+/**********************************************************/
+static void SnapshotClose(
+    Snapshot_t* me)
+{
+    if(me->m_SnapshotData)
+    {
+#if defined(RESUME_MMAP)
+        if(me->m_SnapshotIsMapped == RESULT_YES)
+        {
+            munmap((void*)me->m_SnapshotData, (size_t)me->m_SnapshotSize);
+        }
+        else
+#endif
+        {
+            free((void*)me->m_SnapshotData);
+        }
+    }
+    SnapshotInit(me);
+}
+
+/**********************************************************/
+static Result_t SnapshotCheckTable(
+    Snapshot_t* me,
+    uint32_t offset,
+    uint32_t count,
+    int recordSize)
+{
+    // 64bit math so a corrupt count cannot overflow
+    uint64_t end = (uint64_t)offset + ((uint64_t)count * (uint64_t)recordSize);
+
+    if((offset % SNAPSHOT_ALIGNMENT) != 0)
+    {
+        // records would not be aligned
+        return RESULT_ERROR;
+    }
+
+    if(end > (uint64_t)me->m_SnapshotSize)
+    {
+        // table does not fit in the snapshot
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t SnapshotCheckString(
+    const char* pool,
+    int poolSize,
+    uint32_t offset,
+    uint32_t length)
+{
+    // 64bit math so a corrupt length cannot overflow
+    uint64_t end = (uint64_t)offset + (uint64_t)length;
+
+    if(end >= (uint64_t)poolSize)
+    {
+        // string and null-terminator do not fit in the pool
+        return RESULT_ERROR;
+    }
+
+    if(pool[end] != '\0')
+    {
+        // string is not null-terminated
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+// MARK: --- RESUME ---
+
+/**********************************************************/
+static Result_t ResumeInit(
+    Resume_t* me,
+    ResumeOptions_t* resumeOptions)
+{
+    Section_t sectionIndex;
+
+    if(resumeOptions)
+    {
+        me->m_ResumeOptions = (*resumeOptions);
+    }
+    else
+    {
+        // using default resume options
+        me->m_ResumeOptions.m_ExtendedDisplayCount = DISPLAY_NONE;
+        me->m_ResumeOptions.m_DisplayFormat = FORMAT_TEXT;
+        me->m_ResumeOptions.m_HideSectionCount = 0;
+        me->m_ResumeOptions.m_ThreadCount = 1;
+        me->m_ResumeOptions.m_RankText = NULL;
+        me->m_ResumeOptions.m_Highlight = NULL;
+    }
+
+    // using INVALID_POSITION to indicate no errors
+    me->m_ResumeErrorInSection = INVALID_POSITION;
+
+    // using ENTRY_STATE_UNKNOWN to indicate no
+    // entry has been accessed
+    me->m_ResumeErrorInEntry = ENTRY_STATE_UNKNOWN;
+
+    // init hard-coded sections
+    sectionIndex = 0;
+    do
+    {
+        SectionData_t* sectionData = &me->m_ResumeSection[sectionIndex];
+        SectionDataInit(sectionData);
+        sectionIndex++;
+    }
+    while(sectionIndex < SECTION_COUNT);
+
+    // start with no runtime sections
+    me->m_ResumeSectionRuntime = NULL;
+
+    // start with no snapshot
+    me->m_ResumeSnapshotEntries = NULL;
+    me->m_ResumeSnapshot = NULL;
+
+    me->m_ResumeGeneration = 0;
+
+    // not ranked yet
+    me->m_ResumeRank = NULL;
+    me->m_ResumeRankGeneration = 0;
+
+    Result_t result = ManagedEntriesInit(&me->m_ResumeAllEntries, RESUME_MAX_ENTRIES);
+    if(result == RESULT_OK)
+    {
+        // select an initial section size that seems
+        // reasonably large. a quarter of a page is more
+        // than enough.
+        int intSectionEntryCount = (RESUME_MAX_LINES_PER_PAGE / 4);
+
+        // setup hard-coded section initial entries size
+        sectionIndex = 0;
+        do
+        {
+            Result_t resizeResult;
+            SectionData_t* sectionData = &me->m_ResumeSection[sectionIndex];
+            resizeResult = EntriesResize(
+                &sectionData->m_SectionEntries,
+                intSectionEntryCount);
+            if(resizeResult == RESULT_ERROR)
+            {
+                // cannot set initial entries size
+                me->m_ResumeErrorInSection = sectionIndex;
+                result = RESULT_ERROR;
+            }
+            sectionIndex++;
+        }
+        while(sectionIndex < SECTION_COUNT);
+    }
+    else
+    {
+        // failed to init entries
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeOptionsIsHiddenSection(
+    ResumeOptions_t* me,
+    const char* sectionTitle)
+{
+    if(sectionTitle)
+    {
+        if(sectionTitle[0] != '\0')
+        {
+            int index = 0;
+            while(index < me->m_HideSectionCount)
+            {
+                if(strcmp(sectionTitle, me->m_HideSectionName[index]) == 0)
+                {
+                    // resume option to hide this section is set
+                    return RESULT_YES;
+                }
+                index++;
+            }
+        }
+        else
+        {
+            // empty title.
+            // always hide sections with no title
+            return RESULT_YES;
+        }
+    }
+    else
+    {
+        // title missing.
+        // always hide invalid sections
+        return RESULT_YES;
+    }
+
+    return RESULT_NO;
+}
+
+/**********************************************************/
+static int ResumeOptionsGetDisplayMax(
+    ResumeOptions_t* me,
+    SectionData_t* sectionData)
+{
+    int displayMax = sectionData->m_SectionDisplayMax;
+
+    if(ResumeOptionsIsHiddenSection(me, sectionData->m_SectionTitle) == RESULT_YES)
+    {
+        // resume options hide this section
+        displayMax = DISPLAY_NONE;
+    }
+    else if(displayMax == DISPLAY_NONE)
+    {
+        // the section is always hidden
+    }
+    else if(me->m_ExtendedDisplayCount == DISPLAY_ALL)
+    {
+        displayMax = DISPLAY_ALL;
+    }
+    else if(displayMax != DISPLAY_ALL)
+    {
+        displayMax += me->m_ExtendedDisplayCount;
+    }
+    else
+    {
+        // the section already displays all entries
+    }
+
+    return displayMax;
+}
+
+/**********************************************************/
+static uint32_t ResumeOptionsHash(
+    ResumeOptions_t* me)
+{
+    const char* hidden[RESUME_OPTIONS_MAX_HIDDEN_SECTIONS];
+    uint32_t hash = HASH_FNV_OFFSET;
+    int format = (int)me->m_DisplayFormat;
+    int count = ResumeOptionsSortHidden(me, hidden);
+    int index;
+
+    hash = HashFnv1a(hash, &format, sizeof(format));
+    hash = HashFnv1a(hash, &me->m_ExtendedDisplayCount, sizeof(me->m_ExtendedDisplayCount));
+    if(me->m_RankText)
+    {
+        // the rank text changes which entries are displayed
+        hash = HashFnv1a(hash, me->m_RankText, (int)(strlen(me->m_RankText) + 1));
+    }
+    if(me->m_Highlight)
+    {
+        // the keywords change the rendered text
+        hash = HashFnv1a(hash, me->m_Highlight->m_HighlightText, (int)(strlen(me->m_Highlight->m_HighlightText) + 1));
+    }
+
+    // each name includes its null-terminator so
+    // "ab" "c" and "a" "bc" are different
+    index = 0;
+    while(index < count)
+    {
+        hash = HashFnv1a(hash, hidden[index], (int)(strlen(hidden[index]) + 1));
+        index++;
+    }
+
+    return hash;
+}
+
+/**********************************************************/
+static void ResumeOptionsWriteKey(
+    ResumeOptions_t* me,
+    OutputBuffer_t* output)
+{
+    const char* hidden[RESUME_OPTIONS_MAX_HIDDEN_SECTIONS];
+    int format = (int)me->m_DisplayFormat;
+    int count = ResumeOptionsSortHidden(me, hidden);
+    int index;
+
+    OutputBufferAppend(output, (const char*)&format, sizeof(format));
+    OutputBufferAppend(output, (const char*)&me->m_ExtendedDisplayCount, sizeof(me->m_ExtendedDisplayCount));
+    if(me->m_RankText)
+    {
+        // the rank text changes which entries are displayed
+        OutputBufferAppend(output, me->m_RankText, (int)(strlen(me->m_RankText) + 1));
+    }
+    if(me->m_Highlight)
+    {
+        // the keywords change the rendered text
+        OutputBufferAppend(output, me->m_Highlight->m_HighlightText, (int)(strlen(me->m_Highlight->m_HighlightText) + 1));
+    }
+
+    // each name includes its null-terminator so
+    // "ab" "c" and "a" "bc" are different
+    index = 0;
+    while(index < count)
+    {
+        OutputBufferAppend(output, hidden[index], (int)(strlen(hidden[index]) + 1));
+        index++;
+    }
+}
+
+/**********************************************************/
+static int ResumeOptionsSortHidden(
+    ResumeOptions_t* me,
+    const char** hidden)
+{
+    int count = 0;
+    int index;
+
+    // insertion sort is fine for the few hidden sections
+    index = 0;
+    while(index < me->m_HideSectionCount)
+    {
+        const char* name = me->m_HideSectionName[index];
+        int insert = count;
+        int compare = 1;
+        while((insert > 0) && ((compare = strcmp(hidden[insert - 1], name)) > 0))
+        {
+            insert--;
+        }
+
+        if((insert > 0) && (compare == 0))
+        {
+            // duplicate
+        }
+        else
+        {
+            memmove(&hidden[insert + 1], &hidden[insert], ((count - insert) * sizeof(const char*)));
+            hidden[insert] = name;
+            count++;
+        }
+        index++;
+    }
+
+    return count;
+}
+
+/**********************************************************/
+static void ResumeDeInit(
+    Resume_t* me)
+{
+    // cleanup runtime sections
+    if(me->m_ResumeSectionRuntime)
+    {
+        SectionDataDeInit(me->m_ResumeSectionRuntime); // recursive
+        MemoryFree(me->m_ResumeSectionRuntime);
+        me->m_ResumeSectionRuntime = NULL;
+    }
+
+    // clean up hard-coded sections
+    int index = 0;
+    do
+    {
+        SectionDataDeInit(&me->m_ResumeSection[index]); // recursive
+        index++;
+    }
+    while(index < SECTION_COUNT);
+
+    ManagedEntriesDeInit(&me->m_ResumeAllEntries);
+
+    if(me->m_ResumeRank)
+    {
+        RankDeInit(me->m_ResumeRank);
+        MemoryFree(me->m_ResumeRank);
+        me->m_ResumeRank = NULL;
+    }
+
+    // snapshot entries are not managed because their
+    // text belongs to the snapshot
+    MemoryFree(me->m_ResumeSnapshotEntries);
+    me->m_ResumeSnapshotEntries = NULL;
+    if(me->m_ResumeSnapshot)
+    {
+        SnapshotClose(me->m_ResumeSnapshot);
+        free(me->m_ResumeSnapshot);
+        me->m_ResumeSnapshot = NULL;
+    }
+}
+
+/**********************************************************/
+static void ResumeClear(
+    Resume_t* me)
+{
+    Section_t section;
+
+    // runtime sections are not kept
+    if(me->m_ResumeSectionRuntime)
+    {
+        SectionDataDeInit(me->m_ResumeSectionRuntime); // recursive
+        MemoryFree(me->m_ResumeSectionRuntime);
+        me->m_ResumeSectionRuntime = NULL;
+    }
+
+    section = 0;
+    do
+    {
+        SectionDataClear(&me->m_ResumeSection[section]);
+        section++;
+    }
+    while(section < SECTION_COUNT);
+
+    ManagedEntriesClear(&me->m_ResumeAllEntries);
+
+    // the rank index points to the cleared entries
+    if(me->m_ResumeRank)
+    {
+        RankDeInit(me->m_ResumeRank);
+    }
+
+    MemoryFree(me->m_ResumeSnapshotEntries);
+    me->m_ResumeSnapshotEntries = NULL;
+    if(me->m_ResumeSnapshot)
+    {
+        SnapshotClose(me->m_ResumeSnapshot);
+        free(me->m_ResumeSnapshot);
+        me->m_ResumeSnapshot = NULL;
+    }
+
+    me->m_ResumeErrorInSection = INVALID_POSITION;
+    me->m_ResumeErrorInEntry = ENTRY_STATE_UNKNOWN;
+
+    // nothing rendered before is still valid
+    me->m_ResumeGeneration++;
+}
+
+/**********************************************************/
+SectionData_t* ResumeInsertSection(
+    Resume_t* me,
+    Section_t section)
+{
+    SectionData_t* sectionData;
+    
+    if(section < SECTION_AT_RUNTIME)
+    {
+        // cannot insert here
+        return NULL;
+    }
+
+    sectionData = (SectionData_t*)MemoryAlloc(MEMORY_SECTIONS, sizeof(SectionData_t));
+    if(sectionData == NULL)
+    {
+        // failed to allocate section data
+        return NULL;
+    }
+
+    if(section > SECTION_AT_RUNTIME)
+    {
+        SectionData_t* previousSectionData = ResumeGetSectionData(me, (section - 1));
+        if(previousSectionData)
+        {
+            SectionDataInit(sectionData);
+
+            // save the link to the existing section
+            sectionData->m_SectionNext = previousSectionData->m_SectionNext;
+
+            // insert the new section
+            // after the previous section
+            previousSectionData->m_SectionNext = sectionData;
+        }
+        else
+        {
+            // cannot insert here.
+            // there is no previous runtime 
+            // section to link to.
+            MemoryFree(sectionData);
+            sectionData = NULL;
+        }
+    }
+    else
+    {
+        SectionDataInit(sectionData);
+
+        // placing this section at the start of the
+        // linked-list of sections added at runtime
+        if(me->m_ResumeSectionRuntime)
+        {
+            // save the link to the existing section
+            sectionData->m_SectionNext = me->m_ResumeSectionRuntime;
+        }
+        
+        // save the new section as the first
+        me->m_ResumeSectionRuntime = sectionData;
+    }
+
+    if(sectionData)
+    {
+        me->m_ResumeGeneration++;
+    }
+    else
+    {
+        // nothing changed
+    }
+
+    return sectionData;
+}
+
+/**********************************************************/
+SectionData_t* ResumeRemoveSection(
+    Resume_t* me,
+    Section_t section)
+{
+    SectionData_t* sectionData = NULL;
+
+    if(section < SECTION_AT_RUNTIME)
+    {
+        // cannot remove this section
+        return NULL;
+    }
+
+    if(section > SECTION_AT_RUNTIME)
+    {
+        sectionData = ResumeGetSectionData(me, section);
+        if(sectionData)
+        {
+            // this is not effecient. the linked-list was
+            // already searched once so a pointer to the
+            // previous section could have been stored
+            SectionData_t* previousSectionData = ResumeGetSectionData(me, (section - 1));
+            if(previousSectionData)
+            {
+                // removing this section data from the
+                // linked-list
+                previousSectionData->m_SectionNext = sectionData->m_SectionNext;
+                sectionData->m_SectionNext = NULL;
+            }
+            else
+            {
+                // this should not be possible.
+                // ResumeGetSectionData() could not return a
+                // valid pointer if there was no previous
+                // section data at this section index
+            }
+        }
+        else
+        {
+            // this section does not exist
+        }
+    }
+    else if(me->m_ResumeSectionRuntime)
+    {
+        // removing the first runtime section
+        sectionData = me->m_ResumeSectionRuntime;       
+        me->m_ResumeSectionRuntime = sectionData->m_SectionNext;
+        sectionData->m_SectionNext = NULL;
+    }
+    else
+    {
+        // no runtime section to remove
+    }
+
+    if(sectionData)
+    {
+        me->m_ResumeGeneration++;
+    }
+    else
+    {
+        // nothing changed
+    }
+
+    return sectionData;
+}
+
+/**********************************************************/
+Section_t ResumeGetSectionCount(
+    Resume_t* me)
+{
+    Section_t count = SECTION_COUNT;
+    SectionData_t* sectionData = me->m_ResumeSectionRuntime;
+    while(sectionData)
+    {
+        count++;
+        sectionData = sectionData->m_SectionNext;
+    }
+    return count;
+}
+
+/**********************************************************/
+SectionData_t* ResumeGetSectionData(
+    Resume_t* me,
+    Section_t section)
+{
+    SectionData_t* sectionData = NULL;
+
+    if(section < SECTION_COUNT)
+    {
+        // hard-coded section
+        sectionData = &me->m_ResumeSection[section];
+    }
+    else
+    {
+        section -= SECTION_AT_RUNTIME;
+        if(section >= 0)
+        {
+            // runtime section
+            sectionData = me->m_ResumeSectionRuntime;
+            while(section > 0)
+            {
+                sectionData = sectionData->m_SectionNext;
+                section--;
+                if(sectionData == NULL)
+                {
+                    // section is missing
+                    break;
+                }
+            }
+        }
+        else
+        {
+            // no section selected
+        }
+    }
+
+    return sectionData;
+}
+
+/**********************************************************/
+Section_t ResumeGetSectionIndex(
+    Resume_t* me,
+    SectionData_t* sectionData)
+{
+    Section_t section = 0;
+    do
+    {
+        if(&me->m_ResumeSection[section] == sectionData)
+        {
+            return section;
+        }
+        section++;
+    }
+    while (section < SECTION_COUNT);
+    
+    SectionData_t* runtimeSection = me->m_ResumeSectionRuntime;
+    while(runtimeSection)
+    {
+        if(runtimeSection == sectionData)
+        {
+            return section;
+        }
+        section++;
+        runtimeSection = runtimeSection->m_SectionNext;
+    }
+
+    return INVALID_POSITION;
+}
+
+/**********************************************************/
+static const char* ResumeGetSectionTitle(
+    Resume_t* me,
+    Section_t section)
+{
+    SectionData_t* sectionData = ResumeGetSectionData(me, section);
+    if(sectionData)
+    {
+        return sectionData->m_SectionTitle;
+    }
+
+    // invalid section
+    return g_EmptyText;
+}
+
+/**********************************************************/
+static Result_t ResumeAddEntry(
+    Resume_t* me,
+    Section_t section,
+    const char* text,
+    const char* start,
+    const char* end)
+{
+    Result_t result = RESULT_OK;
+    SectionData_t* sectionData = ResumeGetSectionData(me, section);
+    if(sectionData)
+    {
+        // set the text with practically no upper bounds
+        result = SectionAddEntry(sectionData, me, text, MAX_STRING_LENGTH, start, end);
+    }
+    else
+    {
+        // section data is missing
+        me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_SECTION_MISSING;
+        me->m_ResumeErrorInSection = section;
+        result = RESULT_ERROR;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t SectionAddEntry(
+    SectionData_t* me,
+    Resume_t* resume,
+    const char* text,
+    int textLength,
+    const char* start,
+    const char* end)
+{
+    Result_t result = RESULT_OK;
+    Entry_t* entry = ManagedEntriesAppendSubstr(&resume->m_ResumeAllEntries, text, textLength, start, end);
+    if(entry)
+    {
+        resume->m_ResumeGeneration++;
+        result = SectionDataIncludeEntry(me, entry);
+        if(result == RESULT_ERROR)
+        {
+            // the only way including an entry can fail
+            // with an error is if the section could not
+            // be resized to fit the entry
+            resume->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_RESIZE;
+            resume->m_ResumeErrorInSection = ResumeGetSectionIndex(resume, me);
+        }
+    }
+    else
+    {
+        // failed to create entry
+        resume->m_ResumeErrorInEntry = resume->m_ResumeAllEntries.m_ManagedEntriesError;
+        resume->m_ResumeErrorInSection = ResumeGetSectionIndex(resume, me);
+        result = RESULT_ERROR;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t SectionShare(
+    SectionData_t* me,
+    Resume_t* resume,
+    SectionData_t* source)
+{
+    Entries_t* ordered = &source->m_SectionOrdered.m_EntriesTraverse;
+    int count = ordered->m_EntriesUsed;
+    int index;
+
+    if(source->m_SectionOrdered.m_EntriesTraverseNumber == INVALID_POSITION)
+    {
+        // ordering now would change the source
+        return RESULT_ERROR;
+    }
+
+    if(SectionDataSetTitle(me, source->m_SectionTitle) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+    me->m_SectionDisplayMax = source->m_SectionDisplayMax;
+    me->m_SectionOrder = source->m_SectionOrder;
+    me->m_SectionOrderEntryTime = source->m_SectionOrderEntryTime;
+    me->m_SectionDateOption = source->m_SectionDateOption;
+    me->m_SectionFingerprint = source->m_SectionFingerprint;
+    resume->m_ResumeGeneration++;
+
+    if(count == 0)
+    {
+        // nothing to share
+        return RESULT_OK;
+    }
+
+    if((EntriesResize(&me->m_SectionEntries, count) != RESULT_OK) ||
+       (EntriesResize(&me->m_SectionOrdered.m_EntriesTraverse, count) != RESULT_OK))
+    {
+        resume->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_RESIZE;
+        return RESULT_ERROR;
+    }
+
+    // shared in display order so the section is already
+    // ordered. random sections keep their order too.
+    // the entries are freed when the last resume that
+    // shares them is retired by ResumeSharedRetire()
+    index = 0;
+    do
+    {
+        Entry_t* entry = ManagedEntriesAppendShared(&resume->m_ResumeAllEntries, ordered->m_Entries[index]);
+        if(entry == NULL)
+        {
+            resume->m_ResumeErrorInEntry = resume->m_ResumeAllEntries.m_ManagedEntriesError;
+            me->m_SectionEntries.m_EntriesUsed = index;
+            return RESULT_ERROR;
+        }
+        me->m_SectionEntries.m_Entries[index] = entry;
+        me->m_SectionOrdered.m_EntriesTraverse.m_Entries[index] = entry;
+        index++;
+    }
+    while(index < count);
+
+    me->m_SectionEntries.m_EntriesUsed = count;
+    me->m_SectionOrdered.m_EntriesTraverse.m_EntriesUsed = count;
+    me->m_SectionOrdered.m_EntriesTraverseNumber = 0;
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static SectionData_t* ResumeFindSectionByFingerprint(
+    Resume_t* me,
+    uint64_t fingerprint)
+{
+    // only runtime sections are filled from json
+    SectionData_t* sectionData = me->m_ResumeSectionRuntime;
+    while(sectionData)
+    {
+        if(sectionData->m_SectionFingerprint == fingerprint)
+        {
+            return sectionData;
+        }
+        sectionData = sectionData->m_SectionNext;
+    }
+
+    return NULL;
+}
+
+/**********************************************************/
+static Result_t ResumeOrderSections(
+    Resume_t* me)
+{
+    Result_t result = RESULT_OK;
+    Section_t section = 0;
+    int unordered = 0;
+    SectionData_t* sectionData;
+
+    // a section that is already ordered keeps its order
+    // so the resume only changes if one is not
+    sectionData = ResumeGetSectionData(me, section);
+    while(sectionData)
+    {
+        if(sectionData->m_SectionOrdered.m_EntriesTraverseNumber == INVALID_POSITION)
+        {
+            unordered++;
+        }
+        section++;
+        sectionData = ResumeGetSectionData(me, section);
+    }
+
+    if(me->m_ResumeOptions.m_ThreadCount > 1)
+    {
+        result = ResumeOrderSectionsParallel(me);
+    }
+    else
+    {
+        section = 0;
+        sectionData = ResumeGetSectionData(me, section);
+        while(sectionData)
+        {
+            if(SectionDataGetOrderedEntries(sectionData) == NULL)
+            {
+                // cannot order the entries
+                me->m_ResumeErrorInSection = section;
+                result = RESULT_ERROR;
+            }
+            section++;
+            sectionData = ResumeGetSectionData(me, section);
+        }
+    }
+
+    if(unordered > 0)
+    {
+        // random sections may be in a new order
+        me->m_ResumeGeneration++;
+    }
+    else
+    {
+        // nothing was ordered
+    }
+
+    if((result == RESULT_OK) && (me->m_ResumeOptions.m_RankText))
+    {
+        // every section is ranked together so a term
+        // used in every section is not relevant
+        result = ResumeRankSections(me);
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeOrderSectionsParallel(
+    Resume_t* me)
+{
+    SectionPool_t pool;
+    Result_t result = SectionPoolInit(&pool, me);
+    if(result == RESULT_OK)
+    {
+        // rand() orders random sections so they are ordered
+        // in section order on this thread
+        Section_t section = 0;
+        while(section < pool.m_PoolCount)
+        {
+            if(pool.m_PoolSections[section]->m_SectionOrder == ORDER_RANDOM)
+            {
+                pool.m_PoolResults[section] = ResumeOrderSectionCallback(pool.m_PoolSections[section], section, NULL);
+            }
+            section++;
+        }
+
+        SectionPoolRun(&pool, me->m_ResumeOptions.m_ThreadCount, ResumeOrderSectionCallback, NULL);
+
+        section = 0;
+        while(section < pool.m_PoolCount)
+        {
+            if(pool.m_PoolResults[section] == RESULT_ERROR)
+            {
+                // cannot order the entries
+                me->m_ResumeErrorInSection = section;
+                result = RESULT_ERROR;
+            }
+            section++;
+        }
+    }
+    else
+    {
+        // failed to allocate memory
+    }
+    SectionPoolDeInit(&pool);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeOrderSectionCallback(
+    SectionData_t* sectionData,
+    Section_t section,
+    void* userData)
+{
+    PARAM_NOT_USED(section);
+    PARAM_NOT_USED(userData);
+
+    if(SectionDataGetOrderedEntries(sectionData) == NULL)
+    {
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t ResumeRankSections(
+    Resume_t* me)
+{
+    Result_t result = RESULT_OK;
+    Result_t isBuilt = RESULT_NO;
+
+    if(me->m_ResumeRank == NULL)
+    {
+        me->m_ResumeRank = (Rank_t*)MemoryAlloc(MEMORY_RANK, sizeof(Rank_t));
+        if(me->m_ResumeRank == NULL)
+        {
+            // failed to allocate memory
+            return RESULT_ERROR;
+        }
+        RankInit(me->m_ResumeRank);
+    }
+    else
+    {
+        // the index may still be used
+    }
+
+    if((me->m_ResumeRank->m_RankEntries == NULL) ||
+       (me->m_ResumeRankGeneration != me->m_ResumeGeneration))
+    {
+        // the sections or their entries changed
+        RankDeInit(me->m_ResumeRank);
+        result = RankBuild(me->m_ResumeRank, me);
+        isBuilt = RESULT_YES;
+    }
+    else
+    {
+        // the index already has every entry
+    }
+
+    if(result == RESULT_OK)
+    {
+        if((RankScore(me->m_ResumeRank, me->m_ResumeOptions.m_RankText) > 0) ||
+           (isBuilt == RESULT_NO))
+        {
+            // an index that was used before is applied
+            // even when nothing is relevant because the
+            // entries may be ranked by other text
+            RankApply(me->m_ResumeRank, me);
+        }
+        else
+        {
+            // nothing is relevant so every section
+            // stays in order
+        }
+    }
+    else
+    {
+        // failed to allocate memory
+        RankDeInit(me->m_ResumeRank);
+    }
+
+    // the ranked entries are displayed first
+    me->m_ResumeGeneration++;
+    me->m_ResumeRankGeneration = me->m_ResumeGeneration;
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeLoad(
+    Resume_t* me,
+    const char* json,
+    ResumeLoadCallback_t callback,
+    void* userData)
+{
+    return ResumeLoadReusing(me, json, NULL, NULL, callback, userData);
+}
+
+/**********************************************************/
+static Result_t ResumeLoadReusing(
+    Resume_t* me,
+    const char* json,
+    Resume_t* previous,
+    int* reusedCount,
+    ResumeLoadCallback_t callback,
+    void* userData)
+{
+    Result_t result = RESULT_OK;
+
+    if(json)
+    {
+        if(callback)
+        {
+            callback(LOAD_PHASE_FILL, userData);
+        }
+        result = ResumeFillHardCoded(me);
+
+        if(callback)
+        {
+            callback(LOAD_PHASE_FILL_JSON, userData);
+        }
+        if(result == RESULT_ERROR)
+        {
+            // the hard-coded sections failed
+        }
+        else if(previous)
+        {
+            result = ResumeFillSectionsFromJsonArrayReusing(me, json, previous, reusedCount);
+        }
+        else
+        {
+            result = ResumeFillSectionsFromJsonArray(me, json);
+        }
+    }
+    else
+    {
+        // the sections were filled from a snapshot
+    }
+
+    if(callback)
+    {
+        callback(LOAD_PHASE_ORDER, userData);
+    }
+    if(result != RESULT_ERROR)
+    {
+        result = ResumeOrderSections(me);
+    }
+
+    if(callback)
+    {
+        callback(LOAD_PHASE_DONE, userData);
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static void ResumePrintLoadError(
+    Resume_t* me,
+    const char* nameFormat,
+    ...)
+{
+    va_list args;
+
+    printf("Error: ");
+    va_start(args, nameFormat);
+    vprintf(nameFormat, args);
+    va_end(args);
+
+    if((int)me->m_ResumeErrorInSection != INVALID_POSITION)
+    {
+        const char* sectionTitle = ResumeGetSectionTitle(me, me->m_ResumeErrorInSection);
+        printf(" could not be filled at section \"%s\" [%s]\n", sectionTitle, g_EntryStateLookup[me->m_ResumeErrorInEntry]);
+    }
+    else
+    {
+        printf(" could not be filled [%s]\n", g_EntryStateLookup[me->m_ResumeErrorInEntry]);
+    }
+}
+
+/**********************************************************/
+static void ResumePrintEntryText(
+    ResumeOptions_t* options,
+    const char* text,
+    OutputBuffer_t* output)
+{
+    if(options->m_Highlight)
+    {
+        HighlightAppend(options->m_Highlight, text, options->m_DisplayFormat, output);
+    }
+    else if(options->m_DisplayFormat == FORMAT_HTML)
+    {
+        OutputBufferAppendHtml(output, text, (int)strlen(text));
+    }
+    else
+    {
+        // plain text is not escaped
+        OutputBufferAppendText(output, text);
+    }
+}
+
+/**********************************************************/
+static void ResumePrint(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output)
+{
+    switch(options->m_DisplayFormat)
+    {
+    case FORMAT_HTML:
+    {
+        ResumePrintHtml(me, options, output);
+    }
+    break;
+
+    case FORMAT_TEXT: // fall-through
+    default:
+    {
+        ResumePrintPlainText(me, options, output);
+    }
+    break;
+    }
+}
+
+/**********************************************************/
+static Result_t ResumePrintFormat(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    Format_t format,
+    OutputBuffer_t* output)
+{
+    ResumeOptions_t formatOptions = (*options);
+
+    formatOptions.m_DisplayFormat = format;
+    ResumePrint(me, &formatOptions, output);
+
+    return output->m_OutputResult;
+}
+
+/**********************************************************/
+static void ResumePrintHeader(
+    ResumeOptions_t* options,
+    OutputBuffer_t* output)
+{
+    switch(options->m_DisplayFormat)
+    {
+    case FORMAT_HTML:
+    {
+        ResumePrintHtmlHeader(output);
+    }
+    break;
+
+    case FORMAT_TEXT: // fall-through
+    default:
+    {
+        ResumePrintPlainTextHeader(output);
+    }
+    break;
+    }
+}
+
+/**********************************************************/
+static void ResumePrintSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output)
+{
+    int64_t start = TraceBegin();
+    int length = output->m_OutputLength;
+
+    switch(options->m_DisplayFormat)
+    {
+    case FORMAT_HTML:
+    {
+        ResumePrintHtmlSection(options, sectionData, output);
+    }
+    break;
+
+    case FORMAT_TEXT: // fall-through
+    default:
+    {
+        ResumePrintPlainTextSection(options, sectionData, output);
+    }
+    break;
+    }
+
+    TraceEnd(TRACE_SPAN_RENDER, sectionData->m_SectionTitle, (output->m_OutputLength - length), start);
+}
+
+/**********************************************************/
+static void ResumePrintFooter(
+    ResumeOptions_t* options,
+    OutputBuffer_t* output)
+{
+    switch(options->m_DisplayFormat)
+    {
+    case FORMAT_HTML:
+    {
+        ResumePrintHtmlFooter(output);
+    }
+    break;
+
+    case FORMAT_TEXT: // fall-through
+    default:
+    {
+        ResumePrintPlainTextFooter(output);
+    }
+    break;
+    }
+}
+
+/**********************************************************/
+static void ResumePrintHtml(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output)
+{
+    ResumePrintHtmlHeader(output);
+
+    // print all sections
+    int sectionIndex = 0;
+    SectionData_t* sectionData = ResumeGetSectionData(me, sectionIndex);
+    while(sectionData)
+    {
+        ResumePrintSection(options, sectionData, output);
+        sectionIndex++;
+        sectionData = ResumeGetSectionData(me, sectionIndex);
+    }
+
+    ResumePrintHtmlFooter(output);
+}
+
+/**********************************************************/
+static void ResumePrintHtmlHeader(
+    OutputBuffer_t* output)
+{
+    //
+    // PRINT
+    //
+    // header
+    //
+    OutputBufferPrintf(output, "<!doctype html>\r\n");
+    OutputBufferPrintf(output, "<html lang=\"en-us\">\r\n");
+    OutputBufferPrintf(output, "<head>\r\n");
+    OutputBufferAppendText(output, "    <title>");
+    OutputBufferAppendHtml(output, g_ResumeFullName, (sizeof(g_ResumeFullName) - 1));
+    OutputBufferAppendText(output, " - Resume</title>\r\n");
+    OutputBufferPrintf(output, "</head>\r\n");
+    OutputBufferPrintf(output, "<body>\r\n");
+    OutputBufferPrintf(output, "<p>\r\n");
+    OutputBufferAppendHtml(output, g_ResumeFullName, (sizeof(g_ResumeFullName) - 1));
+    OutputBufferAppendText(output, "<br/>\r\n");
+    OutputBufferAppendHtml(output, g_ResumeEmail, (sizeof(g_ResumeEmail) - 1));
+    OutputBufferAppendText(output, "<br/>\r\n");
+    OutputBufferAppendHtml(output, g_ResumeCity, (sizeof(g_ResumeCity) - 1));
+    OutputBufferAppendText(output, ", ");
+    OutputBufferAppendHtml(output, g_ResumeState, (sizeof(g_ResumeState) - 1));
+    OutputBufferAppendText(output, "<br/>\r\n");
+    OutputBufferAppendHtml(output, g_ResumeMobileNumber, (sizeof(g_ResumeMobileNumber) - 1));
+    OutputBufferAppendText(output, "<br/>\r\n");
+    OutputBufferAppendText(output, "<a href=\"");
+    OutputBufferAppendHtml(output, g_ResumeWebUrl, (sizeof(g_ResumeWebUrl) - 1));
+    OutputBufferAppendText(output, "\">");
+    OutputBufferAppendHtml(output, g_ResumeWebUrl, (sizeof(g_ResumeWebUrl) - 1));
+    OutputBufferAppendText(output, "</a>\r\n");
+    OutputBufferPrintf(output, "</p>\r\n");
+    OutputBufferPrintf(output, "\r\n");
+}
+
+/**********************************************************/
+static void ResumePrintHtmlSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output)
+{
+    static const char dateRangeSeparator[] = " to ";
+    static const int datePos[ENTRY_TIME_COUNT] =
+        {
+            0, // ENTRY_TIME_START
+            (DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1)) // ENTRY_TIME_END
+        };
+
+    // start date + separator + end date + space + null
+    char dateString[DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1) + DATE_STRING_LENGTH + 1 + 1];
+
+    int displayMax = ResumeOptionsGetDisplayMax(options, sectionData);
+    if(displayMax != DISPLAY_NONE)
+    {
+        int dateStringStart = 0;
+        int displayCount = 0;
+        int entryIndex = 0;
+        int entryCount = 0;
+        Entries_t* orderedEntries = SectionDataGetOrderedEntries(sectionData);
+        if(orderedEntries)
+        {
+            entryCount = orderedEntries->m_EntriesUsed;
+        }
+
+        // adjust date string start position
+        if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_ALL) == DATE_OPTION_HIDE_ALL)
+        {
+            // the date is always
+            // hidden in this section
+            dateStringStart = (sizeof(dateString) - 1);
+        }
+        else if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_START) == DATE_OPTION_HIDE_START)
+        {
+            // the start date is always
+            // hidden in this section
+            dateStringStart = datePos[ENTRY_TIME_END];
+        }
+
+        //
+        // PRINT
+        //
+        // section title
+        //
+        OutputBufferPrintf(output, "<hr/>\r\n");
+        OutputBufferAppendText(output, "<h1>");
+        OutputBufferAppendHtml(output, sectionData->m_SectionTitle, (int)strlen(sectionData->m_SectionTitle));
+        OutputBufferAppendText(output, "</h1>\r\n");
+        OutputBufferPrintf(output, "<p>\r\n");
+
+        while(entryIndex < entryCount)
+        {
+            Entry_t* entry = orderedEntries->m_Entries[entryIndex];
+
+            // format the date string
+            int datesShown = 0;
+            datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_START]], DATE_STRING_LENGTH, ENTRY_TIME_START, sectionData->m_SectionDateOption) > 0);
+            datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_END]], DATE_STRING_LENGTH, ENTRY_TIME_END, sectionData->m_SectionDateOption) > 0);
+            if(datesShown == 2)
+            {
+                // both dates are shown.
+                // include the separator
+                memcpy(&dateString[DATE_STRING_LENGTH], dateRangeSeparator, sizeof(dateRangeSeparator)-1);
+                dateString[sizeof(dateString)-2] = ' ';
+                dateString[sizeof(dateString)-1] = '\0';
+            }
+            else if(datesShown == 1)
+            {
+                // only 1 or no date is shown.
+                if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_END) == DATE_OPTION_HIDE_END)
+                {
+                    // entire end date is hidden.
+                    // only the start date is shown.
+                    dateString[DATE_STRING_LENGTH]   = ' ';
+                    dateString[DATE_STRING_LENGTH + 1] = '\0';
+                }
+                else
+                {
+                    // the end date is not hidden so
+                    // the start date must be.
+                    // fill the separator with spaces
+                    memset(&dateString[DATE_STRING_LENGTH], ' ', sizeof(dateRangeSeparator)-1);
+                    dateString[sizeof(dateString)-2] = ' ';
+                    dateString[sizeof(dateString)-1] = '\0';
+                }
+            }
+            else
+            {
+                // no dates shown
+                dateString[dateStringStart] = '\0';
+            }
+
+            //
+            // PRINT
+            //
+            // date string and entry text.
+            // the date string never needs to be escaped
+            //
+            OutputBufferAppendText(output, &dateString[dateStringStart]);
+            ResumePrintEntryText(options, entry->m_EntryText, output);
+            OutputBufferAppendText(output, "<br/>\r\n");
+
+            // check if more entries should be displayed
+            if(displayMax != DISPLAY_ALL)
+            {
+                displayCount++;
+                if(displayCount == displayMax)
+                {
+                    // max display count reached.
+                    // break out of this loop
+                    break;
+                }
+            }
+
+            entryIndex++;
+        }
+
+        //
+        // PRINT
+        //
+        // end of section
+        //
+        OutputBufferPrintf(output, "</p>\r\n");
+        OutputBufferPrintf(output, "\r\n");
+    }
+    else
+    {
+        // this section is hidden
+    }
+}
+
+/**********************************************************/
+static void ResumePrintHtmlFooter(
+    OutputBuffer_t* output)
+{
+    //
+    // PRINT
+    //
+    // footer
+    //
+    OutputBufferPrintf(output, "</body>\r\n");
+    OutputBufferPrintf(output, "</html>\r\n");
+}
+
+/**********************************************************/
+static void ResumePrintPlainText(
+    Resume_t* me,
+    ResumeOptions_t* options,
+    OutputBuffer_t* output)
+{
+    ResumePrintPlainTextHeader(output);
+
+    // print all sections
+    int sectionIndex = 0;
+    SectionData_t* sectionData = ResumeGetSectionData(me, sectionIndex);
+    while(sectionData)
+    {
+        ResumePrintSection(options, sectionData, output);
+        sectionIndex++;
+        sectionData = ResumeGetSectionData(me, sectionIndex);
+    }
+
+    ResumePrintPlainTextFooter(output);
+}
+
+/**********************************************************/
+static void ResumePrintPlainTextHeader(
+    OutputBuffer_t* output)
+{
+    //
+    // PRINT
+    //
+    // header
+    //
+    OutputBufferPrintf(output, "=======================================\n");
+    OutputBufferPrintf(output, "%s\n", g_ResumeFullName);
+    OutputBufferPrintf(output, "%s\n", g_ResumeEmail);
+    OutputBufferPrintf(output, "%s, %s\n", g_ResumeCity, g_ResumeState);
+    OutputBufferPrintf(output, "%s\n", g_ResumeMobileNumber);
+    OutputBufferPrintf(output, "%s\n", g_ResumeWebUrl);
+    OutputBufferPrintf(output, "\n");
+}
+
+/**********************************************************/
+static void ResumePrintPlainTextSection(
+    ResumeOptions_t* options,
+    SectionData_t* sectionData,
+    OutputBuffer_t* output)
+{
+    static const char dateRangeSeparator[] = " to ";
+    static const int datePos[ENTRY_TIME_COUNT] =
+        {
+            0, // ENTRY_TIME_START
+            (DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1)) // ENTRY_TIME_END
+        };
+
+    // start date + separator + end date + space + null
+    char dateString[DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1) + DATE_STRING_LENGTH + 1 + 1];
+
+    int displayMax = ResumeOptionsGetDisplayMax(options, sectionData);
+    if(displayMax != DISPLAY_NONE)
+    {
+        int dateStringStart = 0;
+        int displayCount = 0;
+        int entryIndex = 0;
+        int entryCount = 0;
+        Entries_t* orderedEntries = SectionDataGetOrderedEntries(sectionData);
+        if(orderedEntries)
+        {
+            entryCount = orderedEntries->m_EntriesUsed;
+        }
+
+        // adjust date string start position
+        if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_ALL) == DATE_OPTION_HIDE_ALL)
+        {
+            // the date is always
+            // hidden in this section
+            dateStringStart = (sizeof(dateString) - 1);
+        }
+        else if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_START) == DATE_OPTION_HIDE_START)
+        {
+            // the start date is always
+            // hidden in this section
+            dateStringStart = datePos[ENTRY_TIME_END];
+        }
+
+        //
+        // PRINT
+        //
+        // section title
+        //
+        OutputBufferPrintf(output, "---------------------------------------\n");
+        OutputBufferPrintf(output, "%s\n", sectionData->m_SectionTitle);
+        OutputBufferPrintf(output, "---------------------------------------\n");
+
+        while(entryIndex < entryCount)
+        {
+            Entry_t* entry = orderedEntries->m_Entries[entryIndex];
+
+            // format the date string
+            int datesShown = 0;
+            datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_START]], DATE_STRING_LENGTH, ENTRY_TIME_START, sectionData->m_SectionDateOption) > 0);
+            datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_END]], DATE_STRING_LENGTH, ENTRY_TIME_END, sectionData->m_SectionDateOption) > 0);
+            if(datesShown == 2)
+            {
+                // both dates are shown.
+                // include the separator
+                memcpy(&dateString[DATE_STRING_LENGTH], dateRangeSeparator, sizeof(dateRangeSeparator)-1);
+                dateString[sizeof(dateString)-2] = ' ';
+                dateString[sizeof(dateString)-1] = '\0';
+            }
+            else if(datesShown == 1)
+            {
+                // only 1 or no date is shown.
+                if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_END) == DATE_OPTION_HIDE_END)
+                {
+                    // entire end date is hidden.
+                    // only the start date is shown.
+                    dateString[DATE_STRING_LENGTH]   = ' ';
+                    dateString[DATE_STRING_LENGTH + 1] = '\0';
+                }
+                else
+                {
+                    // the end date is not hidden so
+                    // the start date must be.
+                    // fill the separator with spaces
+                    memset(&dateString[DATE_STRING_LENGTH], ' ', sizeof(dateRangeSeparator)-1);
+                    dateString[sizeof(dateString)-2] = ' ';
+                    dateString[sizeof(dateString)-1] = '\0';
+                }
+            }
+            else
+            {
+                // no dates shown
+                dateString[dateStringStart] = '\0';
+            }
+
+            //
+            // PRINT
+            //
+            // date string and entry text
+            //
+            OutputBufferPrintf(output, "     %s", &dateString[dateStringStart]);
+            ResumePrintEntryText(options, entry->m_EntryText, output);
+            OutputBufferAppendText(output, "\n");
+
+            // check if more entries should be displayed
+            if(displayMax != DISPLAY_ALL)
+            {
+                displayCount++;
+                if(displayCount == displayMax)
+                {
+                    // max display count reached.
+                    // break out of this loop
+                    break;
+                }
+            }
+
+            entryIndex++;
+        }
+
+        //
+        // PRINT
+        //
+        // end of section
+        //
+        OutputBufferPrintf(output, "\n");
+    }
+    else
+    {
+        // this section is hidden
+    }
+}
+
+/**********************************************************/
+static void ResumePrintPlainTextFooter(
+    OutputBuffer_t* output)
+{
+    //
+    // PRINT
+    //
+    // footer
+    //
+    OutputBufferPrintf(output, "=======================================\n");
+    OutputBufferPrintf(output, "\n");
+}
+
+/**********************************************************/
+static Result_t ResumeFillSectionsFromJsonArray(
+    Resume_t* me,
+    const char* json)
+{
+    if(me->m_ResumeOptions.m_ThreadCount > 1)
+    {
+        return ResumeFillSectionsFromJsonArrayParallel(me, json);
+    }
+
+    return ResumeFillSectionsFromJsonArrayReusing(me, json, NULL, NULL);
+}
+
+/**********************************************************/
+static Result_t ResumeFillSectionsFromJsonArrayReusing(
+    Resume_t* me,
+    const char* json,
+    Resume_t* previous,
+    int* reusedCount)
+{
+    Result_t result = RESULT_OK;
+
+    if(reusedCount)
+    {
+        (*reusedCount) = 0;
+    }
+
+    SKIP_WHITESPACE(json);
+    if(json[0] == '[')
+    {
+        // sections array
+        JsonState_t jsonState = JSON_STATE_OK;
+        int jsonArrayIndex = INVALID_POSITION;
+        json = JsonArrayNextIndex((json + 1), &jsonArrayIndex, &jsonState); // recursive
+        if(jsonState == JSON_STATE_OK)
+        {
+            while(jsonArrayIndex != INVALID_POSITION)
+            {
+                if(json[0] == '{')
+                {
+                    JsonState_t objectState = JSON_STATE_OK;
+                    int objectLength = JsonObjectDataLength(json, &objectState); // recursive
+                    uint64_t fingerprint = HashFnv1a64(HASH_FNV64_OFFSET, json, objectLength);
+                    SectionData_t* previousData = NULL;
+                    Result_t fillResult;
+                    SectionData_t* sectionData;
+
+                    if((previous) && (objectState == JSON_STATE_OK))
+                    {
+                        previousData = ResumeFindSectionByFingerprint(previous, fingerprint);
+                    }
+                    else
+                    {
+                        // parse every section
+                    }
+
+                    sectionData = ResumeInsertSection(me, SECTION_AT_RUNTIME);
+                    if(sectionData == NULL)
+                    {
+                        // cannot insert a new section
+                        result = RESULT_ERROR;
+
+                        // break out of this loop
+                        break;
+                    }
+                    else
+                    {
+                        // a new section was created and
+                        // initialized. its index is
+                        // SECTION_AT_RUNTIME. if there
+                        // was already a section at that
+                        // index it can be found at
+                        // sectionData->m_SectionNext
+                    }
+
+                    if(previousData)
+                    {
+                        // this json object has not changed
+                        fillResult = SectionShare(sectionData, me, previousData);
+                        if((fillResult != RESULT_ERROR) && (reusedCount))
+                        {
+                            (*reusedCount)++;
+                        }
+                    }
+                    else
+                    {
+                        fillResult = ResumeFillSectionFromJsonObject(me, sectionData, json);
+                    }
+
+                    if(fillResult == RESULT_ERROR)
+                    {
+                        // cannot fill the section from
+                        // the json object data
+                        result = RESULT_ERROR;
+
+                        // remove the empty section data 
+                        // from the resume so it can be
+                        // deinited without removing any
+                        // sections that were already added
+                        ResumeRemoveSection(me, SECTION_AT_RUNTIME);
+                        SectionDataDeInit(sectionData);
+                        MemoryFree(sectionData);
+                        sectionData = NULL;
+
+                        // break out of this loop
+                        break;
+                    }
+                    else
+                    {
+                        // section filled
+                        sectionData->m_SectionFingerprint = fingerprint;
+                    }
+                }
+                else
+                {
+                    // not a json object.
+                    // this could be an error, but allow
+                    // this loop to try to skip to the next
+                    // array element
+                }
+
+                // skp to the next json array element
+                json = JsonArrayNextIndex(json, &jsonArrayIndex, &jsonState); // recursive
+                if(jsonState != JSON_STATE_OK)
+                {
+                    return RESULT_ERROR;
+                }
+            }
+            // done looping through all json array elements
+        }
+        else
+        {
+            // JsonArrayNextIndex() could not search for
+            // the first array index within the json data.
+            // check jsonState for the exact reason.
+            result = RESULT_ERROR;
+        }
+    }
+    else
+    {
+        // sections array should start with '['
+        result = RESULT_ERROR;
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillSectionsFromJsonArrayParallel(
+    Resume_t* me,
+    const char* json)
+{
+    SectionParser_t parser;
+    Result_t result;
+
+    SectionParserInit(&parser, &me->m_ResumeOptions);
+    result = SectionParserFindSections(&parser, json);
+    if(result == RESULT_OK)
+    {
+        SectionParserRun(&parser, me->m_ResumeOptions.m_ThreadCount);
+        result = SectionParserLink(&parser, me);
+    }
+    else
+    {
+        // not a json sections array
+    }
+    SectionParserDeInit(&parser);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillSectionFromJsonObject(
+    Resume_t* me,
+    SectionData_t* sectionData,
+    const char* json)
+{
+    Result_t result = RESULT_OK;
+    int64_t start = TraceBegin();
+
+    SKIP_WHITESPACE(json);
+    if(json[0] == '{')
+    {
+        // section object
+        JsonState_t jsonState = JSON_STATE_OK;
+        const char* key;
+        int keyLength;
+        const char* nextKey;
+        int nextKeyLength;
+        const char* value;
+        int valueLength;
+        OutputBuffer_t scratch;
+
+        // only used when a string must be decoded
+        OutputBufferInit(&scratch);
+
+        json = JsonSkipToNextValue((json + 1), &key, &keyLength, &jsonState);
+        while(keyLength > 2)
+        {
+            value = json;
+            valueLength = JsonValueDataLength(json, &jsonState);
+            if(valueLength == 0)
+            {
+                // value is missing
+                result = RESULT_ERROR;
+                break;
+            }
+            json = JsonSkipToNextValue((json + valueLength), &nextKey, &nextKeyLength, &jsonState);
+
+            // skip the quotes around the key
+            switch(ResumeStringFind((key + 1), (keyLength - 2)))
+            {
+            case RESUME_STRING_ID_NAME:
+            {
+                const char* title;
+                int titleLength;
+                if(JsonStringGetText(value, valueLength, &scratch, &title, &titleLength, &jsonState) == RESULT_OK)
+                {
+                    if(SectionDataSetTitleSubstr(sectionData, title, titleLength) == RESULT_ERROR)
+                    {
+                        result = RESULT_ERROR;
+                    }
+                }
+                else
+                {
+                    // invalid string
+                    result = RESULT_ERROR;
+                }
+            }
+            break;
+
+            case RESUME_STRING_ID_DATE_ORDER:
+            {
+                if(valueLength >= 2)
+                {
+                    switch(ResumeStringFind((value + 1), (valueLength - 2)))
+                    {
+                    case RESUME_STRING_ID_DATE_START: sectionData->m_SectionOrderEntryTime = ENTRY_TIME_START; break;
+                    case RESUME_STRING_ID_DATE_END:   sectionData->m_SectionOrderEntryTime = ENTRY_TIME_END;   break;
+                    default:                          /* unknown entry time */                              break;
+                    }
+                }
+            }
+            break;
+
+            case RESUME_STRING_ID_DATE_OPTION:
+            {
+                if(valueLength >= 2)
+                {
+                    if(ResumeStringFind((value + 1), (valueLength - 2)) == RESUME_STRING_ID_SHOW_YEAR_ONLY)
+                    {
+                        sectionData->m_SectionDateOption = DATE_OPTION_SHOW_YEAR_ONLY;
+                    }
+                }
+            }
+            break;
+
+            case RESUME_STRING_ID_DISPLAY_MAX:
+            {
+                int displayMax;
+                int numberLength;
+                if((StringToInt(value, valueLength, &displayMax, &numberLength) == RESULT_OK) &&
+                   (numberLength == valueLength))
+                {
+                    sectionData->m_SectionDisplayMax = displayMax;
+                }
+                else
+                {
+                    // parsing failed or
+                    // display max does not fit in an int
+                    result = RESULT_ERROR;
+                }
+            }
+            break;
+
+            case RESUME_STRING_ID_ORDER:
+            {
+                if(valueLength >= 2)
+                {
+                    switch(ResumeStringFind((value + 1), (valueLength - 2)))
+                    {
+                    case RESUME_STRING_ID_NEWEST_FIRST: sectionData->m_SectionOrder = ORDER_NEWEST_FIRST; break;
+                    case RESUME_STRING_ID_OLDEST_FIRST: sectionData->m_SectionOrder = ORDER_OLDEST_FIRST; break;
+                    case RESUME_STRING_ID_RANDOM:       sectionData->m_SectionOrder = ORDER_RANDOM;       break;
+                    default:                            /* unknown order */                               break;
+                    }
+                }
+            }
+            break;
+
+            case RESUME_STRING_ID_ENTRIES:
+            {
+                if(ResumeFillEntriesFromJsonArray(me, sectionData, value) == RESULT_ERROR)
+                {
+                    result = RESULT_ERROR;
+                }
+            }
+            break;
+
+            default:
+            {
+                // unknown keys are ignored
+            }
+            break;
+            }
+
+            key = nextKey;
+            keyLength = nextKeyLength;
+        }
+        // done looping through all json object values
+
+        OutputBufferDeInit(&scratch);
+
+        // section options were changed directly
+        me->m_ResumeGeneration++;
+    }
+    else
+    {
+        // section object should start with '{'
+        result = RESULT_ERROR;
+    }
+
+    TraceEnd(TRACE_SPAN_PARSE, sectionData->m_SectionTitle, sectionData->m_SectionEntries.m_EntriesUsed, start);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillEntriesFromJsonArray(
+    Resume_t* me, 
+    SectionData_t* sectionData,
+    const char* json)
+{
+    Result_t result = RESULT_OK;
+    int64_t start = TraceBegin();
+    int firstEntry = sectionData->m_SectionEntries.m_EntriesUsed;
+
+    SKIP_WHITESPACE(json);
+    if(json[0] == '[')
+    {
+        // entries array
+        JsonState_t jsonState = JSON_STATE_OK;
+        int jsonArrayIndex = INVALID_POSITION;
+        OutputBuffer_t scratch;
+
+        // only used when entry text must be decoded.
+        // reused for every entry in the array
+        OutputBufferInit(&scratch);
+
+        json = JsonArrayNextIndex((json + 1), &jsonArrayIndex, &jsonState); // recursive
+        if(jsonState == JSON_STATE_OK)
+        {
+            while(jsonArrayIndex != INVALID_POSITION)
+            {
+                if(json[0] == '{')
+                {
+                    // entry object
+                    const char* nextJson;
+                    const char* key;
+                    int keyLength;
+                    const char* nextKey;
+                    int nextKeyLength;
+                    const char* value;
+                    int valueLength;
+                    const char* text = NULL;
+                    int textLength = 0;
+                    Result_t textResult = RESULT_OK;
+                    const char* startDate = NULL;
+                    const char* endDate = NULL;
+
+                    nextJson = JsonSkipToNextValue((json + 1), &key, &keyLength, &jsonState);
+                    while(keyLength > 2)
+                    {
+                        value = nextJson;
+                        valueLength = JsonValueDataLength(nextJson, &jsonState);
+                        if(valueLength == 0)
+                        {
+                            // value is missing
+                            result = RESULT_ERROR;
+                            break;
+                        }
+                        nextJson = JsonSkipToNextValue((nextJson + valueLength), &nextKey, &nextKeyLength, &jsonState);
+
+                        // skip the quotes around the key
+                        switch(ResumeStringFind((key + 1), (keyLength - 2)))
+                        {
+                        case RESUME_STRING_ID_TEXT:
+                        {
+                            textResult = JsonStringGetText(value, valueLength, &scratch, &text, &textLength, &jsonState);
+                            if(textResult == RESULT_ERROR)
+                            {
+                                // invalid string
+                                result = RESULT_ERROR;
+                                text = NULL;
+                            }
+                        }
+                        break;
+
+                        case RESUME_STRING_ID_DATE_START:
+                        {
+                            if(valueLength > 2)
+                            {
+                                startDate = value + 1;
+                            }
+                        }
+                        break;
+
+                        case RESUME_STRING_ID_DATE_END:
+                        {
+                            if(valueLength > 2)
+                            {
+                                endDate = value + 1;
+                            }
+                        }
+                        break;
+
+                        default:
+                        {
+                            // unknown keys are ignored
+                        }
+                        break;
+                        }
+
+                        key = nextKey;
+                        keyLength = nextKeyLength;
+                    }
+                    // done looping through all json object values
+
+                    if(textResult == RESULT_ERROR)
+                    {
+                        // the text is there, but it could not
+                        // be decoded so it is not reported
+                        // as missing
+                        me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_TEXT_INVALID;
+                        me->m_ResumeErrorInSection = ResumeGetSectionIndex(me, sectionData);
+                    }
+                    else if(SectionAddEntry(sectionData, me, text, textLength, startDate, endDate) == RESULT_ERROR)
+                    {
+                        result = RESULT_ERROR;
+                    }
+                }
+                else
+                {
+                    // not a json object.
+                    // this could be an error, but allow
+                    // this loop to try to skip to the next
+                    // array element
+                }
+
+                // skip to the next json array element
+                json = JsonArrayNextIndex(json, &jsonArrayIndex, &jsonState); // recursive
+                if(jsonState != JSON_STATE_OK)
+                {
+                    result = RESULT_ERROR;
+                }
+            }
+            // done looping through all json array elements
+        }
+        else
+        {
+            // JsonArrayNextIndex() could not search for
+            // the first array index within the json data.
+            // check jsonState for the exact reason.
+            result = RESULT_ERROR;
+        }
+
+        OutputBufferDeInit(&scratch);
+    }
+    else
+    {
+        // entries array should start with '['
+        result = RESULT_ERROR;
+    }
+
+    // the title is not known yet when the entries come
+    // before the name of the section
+    TraceEnd(TRACE_SPAN_ENTRIES, sectionData->m_SectionTitle, (sectionData->m_SectionEntries.m_EntriesUsed - firstEntry), start);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillFromSnapshot(
+    Resume_t* me,
+    const char* path)
+{
+    Result_t result = RESULT_ERROR;
+    Snapshot_t* snapshot;
+
+    if(me->m_ResumeSnapshot)
+    {
+        // already filled from a snapshot
+        return RESULT_ERROR;
+    }
+
+    snapshot = (Snapshot_t*)malloc(sizeof(Snapshot_t));
+    if(snapshot == NULL)
+    {
+        // failed to allocate snapshot
+        return RESULT_ERROR;
+    }
+    SnapshotInit(snapshot);
+
+    if(SnapshotOpen(snapshot, path) == RESULT_OK)
+    {
+        const SnapshotHeader_t* header = (const SnapshotHeader_t*)snapshot->m_SnapshotData;
+        if((memcmp(header->m_SnapshotMagic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0) &&
+           (header->m_SnapshotVersion == SNAPSHOT_VERSION) &&
+           (header->m_SnapshotByteOrder == SNAPSHOT_BYTE_ORDER) &&
+           (header->m_SnapshotSize == (uint32_t)snapshot->m_SnapshotSize) &&
+           (SnapshotCheckTable(snapshot, header->m_SnapshotSectionOffset, header->m_SnapshotSectionCount, sizeof(SnapshotSection_t)) == RESULT_OK) &&
+           (SnapshotCheckTable(snapshot, header->m_SnapshotEntryOffset, header->m_SnapshotEntryCount, sizeof(SnapshotEntry_t)) == RESULT_OK) &&
+           (SnapshotCheckTable(snapshot, header->m_SnapshotPoolOffset, header->m_SnapshotPoolSize, 1) == RESULT_OK))
+        {
+            // the resume owns the snapshot from here
+            // because its entries use the string pool
+            me->m_ResumeSnapshot = snapshot;
+            result = ResumeFillFromSnapshotTables(
+                me,
+                (const SnapshotSection_t*)&snapshot->m_SnapshotData[header->m_SnapshotSectionOffset],
+                (int)header->m_SnapshotSectionCount,
+                (const SnapshotEntry_t*)&snapshot->m_SnapshotData[header->m_SnapshotEntryOffset],
+                (int)header->m_SnapshotEntryCount,
+                &snapshot->m_SnapshotData[header->m_SnapshotPoolOffset],
+                (int)header->m_SnapshotPoolSize);
+        }
+        else
+        {
+            // not a snapshot this program can read
+        }
+    }
+    else
+    {
+        // cannot open the snapshot
+    }
+
+    if(me->m_ResumeSnapshot != snapshot)
+    {
+        // snapshot was not used
+        SnapshotClose(snapshot);
+        free(snapshot);
+    }
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillFromSnapshotTables(
+    Resume_t* me,
+    const SnapshotSection_t* sections,
+    int sectionCount,
+    const SnapshotEntry_t* entries,
+    int entryCount,
+    const char* pool,
+    int poolSize)
+{
+    Result_t result = RESULT_OK;
+    int index;
+
+    if((me->m_ResumeSnapshotEntries) ||
+       (sectionCount < 0) ||
+       (entryCount < 0))
+    {
+        // already filled or invalid tables
+        return RESULT_ERROR;
+    }
+
+    // check every record before creating anything so a
+    // corrupt snapshot cannot leave a partial resume
+    index = 0;
+    while((index < sectionCount) && (result == RESULT_OK))
+    {
+        const SnapshotSection_t* section = &sections[index];
+        if((SnapshotCheckString(pool, poolSize, section->m_SnapshotTitleOffset, section->m_SnapshotTitleLength) != RESULT_OK) ||
+           (((uint64_t)section->m_SnapshotFirstEntry + section->m_SnapshotEntryCount) > (uint64_t)entryCount) ||
+           (section->m_SnapshotOrder < 0) ||
+           (section->m_SnapshotOrder >= ORDER_COUNT) ||
+           (section->m_SnapshotOrderEntryTime < 0) ||
+           (section->m_SnapshotOrderEntryTime >= ENTRY_TIME_COUNT) ||
+           (section->m_SnapshotDateOption > DATE_OPTION_ALL))
+        {
+            // invalid section
+            me->m_ResumeErrorInSection = index;
+            result = RESULT_ERROR;
+        }
+        index++;
+    }
+
+    index = 0;
+    while((index < entryCount) && (result == RESULT_OK))
+    {
+        const SnapshotEntry_t* entry = &entries[index];
+        if((entry->m_SnapshotTextLength == 0) ||
+           (SnapshotCheckString(pool, poolSize, entry->m_SnapshotTextOffset, entry->m_SnapshotTextLength) != RESULT_OK))
+        {
+            // empty text is not allowed
+            me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_TEXT_EMPTY;
+            result = RESULT_ERROR;
+        }
+        index++;
+    }
+
+    if((result == RESULT_OK) && (entryCount > 0))
+    {
+        // a single allocation for every entry
+        me->m_ResumeSnapshotEntries = (Entry_t*)MemoryAlloc(MEMORY_ENTRIES, sizeof(Entry_t) * entryCount);
+        if(me->m_ResumeSnapshotEntries)
+        {
+            index = 0;
+            do
+            {
+                const SnapshotEntry_t* snapshotEntry = &entries[index];
+                Entry_t* entry = &me->m_ResumeSnapshotEntries[index];
+                int entryTime = 0;
+                entry->m_EntryText = (char*)&pool[snapshotEntry->m_SnapshotTextOffset];
+                do
+                {
+                    entry->m_EntryTimestamp[entryTime] = (time_t)snapshotEntry->m_SnapshotTimestamp[entryTime];
+                    entryTime++;
+                }
+                while(entryTime < ENTRY_TIME_COUNT);
+                index++;
+            }
+            while(index < entryCount);
+        }
+        else
+        {
+            // failed to allocate entries
+            me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_ALLOC;
+            result = RESULT_ERROR;
+        }
+    }
+
+    // runtime sections are inserted at the start of the
+    // linked-list so create them from last to first
+    index = sectionCount;
+    while((index > 0) && (result == RESULT_OK))
+    {
+        const SnapshotSection_t* section;
+        SectionData_t* sectionData;
+
+        index--;
+        section = &sections[index];
+        if(index < SECTION_COUNT)
+        {
+            sectionData = &me->m_ResumeSection[index];
+        }
+        else
+        {
+            sectionData = ResumeInsertSection(me, SECTION_AT_RUNTIME);
+        }
+
+        if(sectionData)
+        {
+            if(SectionDataSetTitleSubstr(sectionData, &pool[section->m_SnapshotTitleOffset], (int)section->m_SnapshotTitleLength) == RESULT_ERROR)
+            {
+                result = RESULT_ERROR;
+            }
+            sectionData->m_SectionDisplayMax = section->m_SnapshotDisplayMax;
+            sectionData->m_SectionOrder = (Order_t)section->m_SnapshotOrder;
+            sectionData->m_SectionOrderEntryTime = (EntryTime_t)section->m_SnapshotOrderEntryTime;
+            sectionData->m_SectionDateOption = (DateOption_t)section->m_SnapshotDateOption;
+
+            if(section->m_SnapshotEntryCount > 0)
+            {
+                // random sections are shuffled again
+                // by every run
+                if(SectionDataIncludeEntries(
+                       sectionData,
+                       &me->m_ResumeSnapshotEntries[section->m_SnapshotFirstEntry],
+                       (int)section->m_SnapshotEntryCount,
+                       (sectionData->m_SectionOrder != ORDER_RANDOM) ? RESULT_YES : RESULT_NO) == RESULT_ERROR)
+                {
+                    me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_RESIZE;
+                    result = RESULT_ERROR;
+                }
+            }
+        }
+        else
+        {
+            // cannot insert the section
+            result = RESULT_ERROR;
+        }
+
+        if(result == RESULT_ERROR)
+        {
+            me->m_ResumeErrorInSection = index;
+        }
+    }
+
+    // hard-coded sections were changed directly
+    me->m_ResumeGeneration++;
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeWriteSnapshot(
+    Resume_t* me,
+    OutputBuffer_t* output)
+{
+    Result_t result = RESULT_OK;
+    OutputBuffer_t sectionTable;
+    OutputBuffer_t entryTable;
+    OutputBuffer_t pool;
+    SnapshotHeader_t header;
+    uint32_t entryCount = 0;
+    Section_t section = 0;
+    SectionData_t* sectionData = ResumeGetSectionData(me, section);
+
+    OutputBufferInit(&sectionTable);
+    OutputBufferInit(&entryTable);
+    OutputBufferInit(&pool);
+
+    while((sectionData) && (result == RESULT_OK))
+    {
+        SnapshotSection_t snapshotSection;
+        Entries_t* entries;
+
+        if(sectionData->m_SectionOrder == ORDER_RANDOM)
+        {
+            // save the entries in the order added so
+            // each run can shuffle them
+            entries = &sectionData->m_SectionEntries;
+        }
+        else
+        {
+            // save the entries already sorted
+            entries = SectionDataGetOrderedEntries(sectionData);
+        }
+
+        if(entries)
+        {
+            int entryIndex = 0;
+
+            memset(&snapshotSection, 0, sizeof(snapshotSection));
+            snapshotSection.m_SnapshotTitleOffset = (uint32_t)pool.m_OutputLength;
+            snapshotSection.m_SnapshotTitleLength = (uint32_t)strlen(sectionData->m_SectionTitle);
+            snapshotSection.m_SnapshotDisplayMax = sectionData->m_SectionDisplayMax;
+            snapshotSection.m_SnapshotOrder = sectionData->m_SectionOrder;
+            snapshotSection.m_SnapshotOrderEntryTime = sectionData->m_SectionOrderEntryTime;
+            snapshotSection.m_SnapshotDateOption = sectionData->m_SectionDateOption;
+            snapshotSection.m_SnapshotFirstEntry = entryCount;
+            snapshotSection.m_SnapshotEntryCount = (uint32_t)entries->m_EntriesUsed;
+
+            // include the null-terminator so the text can
+            // be used directly from the string pool
+            OutputBufferAppend(&pool, sectionData->m_SectionTitle, (int)(snapshotSection.m_SnapshotTitleLength + 1));
+            OutputBufferAppend(&sectionTable, (const char*)&snapshotSection, sizeof(snapshotSection));
+
+            while(entryIndex < entries->m_EntriesUsed)
+            {
+                Entry_t* entry = entries->m_Entries[entryIndex];
+                SnapshotEntry_t snapshotEntry;
+                int entryTime = 0;
+
+                memset(&snapshotEntry, 0, sizeof(snapshotEntry));
+                do
+                {
+                    snapshotEntry.m_SnapshotTimestamp[entryTime] = (int64_t)entry->m_EntryTimestamp[entryTime];
+                    entryTime++;
+                }
+                while(entryTime < ENTRY_TIME_COUNT);
+                snapshotEntry.m_SnapshotTextOffset = (uint32_t)pool.m_OutputLength;
+                snapshotEntry.m_SnapshotTextLength = (uint32_t)strlen(entry->m_EntryText);
+
+                OutputBufferAppend(&pool, entry->m_EntryText, (int)(snapshotEntry.m_SnapshotTextLength + 1));
+                OutputBufferAppend(&entryTable, (const char*)&snapshotEntry, sizeof(snapshotEntry));
+                entryCount++;
+                entryIndex++;
+            }
+        }
+        else
+        {
+            // cannot order the entries
+            me->m_ResumeErrorInSection = section;
+            result = RESULT_ERROR;
+        }
+
+        section++;
+        sectionData = ResumeGetSectionData(me, section);
+    }
+
+    if((sectionTable.m_OutputResult == RESULT_ERROR) ||
+       (entryTable.m_OutputResult == RESULT_ERROR) ||
+       (pool.m_OutputResult == RESULT_ERROR))
+    {
+        // failed to write a table
+        result = RESULT_ERROR;
+    }
+
+    if(result == RESULT_OK)
+    {
+        // the header and every record are a multiple of
+        // SNAPSHOT_ALIGNMENT so each table stays aligned
+        // when written one after the other
+        memset(&header, 0, sizeof(header));
+        memcpy(header.m_SnapshotMagic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        header.m_SnapshotVersion = SNAPSHOT_VERSION;
+        header.m_SnapshotByteOrder = SNAPSHOT_BYTE_ORDER;
+        header.m_SnapshotSectionCount = (uint32_t)section;
+        header.m_SnapshotSectionOffset = (uint32_t)sizeof(header);
+        header.m_SnapshotEntryCount = entryCount;
+        header.m_SnapshotEntryOffset = header.m_SnapshotSectionOffset + (uint32_t)sectionTable.m_OutputLength;
+        header.m_SnapshotPoolSize = (uint32_t)pool.m_OutputLength;
+        header.m_SnapshotPoolOffset = header.m_SnapshotEntryOffset + (uint32_t)entryTable.m_OutputLength;
+        header.m_SnapshotSize = header.m_SnapshotPoolOffset + header.m_SnapshotPoolSize;
+
+        OutputBufferAppend(output, (const char*)&header, sizeof(header));
+        OutputBufferAppend(output, sectionTable.m_OutputData, sectionTable.m_OutputLength);
+        OutputBufferAppend(output, entryTable.m_OutputData, entryTable.m_OutputLength);
+        OutputBufferAppend(output, pool.m_OutputData, pool.m_OutputLength);
+        result = output->m_OutputResult;
+    }
+
+    OutputBufferDeInit(&sectionTable);
+    OutputBufferDeInit(&entryTable);
+    OutputBufferDeInit(&pool);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeWriteGenerated(
+    Resume_t* me,
+    OutputBuffer_t* output)
+{
+    // the generated tables are the snapshot tables
+    // written as c source so both load the same way
+    OutputBuffer_t snapshot;
+    Result_t result;
+
+    OutputBufferInit(&snapshot);
+    result = ResumeWriteSnapshot(me, &snapshot);
+    if(result == RESULT_OK)
+    {
+        const SnapshotHeader_t* header = (const SnapshotHeader_t*)snapshot.m_OutputData;
+        const SnapshotSection_t* sections = (const SnapshotSection_t*)&snapshot.m_OutputData[header->m_SnapshotSectionOffset];
+        const SnapshotEntry_t* entries = (const SnapshotEntry_t*)&snapshot.m_OutputData[header->m_SnapshotEntryOffset];
+        const char* pool = &snapshot.m_OutputData[header->m_SnapshotPoolOffset];
+        uint32_t index;
+
+        OutputBufferPrintf(output, "/*\n");
+        OutputBufferPrintf(output, "    generated by %s Resume v%d.%02d.%02d --generate\n", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+        OutputBufferPrintf(output, "    build with RESUME_GENERATED_DATA set to the\n");
+        OutputBufferPrintf(output, "    quoted path of this file. do not edit\n");
+        OutputBufferPrintf(output, "*/\n\n");
+
+        // section table.
+        // see SnapshotSection_s for the field order
+        OutputBufferPrintf(output, "#define RESUME_GENERATED_SECTION_COUNT %u\n\n", (unsigned int)header->m_SnapshotSectionCount);
+        OutputBufferPrintf(output, "static const SnapshotSection_t g_GeneratedSections[RESUME_GENERATED_SECTION_COUNT + 1] =\n{\n");
+        index = 0;
+        while(index < header->m_SnapshotSectionCount)
+        {
+            const SnapshotSection_t* section = &sections[index];
+            OutputBufferPrintf(output, "    { %uu, %uu, %d, %d, %d, %uu, %uu, %uu },\n",
+                (unsigned int)section->m_SnapshotTitleOffset,
+                (unsigned int)section->m_SnapshotTitleLength,
+                (int)section->m_SnapshotDisplayMax,
+                (int)section->m_SnapshotOrder,
+                (int)section->m_SnapshotOrderEntryTime,
+                (unsigned int)section->m_SnapshotDateOption,
+                (unsigned int)section->m_SnapshotFirstEntry,
+                (unsigned int)section->m_SnapshotEntryCount);
+            index++;
+        }
+        // extra record so the table is never empty.
+        // every field is written so -Wextra does not
+        // warn about missing initializers
+        OutputBufferPrintf(output, "    { 0u, 0u, 0, 0, 0, 0u, 0u, 0u }\n};\n\n");
+
+        // entry table with precomputed timestamps.
+        // see SnapshotEntry_s for the field order
+        OutputBufferPrintf(output, "#define RESUME_GENERATED_ENTRY_COUNT %u\n\n", (unsigned int)header->m_SnapshotEntryCount);
+        OutputBufferPrintf(output, "static const SnapshotEntry_t g_GeneratedEntries[RESUME_GENERATED_ENTRY_COUNT + 1] =\n{\n");
+        index = 0;
+        while(index < header->m_SnapshotEntryCount)
+        {
+            const SnapshotEntry_t* entry = &entries[index];
+            OutputBufferPrintf(output, "    { { %lld, %lld }, %uu, %uu },\n",
+                (long long)entry->m_SnapshotTimestamp[ENTRY_TIME_START],
+                (long long)entry->m_SnapshotTimestamp[ENTRY_TIME_END],
+                (unsigned int)entry->m_SnapshotTextOffset,
+                (unsigned int)entry->m_SnapshotTextLength);
+            index++;
+        }
+        // extra record so the table is never empty
+        OutputBufferPrintf(output, "    { { 0, 0 }, 0u, 0u }\n};\n\n");
+
+        // string pool with one string per line.
+        // the null-terminator of the last string is
+        // added by the compiler
+        OutputBufferPrintf(output, "#define RESUME_GENERATED_POOL_SIZE %u\n\n", (unsigned int)header->m_SnapshotPoolSize);
+        OutputBufferPrintf(output, "static const char g_GeneratedPool[RESUME_GENERATED_POOL_SIZE + 1] =\n    \"");
+        index = 0;
+        while((index + 1) < header->m_SnapshotPoolSize)
+        {
+            unsigned char c = (unsigned char)pool[index];
+            if(c == '\0')
+            {
+                OutputBufferPrintf(output, "\\000\"\n    \"");
+            }
+            else if((c == '"') || (c == '\\') || (c == '?'))
+            {
+                // '?' is escaped so no trigraphs are formed
+                OutputBufferPrintf(output, "\\%c", c);
+            }
+            else if((c >= ' ') && (c <= '~'))
+            {
+                OutputBufferAppend(output, (const char*)&c, 1);
+            }
+            else
+            {
+                // 3 octal digits so a following
+                // digit is not part of the escape
+                OutputBufferPrintf(output, "\\%03o", (unsigned int)c);
+            }
+            index++;
+        }
+        OutputBufferPrintf(output, "\";\n");
+
+        result = output->m_OutputResult;
+    }
+    OutputBufferDeInit(&snapshot);
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillHardCoded(
+    Resume_t* me)
+{
+    if(ResumeFillSectionsFromHardCoded(me) != RESULT_OK)
+    {
+        return RESULT_ERROR;
+    }
+
+    if(ResumeFillEntriesFromHardCoded(me) != RESULT_OK)
+    {
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t ResumeFillSectionsFromHardCoded(
+    Resume_t* me)
+{
+    Result_t result = RESULT_OK;
+
+    //
+    // set title for each hard-coded section
+    //
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_EXPERIENCE], "Experience") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_EXPERIENCE;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_WORK_HISTORY], "Work History") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_WORK_HISTORY;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_INTERESTS], "Interests") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_INTERESTS;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_EDUCATION], "Education") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_EDUCATION;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_TOOLS], "Tools") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_TOOLS;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_ACCOMPLISHMENTS], "Accomplishments") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_ACCOMPLISHMENTS;
+        result = RESULT_ERROR;
+    }
+    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_PROJECTS], "Projects") == RESULT_ERROR)
+    {
+        me->m_ResumeErrorInSection = SECTION_PROJECTS;
+        result = RESULT_ERROR;
+    }
+
+    //
+    // set section sort options
+    //
+    // default order is ORDER_NEWEST_FIRST
+    // default entry time is ENTRY_TIME_START
+    me->m_ResumeSection[SECTION_EDUCATION].m_SectionOrderEntryTime   = ENTRY_TIME_END;
+    me->m_ResumeSection[SECTION_INTERESTS].m_SectionOrder       = ORDER_RANDOM;
+    me->m_ResumeSection[SECTION_TOOLS].m_SectionOrder           = ORDER_RANDOM;
+    me->m_ResumeSection[SECTION_ACCOMPLISHMENTS].m_SectionOrder = ORDER_RANDOM;
+    me->m_ResumeSection[SECTION_PROJECTS].m_SectionOrder        = ORDER_RANDOM;
+
+    //
+    // set max entries to display
+    //
+    // default is DISPLAY_ALL
+    me->m_ResumeSection[SECTION_EXPERIENCE].m_SectionDisplayMax      = 6;
+    me->m_ResumeSection[SECTION_INTERESTS].m_SectionDisplayMax       = 5;
+    me->m_ResumeSection[SECTION_ACCOMPLISHMENTS].m_SectionDisplayMax = 5;
+    me->m_ResumeSection[SECTION_PROJECTS].m_SectionDisplayMax        = 5;
+
+    //
+    // set date information to display
+    //
+    // default is DATE_OPTION_HIDE_ALL
+    me->m_ResumeSection[SECTION_WORK_HISTORY].m_SectionDateOption = DATE_OPTION_SHOW_YEAR_ONLY;
+    me->m_ResumeSection[SECTION_EXPERIENCE].m_SectionDateOption   = DATE_OPTION_SHOW_START_ONLY | DATE_OPTION_HIDE_START_DAY;
+    me->m_ResumeSection[SECTION_EDUCATION].m_SectionDateOption    = DATE_OPTION_SHOW_END_ONLY | DATE_OPTION_SHOW_YEAR_ONLY;
+
+    // section options were changed directly
+    me->m_ResumeGeneration++;
+
+    return result;
+}
+
+/**********************************************************/
+static Result_t ResumeFillEntriesFromHardCoded(
+    Resume_t* me)
+{
+    Result_t result = RESULT_OK;
+    Section_t section;
+
+    // using INVALID_POSITION to indicate no errors
+    me->m_ResumeErrorInSection = INVALID_POSITION;
+
+    // using ENTRY_STATE_OK to indicate no entry errors have occured
+    me->m_ResumeErrorInEntry = ENTRY_STATE_OK;
+
+    //
+    // add entries to each section
+    //
+
+    section = SECTION_ACCOMPLISHMENTS;
+    ResumeAddEntry(me, section, "Coldfire bare-metal Ethernet driver using ring-buffer and DMA",                                         NULL, NULL);
+    ResumeAddEntry(me, section, "static memory TCP/IP library for Atmel and ported to Coldfire and AM335X (Sitara)",                     NULL, NULL);
+    ResumeAddEntry(me, section, "FAT32 library with long file name support for Atmel and ported to Coldfire and AM335X (Sitara)",        NULL, NULL);
+    ResumeAddEntry(me, section, "multi-screen touch panel GUI editor including integration with UDP data from controllers",              NULL, NULL);
+    ResumeAddEntry(me, section, "Blackfin ucLinux kernel modules for SPI and SPORT (TDM) communication with two CS42448",                NULL, NULL);
+    ResumeAddEntry(me, section, "custom board with TI CC3200 module for remote HVAC 24VAC and differential pressure monitoring",         NULL, NULL);
+    ResumeAddEntry(me, section, "iOS app for local network communication and file transfer with HVAC monitor",                           NULL, NULL);
+    ResumeAddEntry(me, section, "frame-accurate sequence timeline rendering with collapsible groups and interactive media scrubbing",    NULL, NULL);
+    ResumeAddEntry(me, section, "communication protocol and audio status monitoring for on-board ride vehicle audio player",             NULL, NULL);
+    ResumeAddEntry(me, section, "automatic detection of network modules and mounting of NFS shares for multichannel audio/video player", NULL, NULL);
+    ResumeAddEntry(me, section, "remote firmware update capability for uBoot and Linux on Blackfin",                                     NULL, NULL);
+    ResumeAddEntry(me, section, "multi-channel WAV and MP3 audio playback control and configuration software",                           NULL, NULL);
+    ResumeAddEntry(me, section, "reliable transfer of image files over Modbus using sequenced data chunks with CRC16",                   NULL, NULL);
+    ResumeAddEntry(me, section, "complete XML reader / writer with integrated motification history tracker",                             NULL, NULL);
+    ResumeAddEntry(me, section, "closed over 500 customer and end-user support tickets",                                                 NULL, NULL);
+    ResumeAddEntry(me, section, "integrated 3rd party lighting controller with train signals over the Tempe Salt River bridge",          NULL, NULL);
+
+    section = SECTION_INTERESTS;
+    ResumeAddEntry(me, section, "Video Games - Dr Mario",                 NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Astro Bot",                NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Stormworks",               NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Bloons TD 6",              NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Civilization VI",          NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Donut County",             NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Minecraft",                NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Teardown",                 NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Everybody's Golf",         NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Border Bots VR",           NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Just Cause 3",             NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - TMNT: Shredder's Revenge", NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Rogue Tower",              NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Sanctum",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Command & Conquer",        NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Homeworld",                NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Super Smash Brothers",     NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Mario Kart 8",             NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Portal",                   NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - LEGO City Undercover",     NULL, NULL);
+    ResumeAddEntry(me, section, "Video Games - Worms Armageddon",         NULL, NULL);
+
+    ResumeAddEntry(me, section, "Sports - Flag Football", NULL, NULL);
+    ResumeAddEntry(me, section, "Sports - Basketball",    NULL, NULL);
+    ResumeAddEntry(me, section, "Sports - Tae Kwon Do",   NULL, NULL);
+    ResumeAddEntry(me, section, "Sports - Racquetball",   NULL, NULL);
+    ResumeAddEntry(me, section, "Sports - Crossfit",      NULL, NULL);
+    ResumeAddEntry(me, section, "Sports - Fun Run/Walk",  NULL, NULL);
+
+    ResumeAddEntry(me, section, "Movies - Rat Race",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Stargate",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Robin Hood: Men in Tights", NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Despicable Me",             NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Down Periscope",            NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Crazy Rich Asians",         NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - The Last Samurai",          NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - LEGO Movie",                NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Tron: Legacy",              NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Mars Attacks",              NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Demolition Man",            NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Harry Potter",              NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Lord of the Rings",         NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - First Knight",              NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Gaurdians of the Galaxy",   NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Contact",                   NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Hotel Transylvania",        NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Idiocracy",                 NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Independence Day",          NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - John Carter",               NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Inside Out",                NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Jurassic Park",             NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Pitch Perfect",             NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - TMNT",                      NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Trolls",                    NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Valerian",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - The Fifth Element",         NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - The Matrix",                NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - The Hunt for Red October",  NULL, NULL);
+    ResumeAddEntry(me, section, "Movies - Groundhog Day",             NULL, NULL);
+
+    ResumeAddEntry(me, section, "Music - Noisestorm",           NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Stray Kids",           NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Robert Miles",         NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Sofi Tucker",          NULL, NULL);
+    ResumeAddEntry(me, section, "Music - They Might be Giants", NULL, NULL);
+    ResumeAddEntry(me, section, "Music - BTS",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Aespa",                NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Miami Sound Machine",  NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Vangelis",             NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Daft Punk",            NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Lionel Richie",        NULL, NULL);
+    ResumeAddEntry(me, section, "Music - The Black Eyed Peas",  NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Olive",                NULL, NULL);
+    ResumeAddEntry(me, section, "Music - Sade",                 NULL, NULL);
+
+    section = SECTION_WORK_HISTORY;
+    ResumeAddEntry(me, section, "Alcorn McBride",                       "2006-02-06", NULL);
+
+    section = SECTION_EDUCATION;
+    ResumeAddEntry(me, section, "Bachelor of Science - Computer Science - Stetson University", "1999-08-01", "2003-05-01");
+
+    section = SECTION_EXPERIENCE;
+    ResumeAddEntry(me, section, "add feature to adjust panel pc rotation by integrating a Powershell script with an existing Qt application",         "2024-01-01", NULL);
+    ResumeAddEntry(me, section, "fix bug in Product File Creator where user defined spaces were being stripped from the final output",                "2024-03-01", NULL);
+    ResumeAddEntry(me, section, "fix script import bugs that allowed script password to be bypassed",                                                 "2024-08-01", NULL);
+    ResumeAddEntry(me, section, "fix script import bugs to identify when literals are used in place of variables for \"if\" events",                  "2024-08-01", NULL);
+    ResumeAddEntry(me, section, "guide junior developer to integrate timecode conversion function into expression parser",                            "2024-09-01", NULL);
+    ResumeAddEntry(me, section, "generate jenkins pipelines for RideAmp and VPage Utils projects for Visual Studio 2022",                             "2024-11-01", NULL);
+    ResumeAddEntry(me, section, "allow expression parser to include variable names with special characters and spaces",                               "2023-04-01", NULL);
+    ResumeAddEntry(me, section, "fix memory leak in one-shot sequences by tracing the code paths used to allocate each event",                        "2023-02-01", NULL);
+    ResumeAddEntry(me, section, "organize product files and reformat all xml simplify compare and merge operations",                                  "2022-11-01", NULL);
+    ResumeAddEntry(me, section, "allow copy and paste between WinScript Live version 5 and 6",                                                        "2022-12-01", NULL);
+    ResumeAddEntry(me, section, "expand live mode sequence status to include pre-roll and looping states",                                            "2022-07-01", NULL);
+    ResumeAddEntry(me, section, "allow winscriot live events view to split display of grid and timeline in the same frame",                           "2022-05-01", NULL);
+    ResumeAddEntry(me, section, "modify timeline graphics to match WinScript live 6 mockups",                                                         "2022-03-01", NULL);
+    ResumeAddEntry(me, section, "fix problem loading fonts that have the same name but different weights",                                            "2021-06-01", NULL);
+    ResumeAddEntry(me, section, "redesign button action dialog to allow multiple actions for release and a separate action for press",                "2021-03-01", NULL);
+    ResumeAddEntry(me, section, "simplify Visual Studio projects using property sheets",                                                              "2021-01-31", NULL);
+    ResumeAddEntry(me, section, "improve GPS parser to support decimal degrees from GPRMC messages",                                                  "2013-10-01", NULL);
+    ResumeAddEntry(me, section, "use PHP to load raw json data from a database then convert it for use with FusionCharts XT Javscript library",       "2019-12-01", NULL);
+    ResumeAddEntry(me, section, "add feature to WinScript Live to track the active sequence and automatically display all variables in a watch list", "2024-05-01", NULL);
+    ResumeAddEntry(me, section, "improve visibility into sequence scheduling by integrating a time database into the debug code",                     "2024-07-01", NULL);
+    ResumeAddEntry(me, section, "update ShowTouch to work with latest OEM panel pc running Windows 10 IoT",                                           "2024-07-01", NULL);
+
+    section = SECTION_TOOLS;
+    ResumeAddEntry(me, section, "Git / github.com / bitbucket.org", NULL, NULL);
+    ResumeAddEntry(me, section, "SVN",                              NULL, NULL);
+    ResumeAddEntry(me, section, "Microsoft Visual Studio",          NULL, NULL);
+    ResumeAddEntry(me, section, "Eclipse / ARM DS5",                NULL, NULL);
+    ResumeAddEntry(me, section, "Qt Creator",                       NULL, NULL);
+    ResumeAddEntry(me, section, "Corel Draw",                       NULL, NULL);
+    ResumeAddEntry(me, section, "Adobe Photoshop",                  NULL, NULL);
+    ResumeAddEntry(me, section, "Adobe After Effects",              NULL, NULL);
+    ResumeAddEntry(me, section, "Wireshark / tcpdump",              NULL, NULL);
+    ResumeAddEntry(me, section, "VS Code",                          NULL, NULL);
+    ResumeAddEntry(me, section, "VMWare Workstation / Virtual Box", NULL, NULL);
+
+    section = SECTION_PROJECTS;
+    ResumeAddEntry(me, section, "bottle cap motion sensor using Arduino with C++",                                                        NULL, NULL);
+    ResumeAddEntry(me, section, "digital audio recorder settings GUI using Qt for Windows and MacOS",                                     NULL, NULL);
+    ResumeAddEntry(me, section, "\"Yuri on Ice\" themed ice-skating game using HTML5, Zim, and Javascript",                               NULL, NULL);
+    ResumeAddEntry(me, section, "UDP tool using Qt and Npcap to monitor, send, and receive unicast, multicast, and broadcast datagrams.", NULL, NULL);
+    ResumeAddEntry(me, section, "DMX512 visual data file editor using Qt",                                                                NULL, NULL);
+    ResumeAddEntry(me, section, "WinMerge plugin to extract XML data from a proprietary archive file format",                             NULL, NULL);
+    ResumeAddEntry(me, section, "GPS visualization tool for trigger zones and live positioning data",                                     NULL, NULL);
+    ResumeAddEntry(me, section, "text based UDP protocol and gateway server for file system, SMTP, IMAP, and HTTPS access",               NULL, NULL);
 
-/** check if the character is whitespace
-*/
-#define IS_WHITESPACE(c) ((c) <= ' ')
+    if(me->m_ResumeErrorInSection != INVALID_POSITION)
+    {
+        // an error occurred in a section
+        result = RESULT_ERROR;
+    }
 
-/** skip whitespace including most non-printable characters
-*/
-#define SKIP_WHITESPACE(ptr)\
-while(IS_WHITESPACE(*ptr))\
-{\
-    if((*ptr) == '\0')\
-    {\
-        break;\
-    }\
-    ptr++;\
-}
+    if(me->m_ResumeErrorInEntry != ENTRY_STATE_OK)
+    {
+        // an error occurred in an entry
+        result = RESULT_ERROR;
+    }
 
-/** skip all characters until null-terminator is found
-*/
-#define SKIP_TO_NULL(ptr)\
-while((*ptr) != '\0')\
-{\
-    ptr++;\
+    return result;
 }
 
-//
-// MARK: SOURCE
-//
-
-// MARK: --- MAIN ---
+// MARK: --- RENDER CACHE ---
 
 /**********************************************************/
-static void MainPrintHelp(
-    const char* programName)
+static void RenderCacheInit(
+    RenderCache_t* me)
 {
-    printf("Usage: %s [options]\n", programName);
-    printf("\n");
-    printf("  options:\n");
-    printf("\n");
-    printf("    -a               display all entries. overrides -e\n");
-    printf("\n");
-    printf("    -e [count]       extend entry display\n");
-    printf("        count:\n");
-    printf("          1 - %d     this number of additional entries will\n", RESUME_MAX_LINES_PER_PAGE);
-    printf("                     be shown in each section when available\n");
-    printf("\n");
-    printf("    -f [format]      format of the resume output\n");
-    printf("        format:\n");
-    printf("          html       single-file HTML\n");
-    printf("          text       single-file plain text *default*\n");
-    printf("\n");
-    printf("    -h               this help text\n");
-    printf("\n");
-    printf("    -v               version\n");
-    printf("\n");
+    int index = 0;
+    do
+    {
+        RenderCacheEntry_t* entry = &me->m_CacheEntries[index];
+        entry->m_CacheHash = 0;
+        entry->m_CacheGeneration = 0;
+        OutputBufferInit(&entry->m_CacheKey);
+        entry->m_CacheShared = NULL;
+        entry->m_CacheNewer = NULL;
+        entry->m_CacheOlder = NULL;
+        index++;
+    }
+    while(index < RENDER_CACHE_MAX_ENTRIES);
+
+    me->m_CacheCount = 0;
+    me->m_CacheNewest = NULL;
+    me->m_CacheOldest = NULL;
+    OutputBufferInit(&me->m_CacheFindKey);
+    me->m_CacheHits = 0;
+    me->m_CacheMisses = 0;
 }
 
 /**********************************************************/
-static void MainPrintVersion(void)
+static void RenderCacheDeInit(
+    RenderCache_t* me)
 {
-    printf("%s Resume v%d.%02d.%02d\n", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
-    printf("\n");
-}
-
-// MARK: --- STRING ---
+    int index = 0;
+    do
+    {
+        RenderCacheEntry_t* entry = &me->m_CacheEntries[index];
+        OutputBufferDeInit(&entry->m_CacheKey);
+        if(entry->m_CacheShared)
+        {
+            // freed once no connection is sending it
+            SharedOutputRelease(entry->m_CacheShared);
+            entry->m_CacheShared = NULL;
+        }
+        index++;
+    }
+    while(index < RENDER_CACHE_MAX_ENTRIES);
 
-/**********************************************************/
-static Result_t SetText(
-    char** dest,
-    const char* src)
-{
-    // set the text with practically no upper bounds
-    return SetTextSubstr(dest, src, MAX_STRING_LENGTH);
+    me->m_CacheCount = 0;
+    me->m_CacheNewest = NULL;
+    me->m_CacheOldest = NULL;
+    OutputBufferDeInit(&me->m_CacheFindKey);
 }
 
 /**********************************************************/
-static Result_t SetTextSubstr(
-    char** dest,
-    const char* src,
-    int srcLength)
+static SharedOutput_t* RenderCacheGet(
+    RenderCache_t* me,
+    Resume_t* resume,
+    ResumeOptions_t* options)
 {
-    Result_t result = RESULT_OK;
+    OutputBuffer_t* findKey = &me->m_CacheFindKey;
+    RenderCacheEntry_t* entry;
+    uint32_t hash;
 
-    if(dest)
+    OutputBufferClear(findKey);
+    ResumeOptionsWriteKey(options, findKey);
+    if(findKey->m_OutputResult == RESULT_ERROR)
     {
-        unsigned long length = 0;
+        // failed to allocate memory
+        return NULL;
+    }
+    hash = HashFnv1a(HASH_FNV_OFFSET, findKey->m_OutputData, findKey->m_OutputLength);
 
-        // remove the current text
-        if((*dest) != g_EmptyText)
+    entry = me->m_CacheNewest;
+    while(entry)
+    {
+        if((entry->m_CacheHash == hash) &&
+           (entry->m_CacheKey.m_OutputLength == findKey->m_OutputLength) &&
+           (memcmp(entry->m_CacheKey.m_OutputData, findKey->m_OutputData, findKey->m_OutputLength) == 0))
         {
-            free((*dest));
+            break;
         }
+        entry = entry->m_CacheOlder;
+    }
 
-        // get the string length
-        if(src)
-        {
-            length = strlen(src);
-            if(srcLength < length)
-            {
-                length = srcLength;
-            }
-        }
+    if((entry) && (entry->m_CacheGeneration == resume->m_ResumeGeneration))
+    {
+        // rendered with these options since
+        // the resume last changed
+        me->m_CacheHits++;
+        RenderCacheTouch(me, entry);
+        return entry->m_CacheShared;
+    }
+    me->m_CacheMisses++;
 
-        if(length > 0)
+    if(entry)
+    {
+        // the resume changed since this was rendered
+    }
+    else
+    {
+        if(me->m_CacheCount < RENDER_CACHE_MAX_ENTRIES)
         {
-            // allocate memory for the text and null-terminater
-            // then copy the text
-            (*dest) = (char*)malloc(((length + 1) * sizeof(char)));
-            if((*dest))
-            {
-                memcpy((*dest), src, length);
-                (*dest)[length] = '\0';
-            }
-            else
-            {
-                // failed to allocated memory
-                result = RESULT_ERROR;
-
-                // safe to use shared empty text because
-                // all functions check for this
-                (*dest) = (char*)g_EmptyText;
-            }
+            entry = &me->m_CacheEntries[me->m_CacheCount];
+            me->m_CacheCount++;
         }
         else
         {
-            // set zero length clears the text
-
-            // safe to use shared empty text because
-            // all functions check for this
-            (*dest) = (char*)g_EmptyText;
+            // replace the least recently used entry
+            // and reuse its memory
+            entry = me->m_CacheOldest;
         }
+        OutputBufferClear(&entry->m_CacheKey);
+        OutputBufferAppend(&entry->m_CacheKey, findKey->m_OutputData, findKey->m_OutputLength);
+        entry->m_CacheHash = hash;
     }
-    else
+
+    if((entry->m_CacheShared) && (entry->m_CacheShared->m_SharedReferences > 1))
     {
-        // dest is invalid
+        // a connection is still sending the previous
+        // render so it keeps it and this entry is
+        // rendered into a new output
+        SharedOutputRelease(entry->m_CacheShared);
+        entry->m_CacheShared = NULL;
     }
-
-    return result;
-}
-
-/**********************************************************/
-static int FindUppercase(
-    const char* text,
-    int maxChars)
-{
-    int pos = 0;
-    while(pos < maxChars)
+    if(entry->m_CacheShared == NULL)
     {
-        char current = text[pos];
-        if(current == '\0')
-        {
-            // end of string.
-            // uppercase character not found
-            return INVALID_POSITION;
-        }
-        else if(current != (char)tolower(current))
-        {
-            // current is uppercase
-            return pos;
-        }
-        pos++;
+        entry->m_CacheShared = SharedOutputCreate();
     }
-    // finished max characters.
-    // uppercase character not found
-    return INVALID_POSITION;
-}
+    if(entry->m_CacheShared)
+    {
+        OutputBufferClear(&entry->m_CacheShared->m_SharedBuffer);
+        ResumePrint(resume, options, &entry->m_CacheShared->m_SharedBuffer);
+    }
+    entry->m_CacheGeneration = resume->m_ResumeGeneration;
+    RenderCacheTouch(me, entry);
 
-// MARK: --- TIME AND DATE ---
+    if((entry->m_CacheKey.m_OutputResult == RESULT_ERROR) ||
+       (entry->m_CacheShared == NULL) ||
+       (entry->m_CacheShared->m_SharedBuffer.m_OutputResult == RESULT_ERROR))
+    {
+        // an empty key never matches so this
+        // entry is rendered again next time
+        OutputBufferClear(&entry->m_CacheKey);
+        return NULL;
+    }
 
-/** used by GetDaysInMonth() to check if the
-    year is a leap year.
-    it's always a leap year every 400 years.
-    it's also a leap year every 4 years except
-    every 100 years.
-*/
-#define IS_LEAP_YEAR(year) (((year % 400) == 0) || (((year % 4) == 0) && ((year % 100) != 0)))
+    return entry->m_CacheShared;
+}
 
 /**********************************************************/
-static int GetDaysInMonth(
-    int month,
-    int year)
+static void RenderCacheTouch(
+    RenderCache_t* me,
+    RenderCacheEntry_t* entry)
 {
-    int days;
+    if(me->m_CacheNewest == entry)
+    {
+        // already the newest
+        return;
+    }
 
-    switch(month)
+    // remove from the list. a new entry
+    // is not in the list yet
+    if(entry->m_CacheNewer)
     {
-    case MONTH_FEB:
+        entry->m_CacheNewer->m_CacheOlder = entry->m_CacheOlder;
+    }
+    if(entry->m_CacheOlder)
     {
-        if(IS_LEAP_YEAR(year))
-        {
-            days = 29;
-        }
-        else
-        {
-            days = 28;
-        }
+        entry->m_CacheOlder->m_CacheNewer = entry->m_CacheNewer;
     }
-    break;
-
-    case MONTH_SEP: // fall-through
-    case MONTH_APR: // fall-through
-    case MONTH_JUN: // fall-through
-    case MONTH_NOV:
+    else if(me->m_CacheOldest == entry)
     {
-        days = 30;
+        me->m_CacheOldest = entry->m_CacheNewer;
     }
-    break;
-
-    default:
+    else
     {
-        days = 31;
+        // new entry
     }
-    break;
 
+    // add to the start of the list
+    entry->m_CacheNewer = NULL;
+    entry->m_CacheOlder = me->m_CacheNewest;
+    if(me->m_CacheNewest)
+    {
+        me->m_CacheNewest->m_CacheNewer = entry;
+    }
+    me->m_CacheNewest = entry;
+    if(me->m_CacheOldest == NULL)
+    {
+        me->m_CacheOldest = entry;
     }
-
-    return days;
 }
 
+// MARK: --- RESUME SHARED ---
+
 /**********************************************************/
-static int TimeToDateString(
-    time_t time,
-    char* dest,
-    int destLength,
-    DateOption_t dateOption)
+static void ResumeSharedInit(
+    ResumeShared_t* me,
+    Resume_t* first)
 {
-    int pos = 0;
-    struct tm* tm = gmtime(&time);
-    int year = tm->tm_year + 1900;
-    int month = tm->tm_mon + 1;
-    int day = tm->tm_mday;
-
-    // sanity checks to prevent string
-    // format buffer overflow
-    if((year < 1900) || (year > 9999))
+    int reader = 0;
+    do
     {
-        year = 0;
+        ATOMIC_INIT(&me->m_SharedReaderEpoch[reader], RESUME_SHARED_IDLE);
+        reader++;
     }
-    if((month < 0) || (month > 99))
+    while(reader < RESUME_SHARED_MAX_READERS);
+
+    // the first epoch is never RESUME_SHARED_IDLE
+    ATOMIC_INIT(&me->m_SharedEpoch, (RESUME_SHARED_IDLE + 1));
+    ATOMIC_INIT(&me->m_SharedCurrent, first);
+    me->m_SharedFirst = first;
+}
+
+/**********************************************************/
+static void ResumeSharedDeInit(
+    ResumeShared_t* me)
+{
+    Resume_t* resume = ATOMIC_LOAD(&me->m_SharedCurrent);
+    if(resume)
     {
-        month = 0;
+        ResumeSharedRetire(me, resume);
+        ATOMIC_STORE(&me->m_SharedCurrent, NULL);
     }
-    if((day < 0) || (day > 99))
+    else
     {
-        day = 0;
+        // already deinit
     }
+}
 
-    if((dateOption & DATE_OPTION_HIDE_YEAR) != DATE_OPTION_HIDE_YEAR)
-    {
-        snprintf(&dest[pos], (destLength - pos), "%04d", year);
-        pos += 4;
-    }
+/**********************************************************/
+static Resume_t* ResumeSharedRead(
+    ResumeShared_t* me,
+    int reader)
+{
+    // the epoch is marked before the resume is loaded.
+    // a publisher that replaces the resume after this
+    // waits for this reader to finish
+    ATOMIC_STORE(&me->m_SharedReaderEpoch[reader], ATOMIC_LOAD(&me->m_SharedEpoch));
+    return ATOMIC_LOAD(&me->m_SharedCurrent);
+}
 
-    if((dateOption & DATE_OPTION_HIDE_MONTH) != DATE_OPTION_HIDE_MONTH)
+/**********************************************************/
+static void ResumeSharedDone(
+    ResumeShared_t* me,
+    int reader)
+{
+    ATOMIC_STORE(&me->m_SharedReaderEpoch[reader], RESUME_SHARED_IDLE);
+}
+
+#if defined(RESUME_RELOAD)
+/**********************************************************/
+static void ResumeSharedPublish(
+    ResumeShared_t* me,
+    Resume_t* resume)
+{
+    // only this thread replaces the resume
+    // so it can be used without reading it
+    Resume_t* previous = ATOMIC_LOAD(&me->m_SharedCurrent);
+    uint64_t epoch;
+    int reader;
+
+    // caches and ETags see a change
+    // even if the data is the same
+    resume->m_ResumeGeneration += (previous->m_ResumeGeneration + 1);
+
+    ATOMIC_STORE(&me->m_SharedCurrent, resume);
+    epoch = ATOMIC_FETCH_ADD(&me->m_SharedEpoch, 1) + 1;
+
+    // a reader that started in an earlier epoch may still
+    // be using the previous resume. readers that start
+    // now use the new resume
+    reader = 0;
+    do
     {
-        if(pos > 0)
+        uint64_t readerEpoch = ATOMIC_LOAD(&me->m_SharedReaderEpoch[reader]);
+        if((readerEpoch != RESUME_SHARED_IDLE) && (readerEpoch < epoch))
         {
-            dest[pos] = '-';
-            pos++;
+            struct timespec wait;
+            wait.tv_sec = 0;
+            wait.tv_nsec = (RESUME_SHARED_WAIT_MILLI * NANO_PER_MILLI);
+            nanosleep(&wait, NULL);
         }
-        snprintf(&dest[pos], (destLength - pos), "%02d", month);
-        pos += 2;
-
-        if((dateOption & DATE_OPTION_HIDE_DAY) != DATE_OPTION_HIDE_DAY)
+        else
         {
-            if(pos > 0)
-            {
-                dest[pos] = '-';
-                pos++;
-            }
-            snprintf(&dest[pos], (destLength - pos), "%02d", day);
-            pos += 2;
+            reader++;
         }
     }
-    else
-    {
-        // month is hidden.
-        // it is too confusing to allow the day to be shown
-        // without the month so no additional date fields
-        // are filled here
-    }
+    while(reader < RESUME_SHARED_MAX_READERS);
 
-    return pos;
+    ResumeSharedRetire(me, previous);
 }
+#endif
 
 /**********************************************************/
-static Result_t TimeFromDateString(
-    time_t* time,
-    const char* date)
+static void ResumeSharedRetire(
+    ResumeShared_t* me,
+    Resume_t* resume)
 {
-    Result_t result = RESULT_OK;
-
-    if(time)
+    ResumeDeInit(resume);
+    if(resume != me->m_SharedFirst)
     {
-        (*time) = TIMESTAMP_UNSET;
+        free(resume);
     }
     else
     {
-        // time to update is missing
-        result = RESULT_WARNING;
+        // belongs to the caller of ResumeSharedInit()
     }
+}
 
-    if(date)
+// MARK: --- RESUME RELOAD ---
+
+/**********************************************************/
+static Result_t ResumeReloadStart(
+    ResumeReload_t* me,
+    ResumeShared_t* shared,
+    const char* path,
+    ResumeOptions_t* options)
+{
+    me->m_ReloadShared = shared;
+    me->m_ReloadPath = path;
+    me->m_ReloadName = path;
+    me->m_ReloadOptions = (*options);
+    me->m_ReloadNotify = INVALID_POSITION;
+    ATOMIC_INIT(&me->m_ReloadStop, 0);
+    me->m_ReloadRunning = RESULT_NO;
+
+#if defined(RESUME_RELOAD)
+    const char* name = strrchr(path, '/');
+    char* directory;
+    sigset_t blocked;
+    sigset_t previous;
+    int created;
+    int watch;
+
+    // the directory is watched instead of the file
+    // because editors often replace the file
+    if(name)
     {
-        if(date[0] != '\0')
+        int directoryLength = (int)(name - path);
+        if(directoryLength == 0)
         {
-            struct tm tm  = { 0 };
-            if(sscanf(date, DATE_STRING_FORMAT,
-                       &tm.tm_year,
-                       &tm.tm_mon,
-                       &tm.tm_mday) == 3)
-            {
-                tm.tm_mon--;
-                if((tm.tm_mon >= MONTH_JAN) &&
-                    (tm.tm_mon <= MONTH_DEC))
-                {
-                    int daysInMonth = GetDaysInMonth(tm.tm_mon, tm.tm_year);
-                    if((tm.tm_mday >= 1) &&
-                        (tm.tm_mday <= daysInMonth))
-                    {
-                        if((tm.tm_year < 1984) ||
-                            (tm.tm_year > 2084))
-                        {
-                            // I'm either in diapers or over
-                            // 100 years old.
-                            // consider this a warning :)
-                            result = RESULT_WARNING;
-                        }
-                        tm.tm_year -= 1900;
-                        if(time)
-                        {
-                            (*time) = mktime(&tm);
-                        }
-                        else
-                        {
-                            // time to update is missing
-                            result = RESULT_WARNING;
-                        }
-                    }
-                    else
-                    {
-                        // invalid day
-                        result = RESULT_ERROR;
-                    }
-                }
-                else
-                {
-                    // invalid month
-                    result = RESULT_ERROR;
-                }
-            }
-            else
-            {
-                // invalid date format
-                result = RESULT_ERROR;
-            }
+            // root directory
+            directoryLength = 1;
         }
-        else
+        directory = (char*)malloc(directoryLength + 1);
+        if(directory)
         {
-            // empty date.
-            // this is ok.
+            memcpy(directory, path, directoryLength);
+            directory[directoryLength] = '\0';
         }
+        me->m_ReloadName = (name + 1);
     }
     else
     {
-        // no date.
-        // this is ok.
+        directory = (char*)malloc(2);
+        if(directory)
+        {
+            memcpy(directory, ".", 2);
+        }
+    }
+    if(directory == NULL)
+    {
+        // failed to allocate memory
+        return RESULT_ERROR;
     }
 
-    return result;
-}
+    me->m_ReloadNotify = inotify_init1(IN_CLOEXEC);
+    if(me->m_ReloadNotify < 0)
+    {
+        me->m_ReloadNotify = INVALID_POSITION;
+        free(directory);
+        return RESULT_ERROR;
+    }
 
-// MARK: --- ENTRIES ---
+    watch = inotify_add_watch(me->m_ReloadNotify, directory, (IN_CLOSE_WRITE | IN_MOVED_TO));
+    free(directory);
+    if(watch < 0)
+    {
+        close(me->m_ReloadNotify);
+        me->m_ReloadNotify = INVALID_POSITION;
+        return RESULT_ERROR;
+    }
 
-/**********************************************************/
-static void EntriesInit(
-    Entries_t* me)
-{
-    me->m_Entries = NULL;
-    me->m_EntriesMax = 0;
-    me->m_EntriesUsed = 0;
+    // SIGINT and SIGTERM must interrupt the server
+    // instead of the reload thread
+    sigemptyset(&blocked);
+    sigaddset(&blocked, SIGINT);
+    sigaddset(&blocked, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &blocked, &previous);
+    created = pthread_create(&me->m_ReloadThread, NULL, ResumeReloadThread, me);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+    if(created != 0)
+    {
+        close(me->m_ReloadNotify);
+        me->m_ReloadNotify = INVALID_POSITION;
+        return RESULT_ERROR;
+    }
+    me->m_ReloadRunning = RESULT_YES;
+
+    return RESULT_OK;
+#else
+    // not supported on this platform
+    return RESULT_ERROR;
+#endif
 }
 
 /**********************************************************/
-static void EntriesDeInit(
-    Entries_t* me)
+static void ResumeReloadStop(
+    ResumeReload_t* me)
 {
-    if(me->m_Entries)
+#if defined(RESUME_RELOAD)
+    if(me->m_ReloadRunning == RESULT_YES)
     {
-        free(me->m_Entries);
-        me->m_Entries = NULL;
-        me->m_EntriesMax = 0;
+        ATOMIC_STORE(&me->m_ReloadStop, 1);
+        pthread_join(me->m_ReloadThread, NULL);
+        me->m_ReloadRunning = RESULT_NO;
     }
-    me->m_EntriesUsed = 0;
+    if(me->m_ReloadNotify != INVALID_POSITION)
+    {
+        close(me->m_ReloadNotify);
+        me->m_ReloadNotify = INVALID_POSITION;
+    }
+#else
+    PARAM_NOT_USED(me);
+#endif
 }
 
+#if defined(RESUME_RELOAD)
 /**********************************************************/
-static Result_t EntriesResize(
-    Entries_t* me,
-    int max)
+static Result_t ResumeReloadFile(
+    ResumeReload_t* me)
 {
     Result_t result = RESULT_ERROR;
-
-    if(me->m_EntriesMax >= max)
+    int reusedCount = 0;
+    Resume_t* resume = (Resume_t*)malloc(sizeof(Resume_t));
+    if(resume == NULL)
     {
-        // resize not needed
-        result =  RESULT_OK;
+        // failed to allocate memory
+        return RESULT_ERROR;
     }
-    else if(max > 0)
+
+    if(ResumeInit(resume, &me->m_ReloadOptions) == RESULT_OK)
     {
-        Entry_t** entries = (Entry_t**)realloc(me->m_Entries, sizeof(Entry_t*) * max);
-        if(entries)
+        OutputBuffer_t json;
+        OutputBufferInit(&json);
+        if(MainReadFile(me->m_ReloadPath, &json) == RESULT_OK)
         {
-            me->m_Entries = entries;
-            me->m_EntriesMax = max;
-            result = RESULT_OK;
+            // sections that did not change share their
+            // entries with the current resume
+            Resume_t* previous = ResumeSharedRead(me->m_ReloadShared, RELOAD_RESUME_READER);
+            result = ResumeLoadReusing(resume, json.m_OutputData, previous, &reusedCount, NULL, NULL);
+            ResumeSharedDone(me->m_ReloadShared, RELOAD_RESUME_READER);
         }
         else
         {
-            // error. failed to allocate memory
+            // cannot read the file
         }
+        OutputBufferDeInit(&json);
     }
     else
     {
-        // warning. invalid max value
-        result = RESULT_WARNING;
+        // failed to init
     }
 
-    return result;
-}
-
-/**********************************************************/
-static Result_t EntriesAppend(
-    Entries_t* me,
-    Entry_t* entry)
-{
-    Result_t result = RESULT_ERROR;
-
-    if(entry == NULL)
-    {
-        // warning. cannot append null entry
-        result = RESULT_WARNING;
-    }
-    else if(EntriesResize(me, (me->m_EntriesUsed + 1)) == RESULT_OK)
+    if(result != RESULT_ERROR)
     {
-        me->m_Entries[me->m_EntriesUsed] = entry;
-        me->m_EntriesUsed++;
-        result = RESULT_OK;
+        int sectionCount = (ResumeGetSectionCount(resume) - SECTION_COUNT);
+        ResumeSharedPublish(me->m_ReloadShared, resume);
+        printf("Reloaded \"%s\". %d of %d sections changed\n", me->m_ReloadPath, (sectionCount - reusedCount), sectionCount);
     }
     else
     {
-        // error. cannot resize
+        ResumeDeInit(resume);
+        free(resume);
+        printf("Error: failed to reload \"%s\". the previous resume is still used\n", me->m_ReloadPath);
     }
+    fflush(stdout);
 
     return result;
 }
 
 /**********************************************************/
-static Result_t EntriesInsertAt(
-    Entries_t* me,
-    Entry_t* entry,
-    int index)
+static void* ResumeReloadThread(
+    void* userData)
 {
-    Result_t result = RESULT_ERROR;
-
-    if(entry == NULL)
-    {
-        // warning. cannot insert null entry
-        result = RESULT_WARNING;
-    }
-    else if((index < 0) || (index > me->m_EntriesUsed))
+    ResumeReload_t* me = (ResumeReload_t*)userData;
+    Result_t changed = RESULT_NO;
+    union
     {
-        // error. cannot insert at this index
-        result = RESULT_WARNING;
-    }
-    else if(EntriesResize(me, (me->m_EntriesUsed + 1)) == RESULT_OK)
+        // aligns the buffer for inotify_event
+        struct inotify_event m_Event;
+        char m_Data[RELOAD_EVENT_BUFFER_SIZE];
+    } events;
+
+    while(ATOMIC_LOAD(&me->m_ReloadStop) == 0)
     {
-        // shift all entries >= index before inserting the entry
-        int shiftIndex = (me->m_EntriesUsed - 1);
-        while(shiftIndex >= index)
+        struct pollfd notify;
+        int ready;
+
+        notify.fd = me->m_ReloadNotify;
+        notify.events = POLLIN;
+        notify.revents = 0;
+        ready = poll(&notify, 1, (changed == RESULT_YES) ? RELOAD_SETTLE_MILLI : RELOAD_POLL_MILLI);
+        if(ready > 0)
         {
-            me->m_Entries[shiftIndex + 1] = me->m_Entries[shiftIndex];
-            shiftIndex--;
+            ssize_t readLength = read(me->m_ReloadNotify, events.m_Data, sizeof(events.m_Data));
+            ssize_t pos = 0;
+            while((pos + (ssize_t)sizeof(struct inotify_event)) <= readLength)
+            {
+                struct inotify_event* event = (struct inotify_event*)&events.m_Data[pos];
+                if((event->len > 0) && (strcmp(event->name, me->m_ReloadName) == 0))
+                {
+                    changed = RESULT_YES;
+                }
+                pos += (ssize_t)(sizeof(struct inotify_event) + event->len);
+            }
+        }
+        else if((ready == 0) && (changed == RESULT_YES))
+        {
+            // the file stopped changing
+            changed = RESULT_NO;
+            ResumeReloadFile(me);
+        }
+        else if((ready < 0) && (errno != EINTR))
+        {
+            // cannot wait for changes
+            printf("Error: stopped watching \"%s\"\n", me->m_ReloadPath);
+            fflush(stdout);
+            break;
+        }
+        else
+        {
+            // no changes
         }
-        me->m_Entries[index] = entry;
-        me->m_EntriesUsed++;
-        result = RESULT_OK;
     }
-    else
+
+    return NULL;
+}
+#endif
+
+// MARK: --- SECTION PARSER ---
+
+/**********************************************************/
+static void SectionParserInit(
+    SectionParser_t* me,
+    ResumeOptions_t* options)
+{
+    me->m_ParserJobs = NULL;
+    me->m_ParserJobCount = 0;
+    me->m_ParserJobMax = 0;
+    ATOMIC_INIT(&me->m_ParserNextJob, 0);
+    me->m_ParserOptions = (*options);
+
+    // each arena fills a single section on its own thread
+    me->m_ParserOptions.m_ThreadCount = 1;
+}
+
+/**********************************************************/
+static void SectionParserDeInit(
+    SectionParser_t* me)
+{
+    int index = 0;
+    while(index < me->m_ParserJobCount)
     {
-        // error. cannot resize
+        SectionJob_t* job = &me->m_ParserJobs[index];
+        if(job->m_JobSection)
+        {
+            SectionDataDeInit(job->m_JobSection);
+            MemoryFree(job->m_JobSection);
+            job->m_JobSection = NULL;
+        }
+        ManagedEntriesDeInit(&job->m_JobEntries);
+        index++;
     }
 
-    return result;
+    MemoryFree(me->m_ParserJobs);
+    me->m_ParserJobs = NULL;
+    me->m_ParserJobCount = 0;
+    me->m_ParserJobMax = 0;
 }
 
 /**********************************************************/
-static Result_t CallbackEntryIsOlder(
-    Entry_t* entry,
-    EntryTime_t entryTime,
-    void* userData)
+static Result_t SectionParserFindSections(
+    SectionParser_t* me,
+    const char* json)
 {
-    Entry_t* compareToEntry = (Entry_t*)userData;
-    if(compareToEntry->m_EntryTimestamp[entryTime] == TIMESTAMP_UNSET)
+    JsonState_t jsonState = JSON_STATE_OK;
+    int jsonArrayIndex = INVALID_POSITION;
+
+    SKIP_WHITESPACE(json);
+    if(json[0] != '[')
     {
-        // the entry is always older when comparing
-        // against an entry with no timestamp
-        return RESULT_OK;
+        // sections array should start with '['
+        return RESULT_ERROR;
     }
-    else if(entry->m_EntryTimestamp[entryTime] != TIMESTAMP_UNSET)
+
+    json = JsonArrayNextIndex((json + 1), &jsonArrayIndex, &jsonState); // recursive
+    while((jsonState == JSON_STATE_OK) && (jsonArrayIndex != INVALID_POSITION))
     {
-        // both entries have a timestamp.
-        // check if entry is older (smaller timestamp)
-        if(entry->m_EntryTimestamp[entryTime] < compareToEntry->m_EntryTimestamp[entryTime])
+        if(json[0] == '{')
+        {
+            SectionJob_t* job;
+            if(me->m_ParserJobCount == me->m_ParserJobMax)
+            {
+                int jobMax = (me->m_ParserJobMax > 0) ? (me->m_ParserJobMax * 2) : SECTION_PARSER_INITIAL_JOBS;
+                SectionJob_t* jobs = (SectionJob_t*)MemoryRealloc(MEMORY_THREADS, me->m_ParserJobs, ((size_t)jobMax * sizeof(SectionJob_t)));
+                if(jobs == NULL)
+                {
+                    // failed to allocate memory
+                    return RESULT_ERROR;
+                }
+                me->m_ParserJobs = jobs;
+                me->m_ParserJobMax = jobMax;
+            }
+            else
+            {
+                // room for another job
+            }
+
+            job = &me->m_ParserJobs[me->m_ParserJobCount];
+            job->m_JobJson = json;
+            job->m_JobSection = NULL;
+            job->m_JobResult = RESULT_ERROR;
+            job->m_JobErrorInEntry = ENTRY_STATE_UNKNOWN;
+            job->m_JobGeneration = 0;
+            if(ManagedEntriesInit(&job->m_JobEntries, RESUME_MAX_ENTRIES) == RESULT_ERROR)
+            {
+                // nothing to free but the entries array
+                ManagedEntriesDeInit(&job->m_JobEntries);
+                return RESULT_ERROR;
+            }
+            me->m_ParserJobCount++;
+        }
+        else
         {
-            // the entry is older
-            return RESULT_OK;
+            // not a json object. skipped the same
+            // way ResumeFillSectionsFromJsonArray()
+            // skips it
         }
+
+        // skip to the next json array element
+        json = JsonArrayNextIndex(json, &jsonArrayIndex, &jsonState); // recursive
     }
 
-    // allow search to continue
-    return RESULT_NEXT;
+    return (jsonState == JSON_STATE_OK) ? RESULT_OK : RESULT_ERROR;
 }
 
 /**********************************************************/
-static Result_t CallbackEntryIsNewer(
-    Entry_t* entry,
-    EntryTime_t entryTime,
-    void* userData)
+static void SectionParserRun(
+    SectionParser_t* me,
+    int threadCount)
 {
-    Entry_t* compareToEntry = (Entry_t*)userData;
-    if(entry->m_EntryTimestamp[entryTime] == TIMESTAMP_UNSET)
+#if defined(RESUME_THREADS)
+    pthread_t threads[RESUME_MAX_THREADS];
+    int started = 0;
+
+    if(threadCount > RESUME_MAX_THREADS)
     {
-        // the entry is always newer when
-        // it has no timestamp
-        return RESULT_OK;
+        threadCount = RESUME_MAX_THREADS;
     }
-    else if(compareToEntry->m_EntryTimestamp[entryTime] != TIMESTAMP_UNSET)
+    if(threadCount > me->m_ParserJobCount)
     {
-        // both entries have a timestamp.
-        // check if entry is newer (larger timestamp)
-        if(entry->m_EntryTimestamp[entryTime] > compareToEntry->m_EntryTimestamp[entryTime])
-        {
-            // the entry is newer
-            return RESULT_OK;
-        }
+        // one job per thread at most
+        threadCount = me->m_ParserJobCount;
     }
 
-    // allow search to continue
-    return RESULT_NEXT;
-}
-
-/**********************************************************/
-static int EntriesFind(
-    Entries_t* me,
-    EntriesFindCallback_t findCallback,
-    EntryTime_t entryTime,
-    void* userData)
-{
-    int index = 0;
-    while(index < me->m_EntriesUsed)
+    // the calling thread is one of the threads
+    while((started + 1) < threadCount)
     {
-        Result_t result = findCallback(
-            me->m_Entries[index],
-            entryTime,
-            userData);
-        if(result == RESULT_OK)
-        {
-            // callback found desired entry at this index
-            return index;
-        }
-        else if(result == RESULT_ERROR)
+        if(pthread_create(&threads[started], NULL, SectionParserThread, me) != 0)
         {
-            // callback has canceled this search
+            // the threads that did start
+            // share the jobs
             break;
         }
-        index++;
+        started++;
     }
 
-    return INVALID_POSITION;
+    SectionParserWork(me);
+
+    while(started > 0)
+    {
+        started--;
+        pthread_join(threads[started], NULL);
+    }
+#else
+    PARAM_NOT_USED(threadCount);
+    SectionParserWork(me);
+#endif
 }
 
 /**********************************************************/
-static Entry_t* EntriesTakeLast(
-    Entries_t* me)
+static void SectionParserWork(
+    SectionParser_t* me)
 {
-    Entry_t* entry = NULL;
+    Resume_t arena;
+    int jobIndex;
 
-    if(me->m_EntriesUsed > 0)
+    if(ResumeInit(&arena, &me->m_ParserOptions) == RESULT_ERROR)
     {
-        me->m_EntriesUsed--;
-        entry = me->m_Entries[me->m_EntriesUsed];
+        // the other threads run the jobs
+        ResumeDeInit(&arena);
+        return;
     }
 
-    return entry;
-}
+    jobIndex = ATOMIC_FETCH_ADD(&me->m_ParserNextJob, 1);
+    while(jobIndex < me->m_ParserJobCount)
+    {
+        SectionJob_t* job = &me->m_ParserJobs[jobIndex];
+        SectionData_t* sectionData = (SectionData_t*)MemoryAlloc(MEMORY_SECTIONS, sizeof(SectionData_t));
+        if(sectionData)
+        {
+            SectionDataInit(sectionData);
 
-// MARK: --- ENTRIES TRAVERSE ---
+            arena.m_ResumeErrorInEntry = ENTRY_STATE_UNKNOWN;
+            arena.m_ResumeGeneration = 0;
+            job->m_JobResult = ResumeFillSectionFromJsonObject(&arena, sectionData, job->m_JobJson);
+            job->m_JobErrorInEntry = arena.m_ResumeErrorInEntry;
+            job->m_JobGeneration = arena.m_ResumeGeneration;
+            job->m_JobSection = sectionData;
 
-/**********************************************************/
-static void EntriesTraverseInit(
-    EntriesTraverse_t* me)
-{
-    EntriesInit(&me->m_EntriesTraverse);
-    me->m_EntriesTraverseNumber = INVALID_POSITION;
+            // the job entries have room for every entry the
+            // arena can hold so they all move
+            ManagedEntriesMove(&job->m_JobEntries, &arena.m_ResumeAllEntries);
+        }
+        else
+        {
+            // failed to allocate memory.
+            // the job is left without a section
+        }
+
+        jobIndex = ATOMIC_FETCH_ADD(&me->m_ParserNextJob, 1);
+    }
+
+    ResumeDeInit(&arena);
 }
 
+#if defined(RESUME_THREADS)
 /**********************************************************/
-static void EntriesTraverseDeInit(
-    EntriesTraverse_t* me)
+static void* SectionParserThread(
+    void* userData)
 {
-    EntriesDeInit(&me->m_EntriesTraverse);
-    me->m_EntriesTraverseNumber = INVALID_POSITION;
+    SectionParserWork((SectionParser_t*)userData);
+    return NULL;
 }
+#endif
 
 /**********************************************************/
-static Entry_t* EntriesTraverseFirst(
-    EntriesTraverse_t* me,
-    Entries_t* entries,
-    Order_t order,
-    EntryTime_t entryTime)
+static Result_t SectionParserLink(
+    SectionParser_t* me,
+    Resume_t* resume)
 {
-    Entry_t* firstEntry = NULL;
-
-    if(entries == NULL)
+    int index = 0;
+    while(index < me->m_ParserJobCount)
     {
-        // entries is missing
-        me->m_EntriesTraverseNumber = INVALID_POSITION;
-        return NULL;
-    }
-
-    me->m_EntriesTraverseNumber = 0;
+        SectionJob_t* job = &me->m_ParserJobs[index];
+        SectionData_t* sectionData = job->m_JobSection;
+        if(sectionData == NULL)
+        {
+            // the job did not run
+            return RESULT_ERROR;
+        }
 
-    if(entries->m_EntriesUsed > 0)
-    {
-        if(EntriesResize(&me->m_EntriesTraverse, entries->m_EntriesUsed) == RESULT_OK)
+        // every entry the job created belongs to the resume
+        // even if the section is not linked
+        if(ManagedEntriesMove(&resume->m_ResumeAllEntries, &job->m_JobEntries) == RESULT_ERROR)
         {
-            int entryIndex;
-            Entry_t* insertEntry;
-            EntriesFindCallback_t findCallback = NULL;
+            resume->m_ResumeErrorInEntry = resume->m_ResumeAllEntries.m_ManagedEntriesError;
+            resume->m_ResumeErrorInSection = SECTION_AT_RUNTIME;
+            return RESULT_ERROR;
+        }
 
-            // select the callback to use for the
-            // insertion sort
-            switch(order)
-            {
-            case ORDER_RANDOM:
+        if(job->m_JobResult == RESULT_ERROR)
+        {
+            if(job->m_JobErrorInEntry != ENTRY_STATE_UNKNOWN)
             {
-                // no sorting necessary. just select
-                // random positions to insert the entries.
-                me->m_EntriesTraverse.m_EntriesUsed = 0;
-                EntriesAppend(&me->m_EntriesTraverse, entries->m_Entries[0]);
-
-                entryIndex = 1;
-                while(entryIndex < entries->m_EntriesUsed)
-                {
-                    int insertIndex = rand() % (me->m_EntriesTraverse.m_EntriesUsed + 1);
-                    insertEntry = entries->m_Entries[entryIndex];
-                    EntriesInsertAt(&me->m_EntriesTraverse, insertEntry, insertIndex);
-                    entryIndex++;
-                }
+                // SectionAddEntry() failed
+                resume->m_ResumeErrorInEntry = job->m_JobErrorInEntry;
+                resume->m_ResumeErrorInSection = SECTION_AT_RUNTIME;
             }
-            break;
-
-            case ORDER_OLDEST_FIRST:
+            else
             {
-                // perform insertion sort by looking for
-                // a newer entry and inserting the older
-                // entry before it
-                findCallback = CallbackEntryIsNewer;
+                // the section itself is invalid
             }
-            break;
+            return RESULT_ERROR;
+        }
 
-            case ORDER_NEWEST_FIRST: // fall-through
-            default:
-            {
-                // perform insertion sort by looking for
-                // an older entry and inserting the newer
-                // entry before it
-                findCallback = CallbackEntryIsOlder;
-            }
-            break;
-            }
+        // placed at the start of the runtime sections
+        // the same way ResumeInsertSection() places it
+        sectionData->m_SectionNext = resume->m_ResumeSectionRuntime;
+        resume->m_ResumeSectionRuntime = sectionData;
+        resume->m_ResumeGeneration += (job->m_JobGeneration + 1);
+        job->m_JobSection = NULL;
 
-            if(findCallback)
-            {
-                // create the ordered entries by adding the
-                // first entry to the empty array and then
-                // continuing with a basic insertion sort
-                me->m_EntriesTraverse.m_EntriesUsed = 0;
-                EntriesAppend(&me->m_EntriesTraverse, entries->m_Entries[0]);
+        index++;
+    }
 
-                entryIndex = 1;
-                while(entryIndex < entries->m_EntriesUsed)
-                {
-                    int insertIndex;
+    return RESULT_OK;
+}
 
-                    // use the find callback to select
-                    // a position in the traverse
-                    // entries array
-                    insertEntry = entries->m_Entries[entryIndex];
-                    insertIndex = EntriesFind(&me->m_EntriesTraverse, findCallback, entryTime, insertEntry);
-                    if(insertIndex != INVALID_POSITION)
-                    {
-                        // found entry at insertIndex.
-                        // place this entry before it
-                        EntriesInsertAt(&me->m_EntriesTraverse, insertEntry, insertIndex);
-                    }
-                    else
-                    {
-                        // entry can be placed at the end
-                        EntriesAppend(&me->m_EntriesTraverse, insertEntry);
-                    }
-                    entryIndex++;
-                }
-            }
-            else
-            {
-                // not using insertion sort
-            }
+// MARK: --- SECTION POOL ---
 
-            firstEntry = EntriesTraverseNext(me);
-        }
-        else
-        {
-            // error. failed to resize the entries
-        }
+/**********************************************************/
+static Result_t SectionPoolInit(
+    SectionPool_t* me,
+    Resume_t* resume)
+{
+    Section_t section = 0;
+    SectionData_t* sectionData;
+
+    me->m_PoolCount = ResumeGetSectionCount(resume);
+    me->m_PoolSections = (SectionData_t**)MemoryAlloc(MEMORY_THREADS, (size_t)me->m_PoolCount * sizeof(SectionData_t*));
+    me->m_PoolResults = (Result_t*)MemoryAlloc(MEMORY_THREADS, (size_t)me->m_PoolCount * sizeof(Result_t));
+    ATOMIC_INIT(&me->m_PoolNext, 0);
+    me->m_PoolCallback = NULL;
+    me->m_PoolUserData = NULL;
+    if((me->m_PoolSections == NULL) || (me->m_PoolResults == NULL))
+    {
+        // failed to allocate memory
+        me->m_PoolCount = 0;
+        return RESULT_ERROR;
     }
-    else
+
+    // hard-coded sections then the runtime sections
+    // in the order ResumeGetSectionData() finds them
+    while(section < SECTION_COUNT)
     {
-        // no entries
+        me->m_PoolSections[section] = &resume->m_ResumeSection[section];
+        section++;
+    }
+    sectionData = resume->m_ResumeSectionRuntime;
+    while(sectionData)
+    {
+        me->m_PoolSections[section] = sectionData;
+        section++;
+        sectionData = sectionData->m_SectionNext;
     }
 
-    return firstEntry;
+    section = 0;
+    while(section < me->m_PoolCount)
+    {
+        me->m_PoolResults[section] = RESULT_NEXT;
+        section++;
+    }
+
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static Entry_t* EntriesTraverseNext(
-    EntriesTraverse_t* me)
+static void SectionPoolDeInit(
+    SectionPool_t* me)
 {
-    Entry_t* entry = NULL;
+    MemoryFree(me->m_PoolSections);
+    me->m_PoolSections = NULL;
+    MemoryFree(me->m_PoolResults);
+    me->m_PoolResults = NULL;
+    me->m_PoolCount = 0;
+}
 
-    if(me->m_EntriesTraverseNumber < 0)
+/**********************************************************/
+static void SectionPoolRun(
+    SectionPool_t* me,
+    int threadCount,
+    SectionPoolCallback_t callback,
+    void* userData)
+{
+    me->m_PoolCallback = callback;
+    me->m_PoolUserData = userData;
+    ATOMIC_STORE(&me->m_PoolNext, 0);
+
+#if defined(RESUME_THREADS)
+    pthread_t threads[RESUME_MAX_THREADS];
+    int started = 0;
+
+    if(threadCount > RESUME_MAX_THREADS)
     {
-        // error. must first call EntriesTraverseFirst()
-        return NULL;
+        threadCount = RESUME_MAX_THREADS;
     }
-
-    if(me->m_EntriesTraverseNumber < me->m_EntriesTraverse.m_EntriesUsed)
+    if((Section_t)threadCount > me->m_PoolCount)
     {
-        entry = me->m_EntriesTraverse.m_Entries[me->m_EntriesTraverseNumber];
-        me->m_EntriesTraverseNumber++;
+        // one section per thread at most
+        threadCount = (int)me->m_PoolCount;
     }
-    else
+
+    // the calling thread is one of the threads
+    while((started + 1) < threadCount)
     {
-        // no more entries
+        if(pthread_create(&threads[started], NULL, SectionPoolThread, me) != 0)
+        {
+            // the threads that did start
+            // share the sections
+            break;
+        }
+        started++;
     }
 
-    return entry;
-}
+    SectionPoolWork(me);
 
-// MARK: --- MANAGED ENTRIES ---
+    while(started > 0)
+    {
+        started--;
+        pthread_join(threads[started], NULL);
+    }
+#else
+    PARAM_NOT_USED(threadCount);
+    SectionPoolWork(me);
+#endif
+}
 
 /**********************************************************/
-static Result_t ManagedEntriesInit(
-    ManagedEntries_t* me,
-    int max)
+static void SectionPoolWork(
+    SectionPool_t* me)
 {
-    EntriesInit(&me->m_ManagedEntries);
-    me->m_ManagedEntriesError = ENTRY_STATE_UNKNOWN;
-    return EntriesResize(&me->m_ManagedEntries, max);
+    Section_t section = ATOMIC_FETCH_ADD(&me->m_PoolNext, 1);
+    while(section < me->m_PoolCount)
+    {
+        if(me->m_PoolResults[section] == RESULT_NEXT)
+        {
+            me->m_PoolResults[section] = me->m_PoolCallback(me->m_PoolSections[section], section, me->m_PoolUserData);
+        }
+        else
+        {
+            // already finished on the calling thread
+        }
+        section = ATOMIC_FETCH_ADD(&me->m_PoolNext, 1);
+    }
 }
 
+#if defined(RESUME_THREADS)
 /**********************************************************/
-static void ManagedEntriesDeInit(
-    ManagedEntries_t* me)
+static void* SectionPoolThread(
+    void* userData)
 {
-    Entry_t* entry = EntriesTakeLast(&me->m_ManagedEntries);
-    while(entry)
-    {
-        EntryDeInit(entry);
-        free(entry);
-        entry = EntriesTakeLast(&me->m_ManagedEntries);
-    }
-
-    EntriesDeInit(&me->m_ManagedEntries);
+    SectionPoolWork((SectionPool_t*)userData);
+    return NULL;
 }
+#endif
+
+// MARK: --- RESUME RENDER ---
 
 /**********************************************************/
-static Entry_t* ManagedEntriesAppend(
-    ManagedEntries_t* me,
-    const char* text,
-    const char* start,
-    const char* end)
+static void ResumeRenderInit(
+    ResumeRender_t* me)
 {
-    // set the text with practically no upper bounds
-    return ManagedEntriesAppendSubstr(me, text, MAX_STRING_LENGTH, start, end);
+    me->m_RenderParts = NULL;
+    me->m_RenderPartCount = 0;
 }
 
 /**********************************************************/
-static Entry_t* ManagedEntriesAppendSubstr(
-    ManagedEntries_t* me,
-    const char* text,
-    int textLength,
-    const char* start,
-    const char* end)
+static void ResumeRenderDeInit(
+    ResumeRender_t* me)
 {
-    time_t timeStart = TIMESTAMP_UNSET;
-    time_t timeEnd = TIMESTAMP_UNSET;
-    Entry_t* entry = NULL;
-
-    if(me->m_ManagedEntries.m_EntriesUsed == me->m_ManagedEntries.m_EntriesMax)
+    int index = 0;
+    while(index < me->m_RenderPartCount)
     {
-        // no entries available
-        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_FULL;
-        return NULL;
+        OutputBufferDeInit(&me->m_RenderParts[index]);
+        index++;
     }
 
-    // make sure text is valid
-    if(text)
-    {
-        if(text[0] == '\0')
-        {
-            // empty text is not allowed
-            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_TEXT_EMPTY;
-            return NULL;
-        }
-    }
-    else
-    {
-        // text is missing
-        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_TEXT_MISSING;
-        return NULL;
-    }
+    MemoryFree(me->m_RenderParts);
+    me->m_RenderParts = NULL;
+    me->m_RenderPartCount = 0;
+}
 
-    // make sure dates are valid
-    if(start)
-    {
-        if(TimeFromDateString(&timeStart, start) == RESULT_ERROR)
-        {
-            // start date is optional, but this date
-            // could not parsed
-            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_START_DATE;
-            return NULL;
-        }
+/**********************************************************/
+static Result_t ResumeRenderRun(
+    ResumeRender_t* me,
+    Resume_t* resume,
+    ResumeOptions_t* options,
+    int threadCount)
+{
+    SectionPool_t pool;
+    Result_t result;
+    Section_t section;
+    int index;
 
-        if(end)
+    // rendering again replaces the previous parts
+    ResumeRenderDeInit(me);
+    me->m_RenderOptions = (*options);
+
+    result = SectionPoolInit(&pool, resume);
+    if(result == RESULT_OK)
+    {
+        // the header and the footer are
+        // around the sections
+        me->m_RenderParts = (OutputBuffer_t*)MemoryAlloc(MEMORY_OUTPUT, (size_t)(pool.m_PoolCount + 2) * sizeof(OutputBuffer_t));
+        if(me->m_RenderParts)
         {
-            if(TimeFromDateString(&timeEnd, end) == RESULT_ERROR)
+            me->m_RenderPartCount = (int)(pool.m_PoolCount + 2);
+            index = 0;
+            while(index < me->m_RenderPartCount)
             {
-                // end date is optional, but this date
-                // could not parsed
-                me->m_ManagedEntriesError = ENTRY_STATE_ERROR_END_DATE;
-                return NULL;
+                OutputBufferInit(&me->m_RenderParts[index]);
+                index++;
             }
         }
         else
         {
-            // no end date. this is ok
+            // failed to allocate memory
+            result = RESULT_ERROR;
         }
     }
     else
     {
-        // no start date. this is probably ok
-        if(end)
-        {
-            // cannot have end date without start date
-            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_START_DATE_MISSING;
-            return NULL;
-        }
+        // failed to allocate memory
     }
 
-    // create the entry and place it in the array
-    entry = (Entry_t*)malloc(sizeof(Entry_t));
-    if(entry)
+    if(result == RESULT_OK)
     {
-        EntryInit(entry);
-        if(EntrySetTextSubstr(entry, text, textLength) == RESULT_OK)
+        ResumePrintHeader(&me->m_RenderOptions, &me->m_RenderParts[0]);
+
+        // rand() orders random sections so any that
+        // are displayed and not ordered yet are ordered
+        // in section order on this thread the same
+        // way ResumePrint() orders them
+        section = 0;
+        while(section < pool.m_PoolCount)
         {
-            // save the previously parsed dates
-            entry->m_EntryTimestamp[ENTRY_TIME_START] = timeStart;
-            entry->m_EntryTimestamp[ENTRY_TIME_END] = timeEnd;
+            SectionData_t* sectionData = pool.m_PoolSections[section];
+            if((sectionData->m_SectionOrder == ORDER_RANDOM) &&
+               (ResumeOptionsGetDisplayMax(&me->m_RenderOptions, sectionData) != DISPLAY_NONE))
+            {
+                SectionDataGetOrderedEntries(sectionData);
+            }
+            section++;
+        }
 
-            // place the entry at the end of the array.
-            // not using EntriesAppend() because managed
-            // entries array is already sized during init
-            me->m_ManagedEntries.m_Entries[me->m_ManagedEntries.m_EntriesUsed] = entry;
-            me->m_ManagedEntries.m_EntriesUsed++;
+        SectionPoolRun(&pool, threadCount, ResumeRenderSectionCallback, me);
 
-            me->m_ManagedEntriesError = ENTRY_STATE_OK;
-        }
-        else
+        ResumePrintFooter(&me->m_RenderOptions, &me->m_RenderParts[me->m_RenderPartCount - 1]);
+
+        index = 0;
+        while(index < me->m_RenderPartCount)
         {
-            // could not set entry text
-            me->m_ManagedEntriesError = ENTRY_STATE_ERROR_SET_TEXT;
-            EntryDeInit(entry);
-            free(entry);
-            entry = NULL;
+            if(me->m_RenderParts[index].m_OutputResult == RESULT_ERROR)
+            {
+                // a part could not be written
+                result = RESULT_ERROR;
+            }
+            index++;
         }
     }
     else
     {
-        // could not allocate entry
-        me->m_ManagedEntriesError = ENTRY_STATE_ERROR_ALLOC;
+        // nothing rendered
     }
+    SectionPoolDeInit(&pool);
 
-    return entry;
+    return result;
 }
 
-// MARK: --- ENTRY ---
-
 /**********************************************************/
-static void EntryInit(
-    Entry_t* me)
+static Result_t ResumeRenderSectionCallback(
+    SectionData_t* sectionData,
+    Section_t section,
+    void* userData)
 {
-    int index;
-    // safe to use shared empty text because
-    // all functions check for this
-    me->m_EntryText = (char*)g_EmptyText;
+    ResumeRender_t* me = (ResumeRender_t*)userData;
 
-    index = 0;
-    do
-    {
-        me->m_EntryTimestamp[index] = TIMESTAMP_UNSET;
-        index++;
-    }
-    while(index < ENTRY_TIME_COUNT);
+    // the header is the first part
+    OutputBuffer_t* output = &me->m_RenderParts[section + 1];
+    ResumePrintSection(&me->m_RenderOptions, sectionData, output);
+
+    return output->m_OutputResult;
 }
 
+// MARK: --- RANK ---
+
 /**********************************************************/
-static void EntryDeInit(
-    Entry_t* me)
+static void RankInit(
+    Rank_t* me)
 {
-    int index;
-    SetText(&me->m_EntryText, NULL);
-
-    index = 0;
-    do
-    {
-        me->m_EntryTimestamp[index] = TIMESTAMP_UNSET;
-        index++;
-    }
-    while(index < ENTRY_TIME_COUNT);
+    me->m_RankEntries = NULL;
+    me->m_RankEntryCount = 0;
+    me->m_RankPostingStart = NULL;
+    me->m_RankPostingTerm = NULL;
+    me->m_RankPostingWeight = NULL;
+    me->m_RankPostingCount = 0;
+    me->m_RankTerms = NULL;
+    me->m_RankTermCount = 0;
+    me->m_RankTable = NULL;
+    me->m_RankTableMask = 0;
+    me->m_RankQuery = NULL;
+    me->m_RankGathered = NULL;
+    me->m_RankScores = NULL;
+    me->m_RankOrder = NULL;
 }
 
 /**********************************************************/
-static Result_t EntrySetText(
-    Entry_t* me,
-    const char* text)
+static void RankDeInit(
+    Rank_t* me)
 {
-    return SetText(&me->m_EntryText, text);
+    MemoryFree(me->m_RankEntries);
+    MemoryFree(me->m_RankPostingStart);
+    MemoryFree(me->m_RankPostingTerm);
+    MemoryFree(me->m_RankPostingWeight);
+    MemoryFree(me->m_RankTerms);
+    MemoryFree(me->m_RankTable);
+    MemoryFree(me->m_RankQuery);
+    MemoryFree(me->m_RankGathered);
+    MemoryFree(me->m_RankScores);
+    MemoryFree(me->m_RankOrder);
+    RankInit(me);
 }
 
 /**********************************************************/
-static Result_t EntrySetTextSubstr(
-    Entry_t* me,
-    const char* text,
-    int textLength)
+static Result_t RankBuild(
+    Rank_t* me,
+    Resume_t* resume)
 {
-    return SetTextSubstr(&me->m_EntryText, text, textLength);
+    char term[RANK_MAX_TERM_LENGTH];
+    const char* termText;
+    int termLength;
+    int entryCount = 0;
+    int termCount = 0;
+    uint32_t tableSize = 16;
+    double lengthTotal = 0.0;
+    double lengthAverage;
+    Section_t section;
+    SectionData_t* sectionData;
+    int entryIndex;
+    int posting;
+
+    // count the entries and the uses of every term so
+    // each array is allocated once
+    section = 0;
+    sectionData = ResumeGetSectionData(resume, section);
+    while(sectionData)
+    {
+        Entries_t* ordered = &sectionData->m_SectionOrdered.m_EntriesTraverse;
+        entryIndex = 0;
+        while(entryIndex < ordered->m_EntriesUsed)
+        {
+            const char* text = ordered->m_Entries[entryIndex]->m_EntryText;
+            while(RankNextTerm(&text, term, &termText) > 0)
+            {
+                termCount++;
+            }
+            entryIndex++;
+        }
+        entryCount += ordered->m_EntriesUsed;
+        section++;
+        sectionData = ResumeGetSectionData(resume, section);
+    }
+
+    // at most half of the table is used
+    while(tableSize < ((uint32_t)termCount * 2))
+    {
+        tableSize *= 2;
+    }
+
+    // one more so nothing is allocated with a size of 0
+    me->m_RankEntries = (Entry_t**)MemoryAlloc(MEMORY_RANK, (size_t)(entryCount + 1) * sizeof(Entry_t*));
+    me->m_RankPostingStart = (int*)MemoryAlloc(MEMORY_RANK, (size_t)(entryCount + 1) * sizeof(int));
+    me->m_RankPostingTerm = (int*)MemoryAlloc(MEMORY_RANK, (size_t)(termCount + 1) * sizeof(int));
+    me->m_RankPostingWeight = (double*)MemoryAlloc(MEMORY_RANK, (size_t)(termCount + 1) * sizeof(double));
+    me->m_RankTerms = (RankTerm_t*)MemoryAlloc(MEMORY_RANK, (size_t)(termCount + 1) * sizeof(RankTerm_t));
+    me->m_RankTable = (int*)MemoryAlloc(MEMORY_RANK, (size_t)tableSize * sizeof(int));
+    me->m_RankQuery = (double*)MemoryAlloc(MEMORY_RANK, (size_t)(termCount + 1) * sizeof(double));
+    me->m_RankGathered = (double*)MemoryAlloc(MEMORY_RANK, (size_t)(termCount + 1) * sizeof(double));
+    me->m_RankScores = (double*)MemoryAlloc(MEMORY_RANK, (size_t)(entryCount + 1) * sizeof(double));
+    me->m_RankOrder = (RankOrder_t*)MemoryAlloc(MEMORY_RANK, (size_t)(entryCount + 1) * sizeof(RankOrder_t));
+    if((me->m_RankEntries == NULL) ||
+       (me->m_RankPostingStart == NULL) ||
+       (me->m_RankPostingTerm == NULL) ||
+       (me->m_RankPostingWeight == NULL) ||
+       (me->m_RankTerms == NULL) ||
+       (me->m_RankTable == NULL) ||
+       (me->m_RankQuery == NULL) ||
+       (me->m_RankGathered == NULL) ||
+       (me->m_RankScores == NULL) ||
+       (me->m_RankOrder == NULL))
+    {
+        // failed to allocate memory
+        return RESULT_ERROR;
+    }
+    me->m_RankTableMask = (tableSize - 1);
+    memset(me->m_RankTable, 0xff, (size_t)tableSize * sizeof(int));
+
+    // the terms of each entry are counted then the
+    // uses of each term in the entry are combined
+    section = 0;
+    sectionData = ResumeGetSectionData(resume, section);
+    while(sectionData)
+    {
+        Entries_t* ordered = &sectionData->m_SectionOrdered.m_EntriesTraverse;
+        entryIndex = 0;
+        while(entryIndex < ordered->m_EntriesUsed)
+        {
+            Entry_t* entry = ordered->m_Entries[entryIndex];
+            const char* text = entry->m_EntryText;
+            int entryStart = me->m_RankPostingCount;
+            int entryLength = 0;
+
+            me->m_RankEntries[me->m_RankEntryCount] = entry;
+            me->m_RankPostingStart[me->m_RankEntryCount] = entryStart;
+            while((termLength = RankNextTerm(&text, term, &termText)) > 0)
+            {
+                int termIndex = RankFindTerm(me, term, termLength, termText);
+                posting = entryStart;
+                while((posting < me->m_RankPostingCount) &&
+                      (me->m_RankPostingTerm[posting] != termIndex))
+                {
+                    posting++;
+                }
+
+                if(posting < me->m_RankPostingCount)
+                {
+                    // used again in this entry
+                    me->m_RankPostingWeight[posting] += 1.0;
+                }
+                else
+                {
+                    me->m_RankPostingTerm[posting] = termIndex;
+                    me->m_RankPostingWeight[posting] = 1.0;
+                    me->m_RankTerms[termIndex].m_TermEntries++;
+                    me->m_RankPostingCount++;
+                }
+                entryLength++;
+            }
+            me->m_RankScores[me->m_RankEntryCount] = (double)entryLength;
+            lengthTotal += (double)entryLength;
+            me->m_RankEntryCount++;
+            entryIndex++;
+        }
+        section++;
+        sectionData = ResumeGetSectionData(resume, section);
+    }
+    me->m_RankPostingStart[me->m_RankEntryCount] = me->m_RankPostingCount;
+
+    // each weight is BM25 so a term used in few entries
+    // is worth more and more uses of a term are worth
+    // less each time, especially in a long entry
+    lengthAverage = (me->m_RankEntryCount > 0) ? (lengthTotal / (double)me->m_RankEntryCount) : 0.0;
+    if(lengthAverage <= 0.0)
+    {
+        // no terms so the length is never used
+        lengthAverage = 1.0;
+    }
+    entryIndex = 0;
+    while(entryIndex < me->m_RankEntryCount)
+    {
+        double lengthNorm = RANK_TERM_SATURATION *
+            ((1.0 - RANK_LENGTH_PENALTY) + (RANK_LENGTH_PENALTY * (me->m_RankScores[entryIndex] / lengthAverage)));
+        posting = me->m_RankPostingStart[entryIndex];
+        while(posting < me->m_RankPostingStart[entryIndex + 1])
+        {
+            double uses = me->m_RankPostingWeight[posting];
+            double entries = (double)me->m_RankTerms[me->m_RankPostingTerm[posting]].m_TermEntries;
+            double idf = RankLog2(1.0 + (((double)me->m_RankEntryCount - entries + 0.5) / (entries + 0.5)));
+            me->m_RankPostingWeight[posting] = idf * ((uses * (RANK_TERM_SATURATION + 1.0)) / (uses + lengthNorm));
+            posting++;
+        }
+        entryIndex++;
+    }
+
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static int EntryTimeToString(
-    Entry_t* me,
-    char* dest,
-    int destLength,
-    EntryTime_t entryTime,
-    DateOption_t dateOption)
+static int RankScore(
+    Rank_t* me,
+    const char* text)
 {
-    int pos = 0;
-    char fillChar = ' ';
+    char term[RANK_MAX_TERM_LENGTH];
+    const char* termText;
+    int termLength;
+    int found = 0;
+    int entryIndex;
+    int posting;
+    const int* postingTerm;
+    const double* postingWeight;
+    const double* query;
+    double* gathered;
+
+    memset(me->m_RankQuery, 0, (size_t)(me->m_RankTermCount + 1) * sizeof(double));
+    while((termLength = RankNextTerm(&text, term, &termText)) > 0)
+    {
+        int termIndex = RankFindTerm(me, term, termLength, NULL);
+        if(termIndex != INVALID_POSITION)
+        {
+            // a term used more in the text is worth more
+            me->m_RankQuery[termIndex] += 1.0;
+            found++;
+        }
+        else
+        {
+            // not used by any entry
+        }
+    }
 
-    if((dest == NULL) || (destLength <= 0))
+    if(found == 0)
     {
-        // invalid destination
+        // every score is 0
+        memset(me->m_RankScores, 0, (size_t)(me->m_RankEntryCount + 1) * sizeof(double));
         return 0;
     }
 
-    if(entryTime == ENTRY_TIME_START)
+    // SSE2 has no gather so the text weight of every term
+    // of every entry is gathered in one pass first
+    postingTerm = me->m_RankPostingTerm;
+    postingWeight = me->m_RankPostingWeight;
+    query = me->m_RankQuery;
+    gathered = me->m_RankGathered;
+    posting = 0;
+    while(posting < me->m_RankPostingCount)
     {
-        if((dateOption & DATE_OPTION_HIDE_START) != DATE_OPTION_HIDE_START)
+        gathered[posting] = query[postingTerm[posting]];
+        posting++;
+    }
+
+    // each score is a dot product of two dense arrays
+    entryIndex = 0;
+    while(entryIndex < me->m_RankEntryCount)
+    {
+        int postingEnd = me->m_RankPostingStart[entryIndex + 1];
+        double score = 0.0;
+        posting = me->m_RankPostingStart[entryIndex];
+#if defined(RESUME_SIMD_SSE2)
+        if((posting + 2) <= postingEnd)
         {
-            // start time selected and not hidden.
+            // multiply and add 2 terms at a time then add
+            // the 2 halves together
+            __m128d sum = _mm_setzero_pd();
+            double half[2];
+            while((posting + 2) <= postingEnd)
+            {
+                sum = _mm_add_pd(sum, _mm_mul_pd(_mm_loadu_pd(&postingWeight[posting]), _mm_loadu_pd(&gathered[posting])));
+                posting += 2;
+            }
+            _mm_storeu_pd(half, sum);
+            score = (half[0] + half[1]);
+        }
+#endif
 
-            // select a fill character to make it easier
-            // to follow a line when only partial data
-            // info is displayed
-            fillChar = '.';
+        // the remaining terms one at a time
+        while(posting < postingEnd)
+        {
+            score += postingWeight[posting] * gathered[posting];
+            posting++;
+        }
+        me->m_RankScores[entryIndex] = score;
+        entryIndex++;
+    }
 
-            if(me->m_EntryTimestamp[ENTRY_TIME_START] != TIMESTAMP_UNSET)
-            {
-                // TimeToDateString() will check if both
-                // start and end are hidden.
-                // this entry is the start so force end
-                // to be hidden.
-                dateOption |= DATE_OPTION_HIDE_END;
+    return found;
+}
 
-                pos += TimeToDateString(
-                    me->m_EntryTimestamp[ENTRY_TIME_START],
-                    &dest[pos],
-                    (destLength - pos),
-                    dateOption);
-            }
-            else
+/**********************************************************/
+static void RankApply(
+    Rank_t* me,
+    Resume_t* resume)
+{
+    int entryStart = 0;
+    Section_t section = 0;
+    SectionData_t* sectionData = ResumeGetSectionData(resume, section);
+
+    // the sections are in the same order as RankBuild()
+    while(sectionData)
+    {
+        Entries_t* ordered = &sectionData->m_SectionOrdered.m_EntriesTraverse;
+        int entryCount = ordered->m_EntriesUsed;
+        int position = 0;
+        while(position < entryCount)
+        {
+            me->m_RankOrder[position].m_OrderScore = me->m_RankScores[entryStart + position];
+            me->m_RankOrder[position].m_OrderPosition = position;
+            position++;
+        }
+
+        if(entryCount > 1)
+        {
+            qsort(me->m_RankOrder, (size_t)entryCount, sizeof(RankOrder_t), RankCompareOrder);
+            position = 0;
+            while(position < entryCount)
             {
-                // no start time
+                ordered->m_Entries[position] = me->m_RankEntries[entryStart + me->m_RankOrder[position].m_OrderPosition];
+                position++;
             }
         }
         else
         {
-            // entire start date is hidden
+            // nothing to sort
         }
+
+        entryStart += entryCount;
+        section++;
+        sectionData = ResumeGetSectionData(resume, section);
     }
-    else if(entryTime == ENTRY_TIME_END)
-    {
-        if((dateOption & DATE_OPTION_HIDE_END) != DATE_OPTION_HIDE_END)
-        {
-            // end time selected and not hidden.
+}
 
-            // select a fill character to make it easier
-            // to follow a line when only partial data
-            // info is displayed
-            fillChar = '.';
+/**********************************************************/
+static int RankFindTerm(
+    Rank_t* me,
+    const char* term,
+    int termLength,
+    const char* termText)
+{
+    uint32_t hash = HashFnv1a(HASH_FNV_OFFSET, term, termLength);
+    uint32_t slot = (hash & me->m_RankTableMask);
+    RankTerm_t* rankTerm;
 
-            if(me->m_EntryTimestamp[ENTRY_TIME_END] != TIMESTAMP_UNSET)
+    while(me->m_RankTable[slot] != INVALID_POSITION)
+    {
+        rankTerm = &me->m_RankTerms[me->m_RankTable[slot]];
+        if((rankTerm->m_TermHash == hash) && (rankTerm->m_TermLength == termLength))
+        {
+            // the term text keeps its case
+            int index = 0;
+            while((index < termLength) &&
+                  (tolower((unsigned char)rankTerm->m_TermText[index]) == (unsigned char)term[index]))
             {
-                // TimeToDateString() will check if both
-                // start and end are hidden.
-                // this entry is the end so force start
-                // to be hidden.
-                dateOption |= DATE_OPTION_HIDE_START;
-
-                pos += TimeToDateString(
-                    me->m_EntryTimestamp[ENTRY_TIME_END],
-                    &dest[pos],
-                    (destLength - pos),
-                    dateOption);
+                index++;
             }
-            else
+            if(index == termLength)
             {
-                // no end time.
-                // use "present"
-                static const char presentString[] = "present";
-                if((destLength - pos) >= ((int)sizeof(presentString) - 1))
-                {
-                    memcpy(&dest[pos], presentString, (sizeof(presentString) - 1));
-                    pos += (sizeof(presentString) - 1);
-                }
-                else
-                {
-                    // not enough space for "present"
-                }
+                return me->m_RankTable[slot];
             }
         }
-        else
-        {
-            // entire end date is hidden
-        }
+        slot = ((slot + 1) & me->m_RankTableMask);
     }
 
-    // fill remaining length
-    memset(&dest[pos], fillChar, (destLength - pos));
+    if(termText == NULL)
+    {
+        // only finding
+        return INVALID_POSITION;
+    }
 
-    return pos;
-}
+    rankTerm = &me->m_RankTerms[me->m_RankTermCount];
+    rankTerm->m_TermText = termText;
+    rankTerm->m_TermLength = termLength;
+    rankTerm->m_TermHash = hash;
+    rankTerm->m_TermEntries = 0;
+    me->m_RankTable[slot] = me->m_RankTermCount;
+    me->m_RankTermCount++;
 
-// MARK: --- SECTION DATA ---
+    return (me->m_RankTermCount - 1);
+}
 
 /**********************************************************/
-static void SectionDataInit(
-    SectionData_t* me)
+static int RankNextTerm(
+    const char** text,
+    char* term,
+    const char** termText)
 {
-    // safe to use shared empty text because
-    // all functions check for this
-    me->m_SectionTitle = (char*)g_EmptyText;
+    const char* next = (*text);
 
-    // default to display all entries from newest to oldest
-    // (descending order)
-    me->m_SectionDisplayMax = DISPLAY_ALL;
-    me->m_SectionOrder = ORDER_NEWEST_FIRST;
-    me->m_SectionOrderEntryTime = ENTRY_TIME_START;
+    while((*next) != '\0')
+    {
+        int termLength = 0;
+        int stopWord;
+
+        // a term is letters and digits. utf-8 bytes are
+        // letters so words in any language are kept
+        // together and '+' and '#' may follow the first
+        // letter for words like C++ and C#
+        while(((*next) != '\0') &&
+              (isalnum((unsigned char)(*next)) == 0) &&
+              (((unsigned char)(*next)) < 0x80))
+        {
+            next++;
+        }
+        (*termText) = next;
+        while(((*next) != '\0') &&
+              ((isalnum((unsigned char)(*next)) != 0) ||
+               (((unsigned char)(*next)) >= 0x80) ||
+               ((termLength > 0) && (((*next) == '+') || ((*next) == '#')))))
+        {
+            if(termLength < RANK_MAX_TERM_LENGTH)
+            {
+                term[termLength] = (char)tolower((unsigned char)(*next));
+                termLength++;
+            }
+            next++;
+        }
 
-    // default to display no date information
-    me->m_SectionDateOption = DATE_OPTION_HIDE_ALL;
+        if(termLength == 0)
+        {
+            // end of the text
+            break;
+        }
 
-    EntriesInit(&me->m_SectionEntries);
+        stopWord = 0;
+        while(stopWord < RANK_STOP_WORD_COUNT)
+        {
+            if((strncmp(g_RankStopWords[stopWord], term, (size_t)termLength) == 0) &&
+               (g_RankStopWords[stopWord][termLength] == '\0'))
+            {
+                break;
+            }
+            stopWord++;
+        }
 
-    // default to no next section
-    me->m_SectionNext = NULL;
+        if(stopWord == RANK_STOP_WORD_COUNT)
+        {
+            (*text) = next;
+            return termLength;
+        }
+        else
+        {
+            // common words are skipped
+        }
+    }
+
+    (*text) = next;
+    return 0;
 }
 
 /**********************************************************/
-static void SectionDataDeInit( // recursive
-    SectionData_t* me)
+static double RankLog2(
+    double value)
 {
-    if(me->m_SectionNext)
+    double result = 0.0;
+
+    while(value >= 2.0)
     {
-        SectionDataDeInit(me->m_SectionNext); // recursive
-        me->m_SectionNext = NULL;
+        value *= 0.5;
+        result += 1.0;
     }
-    SetText(&me->m_SectionTitle, NULL);
-    EntriesDeInit(&me->m_SectionEntries);
+
+    // value is now 1 to less than 2
+    return (result + (value - 1.0));
 }
 
 /**********************************************************/
-static Result_t SectionDataSetTitle(
-    SectionData_t* me,
-    const char* title)
+static int RankCompareOrder(
+    const void* left,
+    const void* right)
 {
-    return SetText(&me->m_SectionTitle, title);
+    const RankOrder_t* leftOrder = (const RankOrder_t*)left;
+    const RankOrder_t* rightOrder = (const RankOrder_t*)right;
+
+    if(leftOrder->m_OrderScore != rightOrder->m_OrderScore)
+    {
+        return (leftOrder->m_OrderScore < rightOrder->m_OrderScore) ? 1 : -1;
+    }
+
+    return (leftOrder->m_OrderPosition > rightOrder->m_OrderPosition) - (leftOrder->m_OrderPosition < rightOrder->m_OrderPosition);
 }
 
+// MARK: --- HIGHLIGHT ---
+
 /**********************************************************/
-static Result_t SectionDataSetTitleSubstr(
-    SectionData_t* me,
-    const char* title,
-    int titleLength)
+static void HighlightInit(
+    Highlight_t* me)
 {
-    return SetTextSubstr(&me->m_SectionTitle, title, titleLength);
+    me->m_HighlightText = NULL;
+    memset(me->m_HighlightClass, 0, sizeof(me->m_HighlightClass));
+    me->m_HighlightClassCount = 0;
+    me->m_HighlightNext = NULL;
+    me->m_HighlightFail = NULL;
+    me->m_HighlightLength = NULL;
+    me->m_HighlightOutput = NULL;
+    me->m_HighlightStateCount = 0;
+    me->m_HighlightKeywordCount = 0;
 }
 
 /**********************************************************/
-static Result_t SectionDataIncludeEntry(
-    SectionData_t* me,
-    Entry_t* entry)
+static void HighlightDeInit(
+    Highlight_t* me)
 {
-    return EntriesAppend(&me->m_SectionEntries, entry);
+    MemoryFree(me->m_HighlightNext);
+    MemoryFree(me->m_HighlightFail);
+    MemoryFree(me->m_HighlightLength);
+    MemoryFree(me->m_HighlightOutput);
+    HighlightInit(me);
 }
 
-// MARK: --- JSON ---
-
 /**********************************************************/
-static int JsonValueDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState)
+static Result_t HighlightBuild(
+    Highlight_t* me,
+    const char* text)
 {
-    int length = 0;
-    char current = (*json);
-    if(current == '[')
+    const char* next = text;
+    const char* keyword;
+    int keywordLength;
+    int keywordBytes = 0;
+    int stateMax;
+    int* queue;
+    int queueStart;
+    int queueEnd;
+    int classIndex;
+
+    me->m_HighlightText = text;
+
+    // give each byte used by a keyword its own class so
+    // each state only needs a transition per class
+    me->m_HighlightClassCount = 1;
+    while((keyword = HighlightNextKeyword(&next, &keywordLength)) != NULL)
     {
-        length = JsonArrayDataLength(json, jsonState); // recursive
+        int index = 0;
+        while(index < keywordLength)
+        {
+            unsigned char value = (unsigned char)tolower((unsigned char)keyword[index]);
+            if(me->m_HighlightClass[value] == 0)
+            {
+                me->m_HighlightClass[value] = (uint8_t)me->m_HighlightClassCount;
+                me->m_HighlightClassCount++;
+            }
+            index++;
+        }
+        keywordBytes += keywordLength;
+        me->m_HighlightKeywordCount++;
+        if(keywordBytes > HIGHLIGHT_MAX_KEYWORD_BYTES)
+        {
+            // too many keywords
+            return RESULT_ERROR;
+        }
     }
-    else if(current == '{')
+
+    // upper and lower case are the same class
+    classIndex = 'A';
+    while(classIndex <= 'Z')
     {
-        length = JsonObjectDataLength(json, jsonState); // recursive
+        me->m_HighlightClass[classIndex] = me->m_HighlightClass[tolower(classIndex)];
+        classIndex++;
     }
-    else if(current == '"')
+
+    if(me->m_HighlightKeywordCount == 0)
     {
-        length = JsonStringDataLength(json, jsonState);
+        // nothing to highlight
+        return RESULT_ERROR;
     }
-    else if(current >= '0' || current <= '9')
+
+    // every byte of every keyword could be a state
+    stateMax = (keywordBytes + 1);
+    me->m_HighlightNext = (int*)MemoryAlloc(MEMORY_HIGHLIGHT, (size_t)stateMax * (size_t)me->m_HighlightClassCount * sizeof(int));
+    me->m_HighlightFail = (int*)MemoryAlloc(MEMORY_HIGHLIGHT, (size_t)stateMax * sizeof(int));
+    me->m_HighlightLength = (int*)MemoryAlloc(MEMORY_HIGHLIGHT, (size_t)stateMax * sizeof(int));
+    me->m_HighlightOutput = (int*)MemoryAlloc(MEMORY_HIGHLIGHT, (size_t)stateMax * sizeof(int));
+    queue = (int*)MemoryAlloc(MEMORY_HIGHLIGHT, (size_t)stateMax * sizeof(int));
+    if((me->m_HighlightNext == NULL) ||
+       (me->m_HighlightFail == NULL) ||
+       (me->m_HighlightLength == NULL) ||
+       (me->m_HighlightOutput == NULL) ||
+       (queue == NULL))
     {
-        // decimal '.' is not checked here because 
-        // json numbers cannot have a leading decimal.
-        // see JSON_STATE_ERROR_LEADING_DECIMAL
-        length = JsonNumberDataLength(json, jsonState);
+        // failed to allocate memory
+        MemoryFree(queue);
+        return RESULT_ERROR;
     }
-    else if(FindUppercase(json, JSON_VALUE_KEYWORD_MAX_LENGTH) == INVALID_POSITION)
+    memset(me->m_HighlightNext, 0xff, (size_t)stateMax * (size_t)me->m_HighlightClassCount * sizeof(int));
+    memset(me->m_HighlightLength, 0, (size_t)stateMax * sizeof(int));
+
+    // add each keyword to the trie
+    me->m_HighlightStateCount = 1;
+    next = text;
+    while((keyword = HighlightNextKeyword(&next, &keywordLength)) != NULL)
     {
-        // check for json keywords
-        if(strncmp(json, g_JsonKeywordTrue, (sizeof(g_JsonKeywordTrue)-1)) == 0)
-        {
-            // true
-            length = (sizeof(g_JsonKeywordTrue)-1);
-        }
-        else if(strncmp(json, g_JsonKeywordFalse, (sizeof(g_JsonKeywordFalse)-1)) == 0)
+        int state = 0;
+        int index = 0;
+        while(index < keywordLength)
         {
-            // false
-            length = (sizeof(g_JsonKeywordFalse)-1);
+            int* transition = &me->m_HighlightNext[(state * me->m_HighlightClassCount) + me->m_HighlightClass[(unsigned char)keyword[index]]];
+            if((*transition) == INVALID_POSITION)
+            {
+                (*transition) = me->m_HighlightStateCount;
+                me->m_HighlightStateCount++;
+            }
+            state = (*transition);
+            index++;
         }
-        else if(strncmp(json, g_JsonKeywordNull, (sizeof(g_JsonKeywordNull)-1)) == 0)
+        me->m_HighlightLength[state] = keywordLength;
+    }
+
+    // visit each state after every shorter state so its
+    // fail state is complete. each missing transition is
+    // replaced by the transition of the fail state
+    queueStart = 0;
+    queueEnd = 0;
+    me->m_HighlightFail[0] = 0;
+    me->m_HighlightOutput[0] = 0;
+    classIndex = 0;
+    while(classIndex < me->m_HighlightClassCount)
+    {
+        int* transition = &me->m_HighlightNext[classIndex];
+        if((*transition) == INVALID_POSITION)
         {
-            // null
-            length = (sizeof(g_JsonKeywordNull)-1);
+            // back to the root
+            (*transition) = 0;
         }
         else
         {
-            // not a json keyword
+            me->m_HighlightFail[(*transition)] = 0;
+            me->m_HighlightOutput[(*transition)] = ((me->m_HighlightLength[(*transition)] > 0) ? (*transition) : 0);
+            queue[queueEnd] = (*transition);
+            queueEnd++;
         }
-    }
-    else
-    {
-        // there are no json keywords
-        // that contain uppercase characters.
-        (*jsonState) = JSON_STATE_ERROR_VALUE_CASE;
+        classIndex++;
     }
 
-    if(length == 0)
+    while(queueStart < queueEnd)
     {
-        (*jsonState) = JSON_STATE_ERROR_VALUE_INVALID;
+        int state = queue[queueStart];
+        int fail = me->m_HighlightFail[state];
+        queueStart++;
+
+        classIndex = 0;
+        while(classIndex < me->m_HighlightClassCount)
+        {
+            int* transition = &me->m_HighlightNext[(state * me->m_HighlightClassCount) + classIndex];
+            int failNext = me->m_HighlightNext[(fail * me->m_HighlightClassCount) + classIndex];
+            if((*transition) == INVALID_POSITION)
+            {
+                (*transition) = failNext;
+            }
+            else
+            {
+                int child = (*transition);
+                me->m_HighlightFail[child] = failNext;
+                me->m_HighlightOutput[child] = ((me->m_HighlightLength[child] > 0) ? child : me->m_HighlightOutput[failNext]);
+                queue[queueEnd] = child;
+                queueEnd++;
+            }
+            classIndex++;
+        }
     }
+    MemoryFree(queue);
 
-    return length;
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static int JsonNumberDataLength(
-    const char* json,
-    JsonState_t* jsonState)
+static void HighlightAppend(
+    const Highlight_t* me,
+    const char* text,
+    Format_t format,
+    OutputBuffer_t* output)
 {
-    int decimalPos = INVALID_POSITION;
-    int pos = 0;
-    char current;
-    current = json[pos];
-    while (current != '\0')
+    const int* next = me->m_HighlightNext;
+    int classCount = me->m_HighlightClassCount;
+    int state = 0;
+    int written = 0;
+    int markStart = INVALID_POSITION;
+    int markEnd = INVALID_POSITION;
+    int index = 0;
+
+    // the longest keyword that ends at each byte is
+    // found in a single pass. a mark is only written once
+    // a keyword starts after it so a longer keyword that
+    // starts earlier can replace it
+    while(text[index] != '\0')
     {
-        if(current == '.')
+        int match;
+        state = next[(state * classCount) + me->m_HighlightClass[(unsigned char)text[index]]];
+        match = me->m_HighlightOutput[state];
+        while(match != 0)
         {
-            // found decimal point
-            if(pos > 0)
+            int start = (index - me->m_HighlightLength[match] + 1);
+            if(((start == 0) ||
+                (HighlightIsWordByte(text[start]) == RESULT_NO) ||
+                (HighlightIsWordByte(text[start - 1]) == RESULT_NO)) &&
+               ((HighlightIsWordByte(text[index]) == RESULT_NO) ||
+                (HighlightIsWordByte(text[index + 1]) == RESULT_NO)))
             {
-                if(decimalPos == INVALID_POSITION)
-                {
-                    decimalPos = pos;
-                }
-                else
-                {
-                    // cannot have more than one decimal point.
-                    (*jsonState) = JSON_STATE_ERROR_TOO_MANY_DECIMALS;
-                    // invalid number
-                    return 0;
-                }
+                // found a whole word
+                break;
+            }
+            match = me->m_HighlightOutput[me->m_HighlightFail[match]];
+        }
+
+        if(match != 0)
+        {
+            int start = (index - me->m_HighlightLength[match] + 1);
+            if(start < written)
+            {
+                // overlaps a mark already written
+            }
+            else if(markStart == INVALID_POSITION)
+            {
+                markStart = start;
+                markEnd = index;
+            }
+            else if(start > markEnd)
+            {
+                // the previous mark is complete
+                HighlightAppendPart(&text[written], (markStart - written), format, output);
+                OutputBufferAppendText(output, g_HighlightOpen[format]);
+                HighlightAppendPart(&text[markStart], (markEnd - markStart + 1), format, output);
+                OutputBufferAppendText(output, g_HighlightClose[format]);
+                written = (markEnd + 1);
+                markStart = start;
+                markEnd = index;
+            }
+            else if(start <= markStart)
+            {
+                // a longer keyword includes the mark
+                markStart = start;
+                markEnd = index;
             }
             else
             {
-                // must have a leading number
-                (*jsonState) = JSON_STATE_ERROR_LEADING_DECIMAL;
-                return 0;
+                // overlaps the end of the mark
             }
         }
-        else if((current < '0') || (current > '9'))
+        else
         {
-            // not a number.
-            // let the caller determine if the character(s)
-            // following the number are valid.
-            return pos;
+            // no keyword ends here
         }
-        pos++;
-        current = json[pos];
+        index++;
+    }
+
+    if(markStart != INVALID_POSITION)
+    {
+        HighlightAppendPart(&text[written], (markStart - written), format, output);
+        OutputBufferAppendText(output, g_HighlightOpen[format]);
+        HighlightAppendPart(&text[markStart], (markEnd - markStart + 1), format, output);
+        OutputBufferAppendText(output, g_HighlightClose[format]);
+        written = (markEnd + 1);
+    }
+    HighlightAppendPart(&text[written], (index - written), format, output);
+}
+
+/**********************************************************/
+static void HighlightAppendPart(
+    const char* text,
+    int textLength,
+    Format_t format,
+    OutputBuffer_t* output)
+{
+    if(textLength <= 0)
+    {
+        // nothing to append
+    }
+    else if(format == FORMAT_HTML)
+    {
+        OutputBufferAppendHtml(output, text, textLength);
+    }
+    else
+    {
+        // plain text is not escaped
+        OutputBufferAppend(output, text, textLength);
     }
-
-    // end of json data
-    return pos;
 }
 
 /**********************************************************/
-static int JsonStringDataLength(
-    const char* json,
-    JsonState_t* jsonState)
+static const char* HighlightNextKeyword(
+    const char** text,
+    int* keywordLength)
 {
-    int pos;
-    char current;
+    const char* next = (*text);
 
-    if(json[0] != '"')
+    while((*next) != '\0')
     {
-        // quoted string must start with a quote
-        (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_START;
-        return 0;
-    }
+        const char* keyword;
+        const char* end;
 
-    pos = 1;
-    current = json[pos];
-    while (current != '\0')
-    {
-        if(current == '"')
+        while(((*next) == ' ') || ((*next) == '\t') || ((*next) == '\r') || ((*next) == '\n') || ((*next) == ','))
         {
-            // end of quoted string
-            return (pos + 1);
+            next++;
         }
-        else if(current == '\\')
+        keyword = next;
+        while(((*next) != '\0') && ((*next) != '\n') && ((*next) != ','))
         {
-            // escape next character
-            pos++;
-            current = json[pos];
-            if(current == '\0')
-            {
-                // missing escaped character
-                (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_ESCAPED_CHAR;
-                break;
-            }
+            next++;
+        }
+
+        // spaces at the end are not part of the keyword
+        end = next;
+        while((end > keyword) && ((end[-1] == ' ') || (end[-1] == '\t') || (end[-1] == '\r')))
+        {
+            end--;
+        }
+
+        if(end > keyword)
+        {
+            (*text) = next;
+            (*keywordLength) = (int)(end - keyword);
+            return keyword;
+        }
+        else
+        {
+            // empty keyword
         }
-        pos++;
-        current = json[pos];
     }
 
-    // end of quoted string not found
-    (*jsonState) = JSON_STATE_ERROR_STRING_MISSING_END;
+    (*text) = next;
+    return NULL;
+}
 
-    return 1;
+/**********************************************************/
+static Result_t HighlightIsWordByte(
+    char value)
+{
+    if((isalnum((unsigned char)value) != 0) ||
+       (((unsigned char)value) >= 0x80))
+    {
+        return RESULT_YES;
+    }
+
+    return RESULT_NO;
 }
 
+// MARK: --- BATCH ---
+
 /**********************************************************/
-static int JsonArrayDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState)
+static void BatchInit(
+    Batch_t* me,
+    const char* cachePath,
+    ResumeOptions_t* options)
 {
-    int pos;
-    char current;
+    OutputBufferInit(&me->m_BatchManifest);
+    me->m_BatchJobs = NULL;
+    me->m_BatchJobCount = 0;
+    me->m_BatchJobMax = 0;
+    me->m_BatchOptions = (*options);
+
+    // the jobs run on several threads so each
+    // resume is filled on a single thread
+    me->m_BatchOptions.m_ThreadCount = 1;
+
+    me->m_BatchWorkers = NULL;
+    me->m_BatchWorkerCount = 0;
+
+    me->m_BatchCachePath = cachePath;
+    OutputBufferInit(&me->m_BatchCacheFile);
+    me->m_BatchCacheEntries = NULL;
+    me->m_BatchCacheCount = 0;
+}
 
-    if(json[0] != '[')
+/**********************************************************/
+static void BatchDeInit(
+    Batch_t* me)
+{
+    free(me->m_BatchWorkers);
+    me->m_BatchWorkers = NULL;
+    me->m_BatchWorkerCount = 0;
+    free(me->m_BatchJobs);
+    me->m_BatchJobs = NULL;
+    me->m_BatchJobCount = 0;
+    me->m_BatchJobMax = 0;
+    OutputBufferDeInit(&me->m_BatchManifest);
+    free(me->m_BatchCacheEntries);
+    me->m_BatchCacheEntries = NULL;
+    me->m_BatchCacheCount = 0;
+    OutputBufferDeInit(&me->m_BatchCacheFile);
+}
+
+/**********************************************************/
+static Result_t BatchLoadManifest(
+    Batch_t* me,
+    const char* path)
+{
+    Result_t result = RESULT_OK;
+    char* line;
+    char* end;
+    int lineNumber = 1;
+
+    if(MainReadFile(path, &me->m_BatchManifest) == RESULT_ERROR)
     {
-        // array must start with a bracket
-        (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_START;
-        return 0;
+        printf("Error: failed to read batch manifest \"%s\"\n", path);
+        return RESULT_ERROR;
     }
 
-    pos = 1;
-    current = json[pos];
-    while (current != '\0')
+    // the last byte is the null-terminator
+    line = me->m_BatchManifest.m_OutputData;
+    end = &me->m_BatchManifest.m_OutputData[me->m_BatchManifest.m_OutputLength - 1];
+    while(line < end)
     {
-        if(current == ']')
+        char* newline = (char*)memchr(line, '\n', (size_t)(end - line));
+        if(newline == NULL)
         {
-            // end of array
-            return (pos + 1);
+            // the last line
+            newline = end;
         }
-        else
+
+        if(BatchAddJob(me, line, (int)(newline - line), lineNumber) == RESULT_ERROR)
         {
-            const char* currentPtr = &json[pos];
-            const char* skipPtr = JsonSkip(currentPtr, jsonState); // recursive
-            if(skipPtr != currentPtr)
-            {
-                pos += (int)(skipPtr - currentPtr);
-                current = json[pos];
-            }
-            else
-            {
-                // failed to skip json data.
-                // check jsonState for details.
-                // cannot find the end of the array
-                break;
-            }
+            // keep checking the other lines so every
+            // error is printed
+            result = RESULT_ERROR;
         }
+
+        line = (newline + 1);
+        lineNumber++;
     }
 
-    // end of array not found
-    (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_END;
+    if((result == RESULT_OK) && (me->m_BatchJobCount == 0))
+    {
+        printf("Error: batch manifest \"%s\" has no jobs\n", path);
+        result = RESULT_ERROR;
+    }
 
-    return 1;
+    return result;
 }
 
 /**********************************************************/
-static int JsonObjectDataLength( // recursive
-    const char* json,
-    JsonState_t* jsonState)
+static Result_t BatchAddJob(
+    Batch_t* me,
+    char* line,
+    int lineLength,
+    int lineNumber)
 {
-    int pos;
-    char current;
+    char* args[BATCH_MAX_ARGS];
+    int argCount;
+    int index;
+    const char* destination;
+    BatchJob_t* job;
 
-    if(json[0] != '{')
+    line[lineLength] = '\0';
+    argCount = MainSplitArgs(line, lineLength, args, BATCH_MAX_ARGS);
+    if(argCount == INVALID_POSITION)
     {
-        // object must start with a brace
-        (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_START;
-        return 0;
+        printf("Error: batch manifest line %d has too many options\n", lineNumber);
+        return RESULT_ERROR;
+    }
+    if((argCount == 0) || (args[0][0] == '#'))
+    {
+        // empty line or comment
+        return RESULT_OK;
     }
 
-    pos = 1;
-    current = json[pos];
-    while (current != '\0')
+    if(me->m_BatchJobCount == me->m_BatchJobMax)
     {
-        if(current == '}')
+        int jobMax = (me->m_BatchJobMax > 0) ? (me->m_BatchJobMax * 2) : BATCH_INITIAL_JOBS;
+        BatchJob_t* jobs = (BatchJob_t*)realloc(me->m_BatchJobs, ((size_t)jobMax * sizeof(BatchJob_t)));
+        if(jobs == NULL)
         {
-            // end of object
-            return (pos + 1);
+            // failed to allocate memory
+            printf("Error: batch manifest line %d cannot be added\n", lineNumber);
+            return RESULT_ERROR;
         }
-        else
+        me->m_BatchJobs = jobs;
+        me->m_BatchJobMax = jobMax;
+    }
+    else
+    {
+        // room for another job
+    }
+
+    job = &me->m_BatchJobs[me->m_BatchJobCount];
+    job->m_JobInput = args[0];
+    job->m_JobOptions = me->m_BatchOptions;
+    job->m_JobLine = lineNumber;
+    job->m_JobCached = NULL;
+    job->m_JobInputSize = 0;
+    job->m_JobInputTime = 0;
+    job->m_JobInputHash = 0;
+    job->m_JobResult = RESULT_ERROR;
+
+    // the format ends at the first ':' the same as -o
+    destination = (argCount >= 2) ? strchr(args[1], ':') : NULL;
+    if((destination == NULL) || (destination[1] == '\0'))
+    {
+        printf("Error: batch manifest line %d needs a json file and format:destination\n", lineNumber);
+        return RESULT_ERROR;
+    }
+    if(MainParseFormat(args[1], &job->m_JobOptions.m_DisplayFormat) == RESULT_ERROR)
+    {
+        printf("Error: batch manifest line %d has an unknown output format \"%s\"\n", lineNumber, args[1]);
+        return RESULT_ERROR;
+    }
+    job->m_JobDestination = (destination + 1);
+    if(strcmp(job->m_JobDestination, MAIN_OUTPUT_STDOUT) == 0)
+    {
+        // jobs finish in any order
+        printf("Error: batch manifest line %d cannot write to standard out\n", lineNumber);
+        return RESULT_ERROR;
+    }
+
+    index = 2;
+    while(index < argCount)
+    {
+        const char* option = args[index];
+        if(MainParseResumeOption(argCount, args, &index, &job->m_JobOptions) != EXIT_OK)
         {
-            const char* currentPtr = &json[pos];
-            const char* skipPtr = JsonSkip(currentPtr, jsonState); // recursive
-            if(skipPtr != currentPtr)
-            {
-                pos += (int)(skipPtr - currentPtr);
-                current = json[pos];
-            }
-            else
-            {
-                // failed to skip json data.
-                // check jsonState for details.
-                // cannot find the end of the object
-                break;
-            }
+            printf("Error: batch manifest line %d has an invalid option \"%s\"\n", lineNumber, option);
+            return RESULT_ERROR;
         }
+        index++;
     }
 
-    // end of object not found
-    (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_END;
+    job->m_JobKey = BatchJobKey(job);
+    me->m_BatchJobCount++;
 
-    return 1;
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static const char* JsonSkip( // recursive
-    const char* json,
-    JsonState_t* jsonState)
+static uint64_t BatchJobKey(
+    BatchJob_t* job)
 {
-    const char* ptr = json;
-    char current = (*ptr);
-    switch(current)
+    int version[3] = { MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION };
+    uint64_t key = HASH_FNV64_OFFSET;
+    OutputBuffer_t options;
+
+    // the hard-coded sections change with the version
+    key = HashFnv1a64(key, (const char*)version, sizeof(version));
+    key = HashFnv1a64(key, g_ResumeFullName, sizeof(g_ResumeFullName));
+
+    // include the null-terminator so the name and
+    // options cannot run together
+    key = HashFnv1a64(key, job->m_JobInput, (int)(strlen(job->m_JobInput) + 1));
+
+    OutputBufferInit(&options);
+    ResumeOptionsWriteKey(&job->m_JobOptions, &options);
+    if(options.m_OutputResult == RESULT_OK)
     {
-        case '[':
-        {
-            // find closing ']'
-            int dataLength = JsonArrayDataLength(ptr, jsonState); // recursive
-            if(dataLength >= 2)
-            {
-                ptr += dataLength;
-                SKIP_WHITESPACE(ptr);
-                current = (*ptr);
-                // ignoring all data after the end of the array.
-                // no additional checks necessary
-            }
-            else
-            {
-                // array data length must be
-                // at least 2 characters for the
-                // start and end of the array.
-                // check jsonState for details.
-                // no change made to ptr
-            }
-        }
-        break;
-        case '{':
-        {
-            // find closing '}'
-            int dataLength = JsonObjectDataLength(ptr, jsonState); // recursive
-            if(dataLength >= 2)
-            {
-                ptr += dataLength;
-                SKIP_WHITESPACE(ptr);
-                current = (*ptr);
-                // ignoring all data after the end of the object.
-                // no additional checks necessary
-            }
-            else
-            {
-                // array data length must be
-                // at least 2 characters for the
-                // start and end of the array.
-                // check jsonState for details.
-                // no change made to ptr
-            }
-        }
-        break;
-        case '"':
-        {
-            // find closing '"'
-            int dataLength = JsonStringDataLength(ptr, jsonState);
-            if(dataLength >= 2)
-            {
-                ptr += dataLength;
-                SKIP_WHITESPACE(ptr);
-                current = (*ptr);
-                // a string is only valid when
-                // followed by a valid character
-                if((current != ',') &&
-                   (current != ']') &&
-                   (current != '}') &&
-                   (current != ':') &&
-                   (current != '\0'))
-                {
-                    // a valid character was not found
-                    (*jsonState) = JSON_STATE_ERROR_STRING_INVALID_FOLLOWER;
-                    // pretend nothing happened
-                    ptr = json;
-                }
-            }
-            else
-            {
-                // string data length must be
-                // at least 2 characters for the
-                // start and end of the quoted string.
-                // check jsonState for details.
-                // no change made to ptr
-            }
-        }
-        break;
+        key = HashFnv1a64(key, options.m_OutputData, options.m_OutputLength);
+    }
+    else
+    {
+        // failed to allocate memory. a key that cannot
+        // match a previous run renders the job
+        key = 0;
+    }
+    OutputBufferDeInit(&options);
+
+    return key;
+}
+
+/**********************************************************/
+static Result_t BatchLoadCache(
+    Batch_t* me)
+{
+    char* line;
+    char* end;
+    int entryMax;
+    char header[64];
 
-        case ':':
+    if(me->m_BatchCachePath == NULL)
+    {
+        // every job is rendered
+        return RESULT_OK;
+    }
+
+    if(MainReadFile(me->m_BatchCachePath, &me->m_BatchCacheFile) == RESULT_ERROR)
+    {
+        // the first run has no cache file
+        OutputBufferClear(&me->m_BatchCacheFile);
+        return RESULT_OK;
+    }
+
+    // the first line is the version that wrote the file
+    snprintf(header, sizeof(header), "# %s Resume v%d.%02d.%02d", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+    line = me->m_BatchCacheFile.m_OutputData;
+    end = &me->m_BatchCacheFile.m_OutputData[me->m_BatchCacheFile.m_OutputLength - 1];
+    if((strncmp(line, header, strlen(header)) != 0) ||
+       ((line[strlen(header)] != '\r') && (line[strlen(header)] != '\n')))
+    {
+        // every output is rendered again by this version
+        printf("Batch cache \"%s\" is from another version\n", me->m_BatchCachePath);
+        return RESULT_OK;
+    }
+
+    // one entry per line at most
+    entryMax = 0;
+    while(line < end)
+    {
+        if((*line) == '\n')
         {
-            // skip the ':' and the value
-            int valueLength;
-            const char* valuePtr;
-            ptr++;
-            SKIP_WHITESPACE(ptr);
-            valueLength = JsonValueDataLength(ptr, jsonState); // recursive
-            if(valueLength > 0)
-            {
-                ptr += valueLength;
-                SKIP_WHITESPACE(ptr);
-                current = (*ptr);
-                // a value is only valid when
-                // followed by a valid character
-                if((current != ',') &&
-                    (current != ']') &&
-                    (current != '}') &&
-                    (current != '\0'))
-                {
-                    // a valid character was not found
-                    (*jsonState) = JSON_STATE_ERROR_VALUE_INVALID_FOLLOWER;
-                    // pretend nothing happened
-                    ptr = json;
-                }
-            }
-            else
-            {
-                // failed to skip the value.
-                // check jsonState for details.
-                // pretend nothing happened
-                ptr = json;
-            }
+            entryMax++;
         }
-        break;
+        line++;
+    }
+    me->m_BatchCacheEntries = (BatchCacheEntry_t*)malloc((size_t)(entryMax + 1) * sizeof(BatchCacheEntry_t));
+    if(me->m_BatchCacheEntries == NULL)
+    {
+        // failed to allocate memory
+        printf("Error: failed to read batch cache \"%s\"\n", me->m_BatchCachePath);
+        return RESULT_ERROR;
+    }
 
-        case ',':
+    line = me->m_BatchCacheFile.m_OutputData;
+    while(line < end)
+    {
+        char* args[BATCH_CACHE_ARGS];
+        char* newline = (char*)memchr(line, '\n', (size_t)(end - line));
+        if(newline == NULL)
         {
-            ptr++;
-            SKIP_WHITESPACE(ptr);
-            current = (*ptr);
-            // a comma is only valid when
-            // followed by a valid character
-            if(current != '{' &&
-               current != '[' &&
-               current != '"')
-            {
-                // a valid character was not found
-                (*jsonState) = JSON_STATE_ERROR_COMMA_INVALID_FOLLOWER;
-                // pretend nothing happened
-                ptr = json;
-            }
+            // the last line
+            newline = end;
         }
-        break;
 
-        default:
+        (*newline) = '\0';
+        if((line[0] != '#') &&
+           (MainSplitArgs(line, (int)(newline - line), args, BATCH_CACHE_ARGS) == BATCH_CACHE_ARGS))
         {
-            // whitespace or unexpected character
-            if(IS_WHITESPACE(*ptr))
-            {
-                ptr++;
-                SKIP_WHITESPACE(ptr);
-                current = (*ptr);
-            }
-            else
-            {
-                (*jsonState) = JSON_STATE_ERROR_UNEXPECTED_CHAR;
-            }
+            BatchCacheEntry_t* entry = &me->m_BatchCacheEntries[me->m_BatchCacheCount];
+            entry->m_CacheDestination = args[0];
+            entry->m_CacheInputSize = (int64_t)strtoll(args[1], NULL, 10);
+            entry->m_CacheInputTime = (int64_t)strtoll(args[2], NULL, 10);
+            entry->m_CacheInputHash = (uint64_t)strtoull(args[3], NULL, 16);
+            entry->m_CacheKey = (uint64_t)strtoull(args[4], NULL, 16);
+            me->m_BatchCacheCount++;
         }
-        break;
+        else
+        {
+            // the header or a line that is not an entry
+        }
+
+        line = (newline + 1);
     }
 
-    return ptr;
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static const char* JsonSkipToKeyValue( // recursive
-    const char* json,
-    const char* key,
-    JsonState_t* jsonState)
+static void BatchMatchCache(
+    Batch_t* me)
 {
-    char current;
-    SKIP_WHITESPACE(json);
-    current = (*json);
-    while((current != '\0') &&
-          (current != '}'))
+    int jobIndex = 0;
+    while(jobIndex < me->m_BatchJobCount)
     {
-        int keyLength;
+        BatchJob_t* job = &me->m_BatchJobs[jobIndex];
+        int entryIndex;
 
-        if(current == ',')
+        // the cache is written in manifest order so the
+        // entry at the same position is checked first
+        if((jobIndex < me->m_BatchCacheCount) &&
+           (strcmp(me->m_BatchCacheEntries[jobIndex].m_CacheDestination, job->m_JobDestination) == 0))
         {
-            // there are more keys
-            json++;
-            SKIP_WHITESPACE(json);
-            current = (*json);
+            job->m_JobCached = &me->m_BatchCacheEntries[jobIndex];
         }
         else
         {
-            // maybe this is the first key
-        }
-
-        keyLength = JsonStringDataLength(json, jsonState);
-        if(keyLength >= 2)
-        {
-            // found a key in quotes
-            if(strncmp((json + 1), key, (keyLength - 2)) == 0)
+            // the manifest changed
+            entryIndex = 0;
+            while(entryIndex < me->m_BatchCacheCount)
             {
-                // skip the key
-                json += keyLength;
-                SKIP_WHITESPACE(json);
-                current = (*json);
-                if(current == ':')
-                {
-                    json++;
-                    SKIP_WHITESPACE(json);
-                    current = (*json);
-                    // now at value
-                    break;
-                }
-                else
+                if(strcmp(me->m_BatchCacheEntries[entryIndex].m_CacheDestination, job->m_JobDestination) == 0)
                 {
-                    // expected ':'
-                    (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_VALUE_START;
-                    SKIP_TO_NULL(json);
+                    job->m_JobCached = &me->m_BatchCacheEntries[entryIndex];
                     break;
                 }
+                entryIndex++;
             }
-            else
-            {
-                // not the correct key.
-                const char* ptr;
+        }
 
-                // skip the key and the value
-                json += keyLength;
-                SKIP_WHITESPACE(json);
-                ptr = json;
-                json = JsonSkip(ptr, jsonState);
-                if(json == ptr)
-                {
-                    // failed to skip json data.
-                    // check jsonState for details.
-                    SKIP_TO_NULL(json);
-                    break;
-                }
-                current = (*json);
-            }
+        jobIndex++;
+    }
+}
+
+/**********************************************************/
+static Result_t BatchSaveCache(
+    Batch_t* me)
+{
+    Result_t result = RESULT_OK;
+    OutputBuffer_t output;
+    int jobIndex;
+
+    OutputBufferInit(&output);
+    OutputBufferPrintf(&output, "# %s Resume v%d.%02d.%02d\n", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+    OutputBufferPrintf(&output, "# destination size modified-nano hash key\n");
+
+    jobIndex = 0;
+    while(jobIndex < me->m_BatchJobCount)
+    {
+        BatchJob_t* job = &me->m_BatchJobs[jobIndex];
+        if(job->m_JobResult == RESULT_OK)
+        {
+            OutputBufferPrintf(&output, "%s %lld %lld %016llx %016llx\n",
+                job->m_JobDestination,
+                (long long)job->m_JobInputSize,
+                (long long)job->m_JobInputTime,
+                (unsigned long long)job->m_JobInputHash,
+                (unsigned long long)job->m_JobKey);
         }
         else
         {
-            // could not find a key
-            (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_KEY;
-            SKIP_TO_NULL(json);
-            break;
+            // left out so it runs again
         }
+        jobIndex++;
     }
 
-    return json;
+    if(output.m_OutputResult == RESULT_OK)
+    {
+        result = MainWriteOutput(me->m_BatchCachePath, &output);
+    }
+    else
+    {
+        // failed to allocate memory
+        result = RESULT_ERROR;
+    }
+    OutputBufferDeInit(&output);
+
+    return result;
 }
 
 /**********************************************************/
-static const char* JsonSkipToNextValue( // recursive
-    const char* json,
-    const char** key,
-    int* keyLength,
-    JsonState_t* jsonState)
+static int BatchRun(
+    Batch_t* me,
+    int threadCount)
 {
-    char current;
+    int failedCount = 0;
+    int index;
+#if defined(RESUME_THREADS)
+    // worker 0 is the calling thread
+    int started = 1;
+#endif
 
-    (*key) = NULL;
-    (*keyLength) = 0;
+    if(threadCount > me->m_BatchJobCount)
+    {
+        // one job per thread at most
+        threadCount = me->m_BatchJobCount;
+    }
+#if defined(RESUME_THREADS)
+    if(threadCount > RESUME_MAX_THREADS)
+    {
+        threadCount = RESUME_MAX_THREADS;
+    }
+#else
+    // the calling thread runs every job
+    threadCount = 1;
+#endif
 
-    SKIP_WHITESPACE(json);
-    current = (*json);
-    while((current != '\0') &&
-          (current != '}'))
+    me->m_BatchWorkers = (BatchWorker_t*)malloc((size_t)threadCount * sizeof(BatchWorker_t));
+    if(me->m_BatchWorkers == NULL)
     {
-        if(current == ',')
+        // failed to allocate memory
+        return INVALID_POSITION;
+    }
+
+    // each worker starts with an equal range of jobs
+    index = 0;
+    while(index < threadCount)
+    {
+        BatchWorker_t* worker = &me->m_BatchWorkers[index];
+        worker->m_WorkerBatch = me;
+        worker->m_WorkerNext = (int)(((int64_t)me->m_BatchJobCount * index) / threadCount);
+        worker->m_WorkerEnd = (int)(((int64_t)me->m_BatchJobCount * (index + 1)) / threadCount);
+        worker->m_WorkerDone = 0;
+        worker->m_WorkerStolen = 0;
+        worker->m_WorkerFailed = 0;
+        worker->m_WorkerSkipped = 0;
+        worker->m_WorkerSkippedByTime = 0;
+        OutputBufferInit(&worker->m_WorkerJson);
+        OutputBufferInit(&worker->m_WorkerOutput);
+        if(ResumeInit(&worker->m_WorkerResume, &me->m_BatchOptions) == RESULT_ERROR)
         {
-            // there are more keys
-            json++;
-            SKIP_WHITESPACE(json);
-            current = (*json);
+            // this worker only steals from the
+            // others and never finds a job
+            ResumeDeInit(&worker->m_WorkerResume);
+            OutputBufferDeInit(&worker->m_WorkerJson);
+            OutputBufferDeInit(&worker->m_WorkerOutput);
+            me->m_BatchWorkerCount = index;
+            break;
         }
-        else
+#if defined(RESUME_THREADS)
+        pthread_mutex_init(&worker->m_WorkerLock, NULL);
+#endif
+        index++;
+    }
+    if(index < threadCount)
+    {
+        // the jobs of a worker that could not start
+        // would never run
+        failedCount = INVALID_POSITION;
+    }
+    me->m_BatchWorkerCount = index;
+
+#if defined(RESUME_THREADS)
+    while((failedCount != INVALID_POSITION) && (started < me->m_BatchWorkerCount))
+    {
+        if(pthread_create(&me->m_BatchWorkers[started].m_WorkerThread, NULL, BatchWorkerThread, &me->m_BatchWorkers[started]) != 0)
         {
-            // maybe this is the first key
+            // the jobs of the workers that did not start
+            // are stolen by the others
+            break;
         }
+        started++;
+    }
+#endif
 
-        (*keyLength) = JsonStringDataLength(json, jsonState);
-        if((*keyLength) >= 2)
-        {
-            // found a key in quotes
-            (*key) = json;
+    if(failedCount != INVALID_POSITION)
+    {
+        BatchWorkerWork(&me->m_BatchWorkers[0]);
+    }
 
-            // skip the key
-            json += (*keyLength);
-            SKIP_WHITESPACE(json);
-            current = (*json);
-            if(current == ':')
-            {
-                json++;
-                SKIP_WHITESPACE(json);
-                current = (*json);
-                // now at value
-                break;
-            }
-            else
-            {
-                // expected ':'
-                (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_VALUE_START;
-                SKIP_TO_NULL(json);
-                break;
-            }
-        }
-        else
+#if defined(RESUME_THREADS)
+    while(started > 1)
+    {
+        started--;
+        pthread_join(me->m_BatchWorkers[started].m_WorkerThread, NULL);
+    }
+#endif
+
+    index = 0;
+    while(index < me->m_BatchWorkerCount)
+    {
+        BatchWorker_t* worker = &me->m_BatchWorkers[index];
+        if(failedCount != INVALID_POSITION)
         {
-            // could not find a key
-            (*jsonState) = JSON_STATE_ERROR_OBJECT_MISSING_KEY;
-            SKIP_TO_NULL(json);
-            break;
+            failedCount += worker->m_WorkerFailed;
         }
+        ResumeDeInit(&worker->m_WorkerResume);
+        OutputBufferDeInit(&worker->m_WorkerJson);
+        OutputBufferDeInit(&worker->m_WorkerOutput);
+#if defined(RESUME_THREADS)
+        pthread_mutex_destroy(&worker->m_WorkerLock);
+#endif
+        index++;
     }
 
-    return json;
+    return failedCount;
 }
 
 /**********************************************************/
-static const char* JsonArrayNextIndex( // recursive
-    const char* json,
-    int* currentIndex,
-    JsonState_t* jsonState)
-{
-    char current;
-
-    SKIP_WHITESPACE(json);
-    current = (*json);
-    if((current== ']') ||
-       (current == '\0'))
+static int BatchWorkerTake(
+    BatchWorker_t* me)
+{
+    Batch_t* batch = me->m_WorkerBatch;
+    int jobIndex = INVALID_POSITION;
+    int victimIndex;
+    int tries;
+
+#if defined(RESUME_THREADS)
+    pthread_mutex_lock(&me->m_WorkerLock);
+#endif
+    if(me->m_WorkerNext < me->m_WorkerEnd)
     {
-        // at end of array
-        (*currentIndex) = INVALID_POSITION;
-        return json;
+        jobIndex = me->m_WorkerNext;
+        me->m_WorkerNext++;
     }
-
-    // json is expected to be a non-whitespace
-    // character after a ',' or '['
-    if((*currentIndex) == INVALID_POSITION)
+#if defined(RESUME_THREADS)
+    pthread_mutex_unlock(&me->m_WorkerLock);
+#endif
+    if(jobIndex != INVALID_POSITION)
     {
-        // index 0
-        (*currentIndex) = 0;
+        return jobIndex;
     }
-    else
+
+    // steal from the other workers starting with the next
+    victimIndex = (int)(me - batch->m_BatchWorkers);
+    tries = 1;
+    while(tries < batch->m_BatchWorkerCount)
     {
-        // find the next index.
-        const char* skipPtr = JsonSkip(json, jsonState); // recursive
-        if(skipPtr != json)
+        BatchWorker_t* victim;
+        int stealStart = 0;
+        int stealEnd = 0;
+
+        victimIndex = ((victimIndex + 1) % batch->m_BatchWorkerCount);
+        victim = &batch->m_BatchWorkers[victimIndex];
+
+#if defined(RESUME_THREADS)
+        pthread_mutex_lock(&victim->m_WorkerLock);
+#endif
+        if(victim->m_WorkerNext < victim->m_WorkerEnd)
         {
-            if((*skipPtr) == ',')
-            {
-                // found the next index
-                (*currentIndex) = (*currentIndex) + 1;
-                json = (skipPtr + 1);
-                SKIP_WHITESPACE(json);
-                current = (*json);
-            }
-            else if(((*skipPtr) == ']') ||
-                    ((*skipPtr) == '\0'))
-            {
-                // found the end of the array
-                (*currentIndex) = INVALID_POSITION;
-                json = skipPtr;
-                current = (*json);
-            }
-            else
-            {
-                // unexpected character
-                (*jsonState) = JSON_STATE_ERROR_ARRAY_MISSING_NEXT_OR_END_CHAR;
-                SKIP_TO_NULL(json);
-                (*currentIndex) = INVALID_POSITION;
-            }
+            // half of the jobs left rounded up so the
+            // last job can be stolen
+            int stealCount = (((victim->m_WorkerEnd - victim->m_WorkerNext) + 1) / 2);
+            stealEnd = victim->m_WorkerEnd;
+            stealStart = (stealEnd - stealCount);
+            victim->m_WorkerEnd = stealStart;
         }
-        else
+#if defined(RESUME_THREADS)
+        pthread_mutex_unlock(&victim->m_WorkerLock);
+#endif
+
+        if(stealStart < stealEnd)
         {
-            // failed to skip json data.
-            // check jsonState for details.
-            // cannot find the end of the array element
-            SKIP_TO_NULL(json);
-            (*currentIndex) = INVALID_POSITION;
+            me->m_WorkerStolen += (stealEnd - stealStart);
+#if defined(RESUME_THREADS)
+            pthread_mutex_lock(&me->m_WorkerLock);
+#endif
+            // the first stolen job runs now
+            me->m_WorkerNext = (stealStart + 1);
+            me->m_WorkerEnd = stealEnd;
+#if defined(RESUME_THREADS)
+            pthread_mutex_unlock(&me->m_WorkerLock);
+#endif
+            return stealStart;
         }
+
+        tries++;
     }
 
-    return json;
+    // every range is empty
+    return INVALID_POSITION;
 }
 
-// MARK: --- RESUME ---
-
 /**********************************************************/
-static Result_t ResumeInit(
-    Resume_t* me,
-    ResumeOptions_t* resumeOptions)
+static Result_t BatchWorkerRunJob(
+    BatchWorker_t* me,
+    BatchJob_t* job)
 {
-    Section_t sectionIndex;
-
-    if(resumeOptions)
+    Resume_t* resume = &me->m_WorkerResume;
+    const BatchCacheEntry_t* cached = job->m_JobCached;
+    Result_t result;
+    int64_t outputSize;
+    int64_t outputTime;
+
+    if((cached) &&
+       (cached->m_CacheKey != job->m_JobKey))
     {
-        me->m_ResumeOptions = (*resumeOptions);
+        // the version or options changed
+        cached = NULL;
+    }
+    else if((cached) &&
+            (MainGetFileInfo(job->m_JobDestination, &outputSize, &outputTime) == RESULT_ERROR))
+    {
+        // the output was removed
+        cached = NULL;
     }
     else
     {
-        // using default resume options
-        me->m_ResumeOptions.m_ExtendedDisplayCount = DISPLAY_NONE;
-        me->m_ResumeOptions.m_DisplayFormat = FORMAT_TEXT;
+        // the output may be up to date
     }
 
-    // using INVALID_POSITION to indicate no errors
-    me->m_ResumeErrorInSection = INVALID_POSITION;
-
-    // using ENTRY_STATE_UNKNOWN to indicate no
-    // entry has been accessed
-    me->m_ResumeErrorInEntry = ENTRY_STATE_UNKNOWN;
-
-    // init hard-coded sections
-    sectionIndex = 0;
-    do
+    if((MainGetFileInfo(job->m_JobInput, &job->m_JobInputSize, &job->m_JobInputTime) == RESULT_OK) &&
+       (cached) &&
+       (job->m_JobInputSize == cached->m_CacheInputSize) &&
+       (job->m_JobInputTime == cached->m_CacheInputTime))
     {
-        SectionData_t* sectionData = &me->m_ResumeSection[sectionIndex];
-        SectionDataInit(sectionData);
-        sectionIndex++;
+        // the json file was not touched so its
+        // hash is the same as before
+        job->m_JobInputHash = cached->m_CacheInputHash;
+        job->m_JobResult = RESULT_OK;
+        me->m_WorkerSkipped++;
+        me->m_WorkerSkippedByTime++;
+        return RESULT_OK;
     }
-    while(sectionIndex < SECTION_COUNT);
-
-    // start with no runtime sections
-    me->m_ResumeSectionRuntime = NULL;
 
-    Result_t result = ManagedEntriesInit(&me->m_ResumeAllEntries, RESUME_MAX_ENTRIES);
+    OutputBufferClear(&me->m_WorkerJson);
+    result = MainReadFile(job->m_JobInput, &me->m_WorkerJson);
     if(result == RESULT_OK)
     {
-        // select an initial section size that seems
-        // reasonably large. a quarter of a page is more
-        // than enough.
-        int intSectionEntryCount = (RESUME_MAX_LINES_PER_PAGE / 4);
-
-        // setup hard-coded section initial entries size
-        sectionIndex = 0;
-        do
+        // the null-terminator is not part of the file
+        job->m_JobInputHash = HashFnv1a64(HASH_FNV64_OFFSET, me->m_WorkerJson.m_OutputData, (me->m_WorkerJson.m_OutputLength - 1));
+        if((cached) &&
+           (job->m_JobInputHash == cached->m_CacheInputHash))
         {
-            Result_t resizeResult;
-            SectionData_t* sectionData = &me->m_ResumeSection[sectionIndex];
-            resizeResult = EntriesResize(
-                &sectionData->m_SectionEntries,
-                intSectionEntryCount);
-            if(resizeResult == RESULT_ERROR)
-            {
-                // cannot set initial entries size
-                me->m_ResumeErrorInSection = sectionIndex;
-                result = RESULT_ERROR;
-            }
-            sectionIndex++;
+            // the json file was saved without changes
+            job->m_JobResult = RESULT_OK;
+            me->m_WorkerSkipped++;
+            return RESULT_OK;
         }
-        while(sectionIndex < SECTION_COUNT);
     }
-    else
+
+    ResumeClear(resume);
+    resume->m_ResumeOptions = job->m_JobOptions;
+    OutputBufferClear(&me->m_WorkerOutput);
+
+    if(result == RESULT_OK)
     {
-        // failed to init entries
+        result = ResumeLoad(resume, me->m_WorkerJson.m_OutputData, NULL, NULL);
+    }
+    if(result == RESULT_OK)
+    {
+        result = ResumePrintFormat(resume, &job->m_JobOptions, job->m_JobOptions.m_DisplayFormat, &me->m_WorkerOutput);
+    }
+    if(result == RESULT_OK)
+    {
+        result = MainWriteOutput(job->m_JobDestination, &me->m_WorkerOutput);
     }
+    job->m_JobResult = result;
 
     return result;
 }
 
 /**********************************************************/
-static Result_t ResumeOptionsIsHiddenSection(
-    ResumeOptions_t* me,
-    const char* sectionTitle)
+static void BatchWorkerWork(
+    BatchWorker_t* me)
 {
-    if(sectionTitle)
+    Batch_t* batch = me->m_WorkerBatch;
+    int jobIndex = BatchWorkerTake(me);
+    while(jobIndex != INVALID_POSITION)
     {
-        if(sectionTitle[0] != '\0')
+        BatchJob_t* job = &batch->m_BatchJobs[jobIndex];
+        if(BatchWorkerRunJob(me, job) == RESULT_ERROR)
         {
-            int index = 0;
-            while(index < me->m_HideSectionCount)
+            Resume_t* resume = &me->m_WorkerResume;
+            if((int)resume->m_ResumeErrorInSection != INVALID_POSITION)
             {
-                if(strcmp(sectionTitle, me->m_HideSectionName[index]) == 0)
-                {
-                    // resume option to hide this section is set
-                    return RESULT_YES;
-                }
-                index++;
+                ResumePrintLoadError(resume, "batch manifest line %d \"%s\"", job->m_JobLine, job->m_JobInput);
             }
+            else
+            {
+                printf("Error: batch manifest line %d \"%s\" failed\n", job->m_JobLine, job->m_JobInput);
+            }
+            me->m_WorkerFailed++;
         }
-        else
-        {
-            // empty title.
-            // always hide sections with no title
-            return RESULT_YES;
-        }
-    }
-    else
-    {
-        // title missing.
-        // always hide invalid sections
-        return RESULT_YES;
+        me->m_WorkerDone++;
+        jobIndex = BatchWorkerTake(me);
     }
-
-    return RESULT_NO;
 }
 
+#if defined(RESUME_THREADS)
 /**********************************************************/
-static void ResumeDeInit(
-    Resume_t* me)
+static void* BatchWorkerThread(
+    void* userData)
 {
-    // cleanup runtime sections
-    if(me->m_ResumeSectionRuntime)
-    {
-        SectionDataDeInit(me->m_ResumeSectionRuntime); // recursive
-        me->m_ResumeSectionRuntime = NULL;
-    }
+    BatchWorkerWork((BatchWorker_t*)userData);
+    return NULL;
+}
+#endif
 
-    // clean up hard-coded sections
-    int index = 0;
-    do
-    {
-        SectionDataDeInit(&me->m_ResumeSection[index]); // recursive
-        index++;
-    }
-    while(index < SECTION_COUNT);
+// MARK: --- BENCH ---
 
-    ManagedEntriesDeInit(&me->m_ResumeAllEntries);
+/**********************************************************/
+static void BenchInit(
+    Bench_t* me,
+    ResumeOptions_t* options)
+{
+    BenchSpec_t* spec = &me->m_BenchSpec;
+
+    // small enough to fit RESUME_MAX_ENTRIES with the
+    // hard-coded sections
+    spec->m_SpecIterations = 100;
+    spec->m_SpecSections = 8;
+    spec->m_SpecEntries = 12;
+    spec->m_SpecTextMin = 20;
+    spec->m_SpecTextMax = 120;
+    spec->m_SpecYearMin = 1990;
+    spec->m_SpecYearMax = 2026;
+    spec->m_SpecOngoing = 20;
+    spec->m_SpecDisplayMax = 5;
+    spec->m_SpecOrderWeight[ORDER_NEWEST_FIRST] = 2;
+    spec->m_SpecOrderWeight[ORDER_OLDEST_FIRST] = 1;
+    spec->m_SpecOrderWeight[ORDER_RANDOM] = 1;
+    spec->m_SpecSeed = 1;
+    spec->m_SpecCorpusSize = (256 * 1024);
+    spec->m_SpecDepth = 32;
+
+    me->m_BenchOptions = (*options);
+    OutputBufferInit(&me->m_BenchJson);
+    OutputBufferInit(&me->m_BenchOutput);
+    me->m_BenchTimes = NULL;
+    me->m_BenchCycles = NULL;
+    OutputBufferInit(&me->m_BenchStrings);
+    OutputBufferInit(&me->m_BenchObjects);
 }
 
 /**********************************************************/
-SectionData_t* ResumeInsertSection(
-    Resume_t* me,
-    Section_t section)
+static void BenchDeInit(
+    Bench_t* me)
 {
-    SectionData_t* sectionData;
-    
-    if(section < SECTION_AT_RUNTIME)
-    {
-        // cannot insert here
-        return NULL;
-    }
+    free(me->m_BenchTimes);
+    me->m_BenchTimes = NULL;
+    free(me->m_BenchCycles);
+    me->m_BenchCycles = NULL;
+    OutputBufferDeInit(&me->m_BenchJson);
+    OutputBufferDeInit(&me->m_BenchOutput);
+    OutputBufferDeInit(&me->m_BenchStrings);
+    OutputBufferDeInit(&me->m_BenchObjects);
+}
 
-    sectionData = (SectionData_t*)malloc(sizeof(SectionData_t));
-    if(sectionData == NULL)
-    {
-        // failed to allocate section data
-        return NULL;
-    }
+/**********************************************************/
+static Result_t BenchParseSpec(
+    Bench_t* me,
+    const char* spec)
+{
+    BenchSpec_t* specData = &me->m_BenchSpec;
+    const char* pos = spec;
 
-    if(section > SECTION_AT_RUNTIME)
+    while((*pos) != '\0')
     {
-        SectionData_t* previousSectionData = ResumeGetSectionData(me, (section - 1));
-        if(previousSectionData)
+        int* value = NULL;
+        int* rangeEnd = NULL;
+        int min = 0;
+        int max = INT_MAX;
+        int number;
+        int numberLength;
+        const char* end = strchr(pos, ',');
+        const char* equals = strchr(pos, '=');
+        int keyLength;
+
+        if(end == NULL)
         {
-            SectionDataInit(sectionData);
+            // the last pair
+            end = (pos + strlen(pos));
+        }
+        if((equals == NULL) || (equals > end))
+        {
+            printf("Error: benchmark spec \"%.*s\" is not key=value\n", (int)(end - pos), pos);
+            return RESULT_ERROR;
+        }
 
-            // save the link to the existing section
-            sectionData->m_SectionNext = previousSectionData->m_SectionNext;
+        keyLength = (int)(equals - pos);
+        if((keyLength == 10) && (strncmp(pos, "iterations", 10) == 0))
+        {
+            value = &specData->m_SpecIterations;
+            min = 1;
+            max = BENCH_MAX_ITERATIONS;
+        }
+        else if((keyLength == 8) && (strncmp(pos, "sections", 8) == 0))
+        {
+            value = &specData->m_SpecSections;
+            min = 1;
+        }
+        else if((keyLength == 7) && (strncmp(pos, "entries", 7) == 0))
+        {
+            value = &specData->m_SpecEntries;
+            min = 1;
+        }
+        else if((keyLength == 4) && (strncmp(pos, "text", 4) == 0))
+        {
+            value = &specData->m_SpecTextMin;
+            rangeEnd = &specData->m_SpecTextMax;
+            min = 1;
+            max = BENCH_MAX_TEXT_LENGTH;
+        }
+        else if((keyLength == 5) && (strncmp(pos, "years", 5) == 0))
+        {
+            // dates before 1970 or after 2037 cannot be
+            // stored in a 32bit time_t
+            value = &specData->m_SpecYearMin;
+            rangeEnd = &specData->m_SpecYearMax;
+            min = 1970;
+            max = 2037;
+        }
+        else if((keyLength == 7) && (strncmp(pos, "ongoing", 7) == 0))
+        {
+            value = &specData->m_SpecOngoing;
+            max = 100;
+        }
+        else if((keyLength == 7) && (strncmp(pos, "display", 7) == 0))
+        {
+            value = &specData->m_SpecDisplayMax;
+            min = DISPLAY_ALL;
+        }
+        else if((keyLength == 6) && (strncmp(pos, "newest", 6) == 0))
+        {
+            value = &specData->m_SpecOrderWeight[ORDER_NEWEST_FIRST];
+        }
+        else if((keyLength == 6) && (strncmp(pos, "oldest", 6) == 0))
+        {
+            value = &specData->m_SpecOrderWeight[ORDER_OLDEST_FIRST];
+        }
+        else if((keyLength == 6) && (strncmp(pos, "random", 6) == 0))
+        {
+            value = &specData->m_SpecOrderWeight[ORDER_RANDOM];
+        }
+        else if((keyLength == 4) && (strncmp(pos, "seed", 4) == 0))
+        {
+            value = &specData->m_SpecSeed;
+        }
+        else if((keyLength == 4) && (strncmp(pos, "size", 4) == 0))
+        {
+            value = &specData->m_SpecCorpusSize;
+            min = 1;
+            max = BENCH_MAX_CORPUS_SIZE;
+        }
+        else if((keyLength == 5) && (strncmp(pos, "depth", 5) == 0))
+        {
+            value = &specData->m_SpecDepth;
+            min = 1;
+            max = BENCH_MAX_DEPTH;
+        }
+        else
+        {
+            printf("Error: benchmark spec key \"%.*s\" is unknown\n", keyLength, pos);
+            return RESULT_ERROR;
+        }
 
-            // insert the new section
-            // after the previous section
-            previousSectionData->m_SectionNext = sectionData;
+        // a single number or a range such as 10-400
+        pos = (equals + 1);
+        if((StringToInt(pos, (int)(end - pos), &number, &numberLength) != RESULT_OK) ||
+           (number < min) ||
+           (number > max))
+        {
+            printf("Error: benchmark spec \"%.*s\" is out of range\n", (int)(end - equals + keyLength), (equals - keyLength));
+            return RESULT_ERROR;
+        }
+        (*value) = number;
+        pos += numberLength;
+        if(rangeEnd)
+        {
+            (*rangeEnd) = number;
+            if((*pos) == '-')
+            {
+                pos++;
+                if((StringToInt(pos, (int)(end - pos), &number, &numberLength) != RESULT_OK) ||
+                   (number < (*value)) ||
+                   (number > max))
+                {
+                    printf("Error: benchmark spec \"%.*s\" is out of range\n", (int)(end - equals + keyLength), (equals - keyLength));
+                    return RESULT_ERROR;
+                }
+                (*rangeEnd) = number;
+                pos += numberLength;
+            }
+            else
+            {
+                // min and max are the same
+            }
         }
         else
         {
-            // cannot insert here.
-            // there is no previous runtime 
-            // section to link to.
-            free(sectionData);
-            sectionData = NULL;
+            // a single number
         }
-    }
-    else
-    {
-        SectionDataInit(sectionData);
 
-        // placing this section at the start of the
-        // linked-list of sections added at runtime
-        if(me->m_ResumeSectionRuntime)
+        if(pos != end)
         {
-            // save the link to the existing section
-            sectionData->m_SectionNext = me->m_ResumeSectionRuntime;
+            printf("Error: benchmark spec \"%.*s\" is not a number\n", (int)(end - equals + keyLength), (equals - keyLength));
+            return RESULT_ERROR;
+        }
+        if((*pos) == ',')
+        {
+            pos++;
         }
-        
-        // save the new section as the first
-        me->m_ResumeSectionRuntime = sectionData;
     }
 
-    return sectionData;
+    if((specData->m_SpecOrderWeight[ORDER_NEWEST_FIRST] +
+        specData->m_SpecOrderWeight[ORDER_OLDEST_FIRST] +
+        specData->m_SpecOrderWeight[ORDER_RANDOM]) <= 0)
+    {
+        printf("Error: benchmark spec needs newest, oldest, or random above 0\n");
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
 }
 
 /**********************************************************/
-SectionData_t* ResumeRemoveSection(
-    Resume_t* me,
-    Section_t section)
+static Result_t BenchGenerate(
+    Bench_t* me)
 {
-    SectionData_t* sectionData;
-
-    if(section < SECTION_AT_RUNTIME)
+    BenchSpec_t* spec = &me->m_BenchSpec;
+    OutputBuffer_t* output = &me->m_BenchJson;
+    int weightTotal = (spec->m_SpecOrderWeight[ORDER_NEWEST_FIRST] +
+                       spec->m_SpecOrderWeight[ORDER_OLDEST_FIRST] +
+                       spec->m_SpecOrderWeight[ORDER_RANDOM]);
+    int section;
+
+    // the same spec always generates the same resume
+    srand((unsigned int)spec->m_SpecSeed);
+
+    OutputBufferAppend(output, "[\n", 2);
+    section = 0;
+    while(section < spec->m_SpecSections)
     {
-        // cannot remove this section
-        return NULL;
-    }
+        int order = 0;
+        int pick = (rand() % weightTotal);
+        int entry;
 
-    if(section > SECTION_AT_RUNTIME)
-    {
-        sectionData = ResumeGetSectionData(me, section);
-        if(sectionData)
+        // select an order by its weight
+        while(pick >= spec->m_SpecOrderWeight[order])
         {
-            // this is not effecient. the linked-list was
-            // already searched once so a pointer to the
-            // previous section could have been stored
-            SectionData_t* previousSectionData = ResumeGetSectionData(me, (section - 1));
-            if(previousSectionData)
+            pick -= spec->m_SpecOrderWeight[order];
+            order++;
+        }
+
+        OutputBufferPrintf(output,
+            "{ \"" RESUME_STRING_NAME "\": \"Section %d\", "
+            "\"" RESUME_STRING_ORDER "\": \"%s\", "
+            "\"" RESUME_STRING_DATE_ORDER "\": \"%s\", "
+            "\"" RESUME_STRING_DISPLAY_MAX "\": %d, "
+            "\"" RESUME_STRING_ENTRIES "\": [\n",
+            section,
+            g_OrderLookup[order],
+            ((rand() % 2) ? RESUME_STRING_DATE_END : RESUME_STRING_DATE_START),
+            spec->m_SpecDisplayMax);
+
+        entry = 0;
+        while(entry < spec->m_SpecEntries)
+        {
+            int textLength = spec->m_SpecTextMin + (rand() % ((spec->m_SpecTextMax - spec->m_SpecTextMin) + 1));
+            int startYear = spec->m_SpecYearMin + (rand() % ((spec->m_SpecYearMax - spec->m_SpecYearMin) + 1));
+            int startMonth = ((rand() % 12) + 1);
+            int startDay = ((rand() % 28) + 1);
+
+            OutputBufferAppend(output, "{ \"" RESUME_STRING_TEXT "\": \"", (int)(sizeof("{ \"" RESUME_STRING_TEXT "\": \"") - 1));
+            BenchAppendText(output, textLength);
+            OutputBufferPrintf(output, "\", \"" RESUME_STRING_DATE_START "\": \"" DATE_STRING_FORMAT "\", ", startYear, startMonth, startDay);
+            if((rand() % 100) < spec->m_SpecOngoing)
             {
-                // removing this section data from the
-                // linked-list
-                previousSectionData->m_SectionNext = sectionData->m_SectionNext;
-                sectionData->m_SectionNext = NULL;
+                OutputBufferPrintf(output, "\"" RESUME_STRING_DATE_END "\": \"\" }");
             }
             else
             {
-                // this should not be possible.
-                // ResumeGetSectionData() could not return a
-                // valid pointer if there was no previous
-                // section data at this section index
+                // ends 1 to 36 months later
+                int months = (startMonth - 1) + ((rand() % 36) + 1);
+                int endYear = startYear + (months / 12);
+                if(endYear > 2037)
+                {
+                    // keep within a 32bit time_t
+                    endYear = 2037;
+                }
+                OutputBufferPrintf(output, "\"" RESUME_STRING_DATE_END "\": \"" DATE_STRING_FORMAT "\" }", endYear, ((months % 12) + 1), startDay);
             }
+            entry++;
+            OutputBufferAppend(output, (entry < spec->m_SpecEntries) ? ",\n" : "\n", (entry < spec->m_SpecEntries) ? 2 : 1);
+        }
+
+        section++;
+        OutputBufferAppend(output, (section < spec->m_SpecSections) ? "]},\n" : "]}\n", (section < spec->m_SpecSections) ? 4 : 3);
+    }
+    // include the null-terminator so the json
+    // can be parsed from the buffer
+    OutputBufferAppend(output, "]", 2);
+
+    return output->m_OutputResult;
+}
+
+/**********************************************************/
+static void BenchAppendText(
+    OutputBuffer_t* output,
+    int length)
+{
+    char text[BENCH_MAX_TEXT_LENGTH];
+    int wordLength = 0;
+    int index = 0;
+
+    while(index < length)
+    {
+        // words of 2 to 9 letters. the text never
+        // starts or ends with a space
+        if((wordLength >= 2) && (index < (length - 1)) && ((rand() % 8) == 0))
+        {
+            text[index] = ' ';
+            wordLength = 0;
         }
         else
         {
-            // this section does not exist
+            text[index] = (char)('a' + (rand() % 26));
+            wordLength++;
         }
+        index++;
     }
-    else if(me->m_ResumeSectionRuntime)
+
+    OutputBufferAppend(output, text, length);
+}
+
+/**********************************************************/
+static Result_t BenchRunIteration(
+    Bench_t* me,
+    int64_t times[BENCH_PHASE_COUNT])
+{
+    Resume_t resume;
+    Result_t result;
+    int64_t loadTimes[LOAD_PHASE_COUNT];
+    int64_t start;
+    int64_t now;
+
+    start = TimeNowNano();
+    result = ResumeInit(&resume, &me->m_BenchOptions);
+    now = TimeNowNano();
+    times[BENCH_PHASE_INIT] = (now - start);
+
+    if(result != RESULT_ERROR)
     {
-        // removing the first runtime section
-        sectionData = me->m_ResumeSectionRuntime;       
-        me->m_ResumeSectionRuntime = sectionData->m_SectionNext;
-        sectionData->m_SectionNext = NULL;
+        result = ResumeLoad(&resume, me->m_BenchJson.m_OutputData, BenchLoadTime, loadTimes);
+        if(result == RESULT_ERROR)
+        {
+            ResumePrintLoadError(&resume, "benchmark resume");
+        }
+        times[BENCH_PHASE_FILL] = (loadTimes[LOAD_PHASE_ORDER] - loadTimes[LOAD_PHASE_FILL]);
+        times[BENCH_PHASE_ORDER] = (loadTimes[LOAD_PHASE_DONE] - loadTimes[LOAD_PHASE_ORDER]);
+        now = loadTimes[LOAD_PHASE_DONE];
     }
     else
     {
-        // no runtime section to remove
+        printf("Error: benchmark resume could not be initialized\n");
+        times[BENCH_PHASE_FILL] = 0;
+        times[BENCH_PHASE_ORDER] = 0;
     }
 
-    return sectionData;
+    // the output buffer is reused so only the first
+    // iteration pays for growing it
+    OutputBufferClear(&me->m_BenchOutput);
+    start = now;
+    if(result != RESULT_ERROR)
+    {
+        result = ResumePrintFormat(&resume, &me->m_BenchOptions, FORMAT_TEXT, &me->m_BenchOutput);
+    }
+    now = TimeNowNano();
+    times[BENCH_PHASE_RENDER_TEXT] = (now - start);
+
+    OutputBufferClear(&me->m_BenchOutput);
+    start = now;
+    if(result != RESULT_ERROR)
+    {
+        result = ResumePrintFormat(&resume, &me->m_BenchOptions, FORMAT_HTML, &me->m_BenchOutput);
+    }
+    now = TimeNowNano();
+    times[BENCH_PHASE_RENDER_HTML] = (now - start);
+
+    if((result == RESULT_ERROR) && (me->m_BenchOutput.m_OutputResult == RESULT_ERROR))
+    {
+        printf("Error: benchmark resume could not be rendered\n");
+    }
+
+    start = now;
+    ResumeDeInit(&resume);
+    now = TimeNowNano();
+    times[BENCH_PHASE_DEINIT] = (now - start);
+
+    return result;
 }
 
 /**********************************************************/
-Section_t ResumeGetSectionCount(
-    Resume_t* me)
+static void BenchLoadTime(
+    LoadPhase_t phase,
+    void* userData)
 {
-    Section_t count = SECTION_COUNT;
-    SectionData_t* sectionData = me->m_ResumeSectionRuntime;
-    while(sectionData)
-    {
-        count++;
-        sectionData = sectionData->m_SectionNext;
-    }
-    return count;
+    int64_t* loadTimes = (int64_t*)userData;
+    loadTimes[phase] = TimeNowNano();
 }
 
 /**********************************************************/
-SectionData_t* ResumeGetSectionData(
-    Resume_t* me,
-    Section_t section)
+static Result_t BenchRun(
+    Bench_t* me)
 {
-    SectionData_t* sectionData = NULL;
+    int iterations = me->m_BenchSpec.m_SpecIterations;
+    int64_t times[BENCH_PHASE_COUNT];
+    int iteration;
 
-    if(section < SECTION_COUNT)
+    me->m_BenchTimes = (int64_t*)malloc((size_t)iterations * BENCH_PHASE_COUNT * sizeof(int64_t));
+    if(me->m_BenchTimes == NULL)
     {
-        // hard-coded section
-        sectionData = &me->m_ResumeSection[section];
+        printf("Error: failed to allocate benchmark times\n");
+        return RESULT_ERROR;
     }
-    else
+
+    // the first iteration is not timed so every
+    // timed iteration starts with warm caches
+    if(BenchRunIteration(me, times) == RESULT_ERROR)
     {
-        section -= SECTION_AT_RUNTIME;
-        if(section >= 0)
+        printf("Error: the benchmark resume may need a larger -DRESUME_MAX_PAGES\n");
+        return RESULT_ERROR;
+    }
+
+    iteration = 0;
+    while(iteration < iterations)
+    {
+        int phase = 0;
+        if(BenchRunIteration(me, times) == RESULT_ERROR)
         {
-            // runtime section
-            sectionData = me->m_ResumeSectionRuntime;
-            while(section > 0)
-            {
-                sectionData = sectionData->m_SectionNext;
-                section--;
-                if(sectionData == NULL)
-                {
-                    // section is missing
-                    break;
-                }
-            }
+            return RESULT_ERROR;
         }
-        else
+        do
         {
-            // no section selected
+            me->m_BenchTimes[(phase * iterations) + iteration] = times[phase];
+            phase++;
         }
+        while(phase < BENCH_PHASE_COUNT);
+        iteration++;
     }
 
-    return sectionData;
+    return RESULT_OK;
 }
 
 /**********************************************************/
-Section_t ResumeGetSectionIndex(
-    Resume_t* me,
-    SectionData_t* sectionData)
+static void BenchReport(
+    Bench_t* me)
 {
-    Section_t section = 0;
+    BenchSpec_t* spec = &me->m_BenchSpec;
+    int iterations = spec->m_SpecIterations;
+    int64_t medianTotal = 0;
+    int phase = 0;
+
+    printf("Benchmark of %d iterations with %d sections of %d entries. %d bytes of json\n",
+        iterations,
+        spec->m_SpecSections,
+        spec->m_SpecEntries,
+        (me->m_BenchJson.m_OutputLength - 1));
+    printf("    text=%d-%d years=%d-%d ongoing=%d display=%d newest=%d oldest=%d random=%d seed=%d threads=%d\n",
+        spec->m_SpecTextMin,
+        spec->m_SpecTextMax,
+        spec->m_SpecYearMin,
+        spec->m_SpecYearMax,
+        spec->m_SpecOngoing,
+        spec->m_SpecDisplayMax,
+        spec->m_SpecOrderWeight[ORDER_NEWEST_FIRST],
+        spec->m_SpecOrderWeight[ORDER_OLDEST_FIRST],
+        spec->m_SpecOrderWeight[ORDER_RANDOM],
+        spec->m_SpecSeed,
+        ((me->m_BenchOptions.m_ThreadCount > 1) ? me->m_BenchOptions.m_ThreadCount : 1));
+    printf("\n");
+    printf("    %-12s %12s %12s %12s\n", "phase", "median us", "p99 us", "mean us");
     do
     {
-        if(&me->m_ResumeSection[section] == sectionData)
-        {
-            return section;
-        }
-        section++;
-    }
-    while (section < SECTION_COUNT);
-    
-    SectionData_t* runtimeSection = me->m_ResumeSectionRuntime;
-    while(runtimeSection)
-    {
-        if(runtimeSection == sectionData)
+        int64_t* times = &me->m_BenchTimes[phase * iterations];
+        int64_t total = 0;
+        int index = 0;
+
+        qsort(times, (size_t)iterations, sizeof(int64_t), BenchCompareTimes);
+        while(index < iterations)
         {
-            return section;
+            total += times[index];
+            index++;
         }
-        section++;
-        runtimeSection = runtimeSection->m_SectionNext;
+
+        // the p99 is the smallest time that is at least
+        // as large as 99% of the times
+        printf("    %-12s %12.3f %12.3f %12.3f\n",
+            g_BenchPhaseLookup[phase],
+            ((double)times[iterations / 2] / 1000.0),
+            ((double)times[(((iterations * 99) + 99) / 100) - 1] / 1000.0),
+            (((double)total / iterations) / 1000.0));
+        medianTotal += times[iterations / 2];
+        phase++;
     }
+    while(phase < BENCH_PHASE_COUNT);
+    printf("    %-12s %12.3f\n", "total", ((double)medianTotal / 1000.0));
+}
 
-    return INVALID_POSITION;
+/**********************************************************/
+static int BenchCompareTimes(
+    const void* left,
+    const void* right)
+{
+    int64_t leftTime = *((const int64_t*)left);
+    int64_t rightTime = *((const int64_t*)right);
+    return (leftTime > rightTime) - (leftTime < rightTime);
 }
 
 /**********************************************************/
-static const char* ResumeGetSectionTitle(
-    Resume_t* me,
-    Section_t section)
+static Result_t BenchGenerateCorpus(
+    Bench_t* me,
+    BenchCorpus_t corpus)
 {
-    SectionData_t* sectionData = ResumeGetSectionData(me, section);
-    if(sectionData)
+    OutputBuffer_t* output = &me->m_BenchJson;
+    JsonState_t jsonState = JSON_STATE_OK;
+    int arrayIndex = INVALID_POSITION;
+    int objectCount = 0;
+    const char* json;
+    const char* end;
+
+    // every corpus is generated the same way each run
+    srand((unsigned int)me->m_BenchSpec.m_SpecSeed);
+
+    OutputBufferClear(output);
+    OutputBufferClear(&me->m_BenchStrings);
+    OutputBufferClear(&me->m_BenchObjects);
+
+    OutputBufferAppend(output, (corpus == BENCH_CORPUS_PRETTY) ? "[\n" : "[", (corpus == BENCH_CORPUS_PRETTY) ? 2 : 1);
+    do
     {
-        return sectionData->m_SectionTitle;
+        if(objectCount > 0)
+        {
+            OutputBufferAppend(output, (corpus == BENCH_CORPUS_PRETTY) ? ",\n" : ",", (corpus == BENCH_CORPUS_PRETTY) ? 2 : 1);
+        }
+        BenchAppendCorpusObject(me, corpus);
+        objectCount++;
     }
+    while((output->m_OutputLength < me->m_BenchSpec.m_SpecCorpusSize) &&
+          (output->m_OutputResult == RESULT_OK));
 
-    // invalid section
-    return g_EmptyText;
-}
+    // include the null-terminator so the json
+    // can be parsed from the buffer
+    OutputBufferAppend(output, (corpus == BENCH_CORPUS_PRETTY) ? "\n]" : "]", (corpus == BENCH_CORPUS_PRETTY) ? 3 : 2);
+    if(output->m_OutputResult != RESULT_OK)
+    {
+        return RESULT_ERROR;
+    }
 
-/**********************************************************/
-static Result_t ResumeAddEntry(
-    Resume_t* me,
-    Section_t section,
-    const char* text,
-    const char* start,
-    const char* end)
-{
-    Result_t result = RESULT_OK;
-    SectionData_t* sectionData = ResumeGetSectionData(me, section);
-    if(sectionData)
+    // the offset of every string. json only has quotes
+    // within strings so after a string the next quote
+    // starts another string
+    json = strchr(output->m_OutputData, '"');
+    while(json)
     {
-        // set the text with practically no upper bounds
-        result = SectionAddEntry(sectionData, me, text, MAX_STRING_LENGTH, start, end);
+        int offset = (int)(json - output->m_OutputData);
+        int length = JsonStringDataLength(json, &jsonState);
+        if((length < 2) || (jsonState != JSON_STATE_OK))
+        {
+            return RESULT_ERROR;
+        }
+        OutputBufferAppend(&me->m_BenchStrings, (const char*)&offset, sizeof(offset));
+        json = strchr((json + length), '"');
     }
-    else
+
+    // the offset of every object in the array
+    json = JsonArrayNextIndex((output->m_OutputData + 1), &arrayIndex, &jsonState); // recursive
+    while((arrayIndex != INVALID_POSITION) && (jsonState == JSON_STATE_OK))
     {
-        // section data is missing
-        me->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_SECTION_MISSING;
-        me->m_ResumeErrorInSection = section;
-        result = RESULT_ERROR;
+        int offset = (int)(json - output->m_OutputData);
+        OutputBufferAppend(&me->m_BenchObjects, (const char*)&offset, sizeof(offset));
+        json = JsonArrayNextIndex(json, &arrayIndex, &jsonState); // recursive
     }
 
-    return result;
+    // the whole corpus must be a single valid value
+    end = JsonSkip(output->m_OutputData, &jsonState); // recursive
+    if((jsonState != JSON_STATE_OK) ||
+       ((*end) != '\0') ||
+       (me->m_BenchStrings.m_OutputResult != RESULT_OK) ||
+       (me->m_BenchObjects.m_OutputResult != RESULT_OK))
+    {
+        return RESULT_ERROR;
+    }
+
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static Result_t SectionAddEntry(
-    SectionData_t* me,
-    Resume_t* resume,
-    const char* text,
-    int textLength,
-    const char* start,
-    const char* end)
+static void BenchAppendCorpusObject(
+    Bench_t* me,
+    BenchCorpus_t corpus)
 {
-    Result_t result = RESULT_OK;
-    Entry_t* entry = ManagedEntriesAppendSubstr(&resume->m_ResumeAllEntries, text, textLength, start, end);
-    if(entry)
+    OutputBuffer_t* output = &me->m_BenchJson;
+
+    switch(corpus)
     {
-        result = SectionDataIncludeEntry(me, entry);
-        if(result == RESULT_ERROR)
+    case BENCH_CORPUS_FLAT:
+    {
+        // short keys and values without whitespace.
+        // array values must be strings, objects, or
+        // arrays. see JSON_STATE_ERROR_COMMA_INVALID_FOLLOWER
+        OutputBufferPrintf(output, "{\"id\":%d,\"name\":\"", rand());
+        BenchAppendText(output, (4 + (rand() % 12)));
+        OutputBufferPrintf(output, "\",\"ok\":%s,\"ratio\":-%d.%de%d,\"none\":null,\"tags\":[\"t%d\",\"t%d\",\"t%d\"]}",
+            ((rand() % 2) ? "true" : "false"),
+            (rand() % 100),
+            (rand() % 100),
+            (rand() % 10),
+            (rand() % 1000),
+            (rand() % 1000),
+            (rand() % 1000));
+    }
+    break;
+
+    case BENCH_CORPUS_NESTED:
+    {
+        // a single chain of objects
+        int depth = 0;
+        while(depth < me->m_BenchSpec.m_SpecDepth)
         {
-            // the only way including an entry can fail
-            // with an error is if the section could not
-            // be resized to fit the entry
-            resume->m_ResumeErrorInEntry = ENTRY_STATE_ERROR_RESIZE;
-            resume->m_ResumeErrorInSection = ResumeGetSectionIndex(resume, me);
+            OutputBufferPrintf(output, "{\"n%d\":%d,\"child\":", depth, rand() % 100);
+            depth++;
+        }
+        OutputBufferAppend(output, "null", 4);
+        while(depth > 0)
+        {
+            OutputBufferAppend(output, "}", 1);
+            depth--;
         }
     }
-    else
+    break;
+
+    case BENCH_CORPUS_ESCAPES:
     {
-        // failed to create entry
-        resume->m_ResumeErrorInEntry = resume->m_ResumeAllEntries.m_ManagedEntriesError;
-        resume->m_ResumeErrorInSection = ResumeGetSectionIndex(resume, me);
-        result = RESULT_ERROR;
+        // an escape sequence every few characters
+        static const char* escapes[] = { "\\n", "\\t", "\\\"", "\\\\", "\\/", "\\u00e9", "\\ud83d\\ude00" };
+        int length = (256 + (rand() % 1024));
+        OutputBufferAppend(output, "{\"text\":\"", 9);
+        while(length > 0)
+        {
+            int textLength = (1 + (rand() % 8));
+            const char* escape = escapes[rand() % (int)(sizeof(escapes) / sizeof(escapes[0]))];
+            BenchAppendText(output, textLength);
+            OutputBufferAppend(output, escape, (int)strlen(escape));
+            length -= (textLength + 1);
+        }
+        OutputBufferAppend(output, "\"}", 2);
     }
+    break;
 
-    return result;
+    case BENCH_CORPUS_PRETTY: // fall-through
+    default:
+    {
+        // a resume section indented by 4 spaces
+        int entry = 0;
+        int entryCount = (2 + (rand() % 6));
+        OutputBufferAppend(output, "    {\n        \"" RESUME_STRING_NAME "\" : \"", (int)(sizeof("    {\n        \"" RESUME_STRING_NAME "\" : \"") - 1));
+        BenchAppendText(output, (8 + (rand() % 16)));
+        OutputBufferPrintf(output, "\",\n        \"" RESUME_STRING_DISPLAY_MAX "\" : %d,\n        \"" RESUME_STRING_ENTRIES "\" : [\n", (rand() % 8));
+        while(entry < entryCount)
+        {
+            OutputBufferAppend(output, "            {\n                \"" RESUME_STRING_TEXT "\" : \"", (int)(sizeof("            {\n                \"" RESUME_STRING_TEXT "\" : \"") - 1));
+            BenchAppendText(output, (20 + (rand() % 100)));
+            OutputBufferPrintf(output, "\",\n                \"" RESUME_STRING_DATE_START "\" : \"" DATE_STRING_FORMAT "\"\n            }", (1990 + (rand() % 36)), (1 + (rand() % 12)), (1 + (rand() % 28)));
+            entry++;
+            OutputBufferAppend(output, (entry < entryCount) ? ",\n" : "\n", (entry < entryCount) ? 2 : 1);
+        }
+        OutputBufferAppend(output, "        ]\n    }", 15);
+    }
+    break;
+    }
 }
 
 /**********************************************************/
-static void ResumePrintHtml(
-    Resume_t* me)
+static int64_t BenchJsonWalk(
+    Bench_t* me,
+    BenchPrimitive_t primitive,
+    JsonState_t* jsonState)
 {
-    static const char dateRangeSeparator[] = " to ";
-    static const int datePos[ENTRY_TIME_COUNT] =
-        {
-            0, // ENTRY_TIME_START
-            (DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1)) // ENTRY_TIME_END
-        };
+    const char* json = me->m_BenchJson.m_OutputData;
+    int64_t bytes = 0;
 
-    // start date + separator + end date + space + null
-    char dateString[DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1) + DATE_STRING_LENGTH + 1 + 1];
+    switch(primitive)
+    {
+    case BENCH_PRIMITIVE_SKIP:
+    {
+        // the whole array at once
+        bytes = (int64_t)(JsonSkip(json, jsonState) - json); // recursive
+    }
+    break;
 
-    //
-    // PRINT
-    //
-    // header
-    //
-    printf("<!doctype html>\r\n");
-    printf("<html lang=\"en-us\">\r\n");
-    printf("<head>\r\n");
-    printf("    <title>%s - Resume</title>\r\n", g_ResumeFullName);
-    printf("</head>\r\n");
-    printf("<body>\r\n");
-    printf("<p>\r\n");
-    printf("%s<br/>\r\n", g_ResumeFullName);
-    printf("%s<br/>\r\n", g_ResumeEmail);
-    printf("%s, %s<br/>\r\n", g_ResumeCity, g_ResumeState);
-    printf("%s<br/>\r\n", g_ResumeMobileNumber);
-    printf("<a href=\"%s\">%s</a>\r\n", g_ResumeWebUrl, g_ResumeWebUrl);
-    printf("</p>\r\n");
-    printf("\r\n");
+    case BENCH_PRIMITIVE_STRING:
+    {
+        // every string on its own
+        const int* offsets = (const int*)me->m_BenchStrings.m_OutputData;
+        int count = (me->m_BenchStrings.m_OutputLength / (int)sizeof(int));
+        int index = 0;
+        while(index < count)
+        {
+            bytes += JsonStringDataLength(&json[offsets[index]], jsonState);
+            index++;
+        }
+    }
+    break;
 
-    // print all sections
-    EntriesTraverse_t traverse;
-    int sectionIndex = 0;
-    SectionData_t* sectionData = ResumeGetSectionData(me, sectionIndex);
-    while(sectionData)
+    case BENCH_PRIMITIVE_ARRAY:
     {
-        if(sectionData->m_SectionDisplayMax != DISPLAY_NONE)
+        // every object of the array
+        const char* next;
+        int arrayIndex = INVALID_POSITION;
+        next = JsonArrayNextIndex((json + 1), &arrayIndex, jsonState); // recursive
+        while(arrayIndex != INVALID_POSITION)
         {
-            int dateStringStart = 0;
-            int displayCount = 0;
+            next = JsonArrayNextIndex(next, &arrayIndex, jsonState); // recursive
+        }
+        bytes = (int64_t)(next - json);
+    }
+    break;
 
-            // adjust date string start position
-            if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_ALL) == DATE_OPTION_HIDE_ALL)
-            {
-                // the date is always
-                // hidden in this section
-                dateStringStart = (sizeof(dateString) - 1);
-            }
-            else if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_START) == DATE_OPTION_HIDE_START)
+    case BENCH_PRIMITIVE_OBJECT: // fall-through
+    default:
+    {
+        // every key of every object the same as
+        // ResumeFillSectionFromJsonObject()
+        const int* offsets = (const int*)me->m_BenchObjects.m_OutputData;
+        int count = (me->m_BenchObjects.m_OutputLength / (int)sizeof(int));
+        int index = 0;
+        while(index < count)
+        {
+            const char* object = &json[offsets[index]];
+            const char* key;
+            int keyLength;
+            const char* value = JsonSkipToNextValue((object + 1), &key, &keyLength, jsonState); // recursive
+            while(keyLength > 2)
             {
-                // the start date is always
-                // hidden in this section
-                dateStringStart = datePos[ENTRY_TIME_END];
-            }
-
-            //
-            // PRINT
-            //
-            // section title
-            //
-            printf("<hr/>\r\n");
-            printf("<h1>%s</h1>\r\n", sectionData->m_SectionTitle);
-            printf("<p>\r\n");
-
-            EntriesTraverseInit(&traverse);
-            Entry_t* entry = EntriesTraverseFirst(&traverse, &sectionData->m_SectionEntries, sectionData->m_SectionOrder, sectionData->m_SectionOrderEntryTime);
-            while(entry)
-            {
-                // format the date string
-                int datesShown = 0;
-                datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_START]], DATE_STRING_LENGTH, ENTRY_TIME_START, sectionData->m_SectionDateOption) > 0);
-                datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_END]], DATE_STRING_LENGTH, ENTRY_TIME_END, sectionData->m_SectionDateOption) > 0);
-                if(datesShown == 2)
+                int valueLength = JsonValueDataLength(value, jsonState); // recursive
+                if(valueLength == 0)
                 {
-                    // both dates are shown.
-                    // include the separator
-                    memcpy(&dateString[DATE_STRING_LENGTH], dateRangeSeparator, sizeof(dateRangeSeparator)-1);
-                    dateString[sizeof(dateString)-2] = ' ';
-                    dateString[sizeof(dateString)-1] = '\0';
-                }
-                else if(datesShown == 1)
-                {
-                    // only 1 or no date is shown.
-                    if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_END) == DATE_OPTION_HIDE_END)
-                    {
-                        // entire end date is hidden.
-                        // only the start date is shown.
-                        dateString[DATE_STRING_LENGTH]   = ' ';
-                        dateString[DATE_STRING_LENGTH + 1] = '\0';
-                    }
-                    else
-                    {
-                        // the end date is not hidden so
-                        // the start date must be.
-                        // fill the separator with spaces
-                        memset(&dateString[DATE_STRING_LENGTH], ' ', sizeof(dateRangeSeparator)-1);
-                        dateString[sizeof(dateString)-2] = ' ';
-                        dateString[sizeof(dateString)-1] = '\0';
-                    }
-                }
-                else
-                {
-                    // no dates shown
-                    dateString[dateStringStart] = '\0';
-                }
-
-                //
-                // PRINT
-                //
-                // date string and entry text
-                //
-                printf("%s%s<br/>\r\n", &dateString[dateStringStart], entry->m_EntryText);
-
-                // check if more entries should be displayed
-                if(sectionData->m_SectionDisplayMax != DISPLAY_ALL)
-                {
-                    displayCount++;
-                    if(displayCount == sectionData->m_SectionDisplayMax)
-                    {
-                        // max display count reached.
-                        // break out of this loop
-                        break;
-                    }
+                    break;
                 }
-
-                entry = EntriesTraverseNext(&traverse);
+                value = JsonSkipToNextValue((value + valueLength), &key, &keyLength, jsonState); // recursive
             }
-            EntriesTraverseDeInit(&traverse);
-
-            //
-            // PRINT
-            //
-            // end of section
-            //
-            printf("</p>\r\n");
-            printf("\r\n");
-        }
-        else
-        {
-            // this section is hidden
+            bytes += (int64_t)(value - object);
+            index++;
         }
-
-        sectionIndex++;
-        sectionData = ResumeGetSectionData(me, sectionIndex);
+    }
+    break;
     }
 
-    //
-    // PRINT
-    //
-    // footer
-    //
-    printf("</body>\r\n");
-    printf("</html>\r\n");
+    return bytes;
 }
 
 /**********************************************************/
-static void ResumePrintPlainText(
-    Resume_t* me)
+static Result_t BenchJsonRun(
+    Bench_t* me)
 {
-    static const char dateRangeSeparator[] = " to ";
-    static const int datePos[ENTRY_TIME_COUNT] =
-        {
-            0, // ENTRY_TIME_START
-            (DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1)) // ENTRY_TIME_END
-        };
+    int iterations = me->m_BenchSpec.m_SpecIterations;
+    BenchCorpus_t corpus;
 
-    // start date + separator + end date + space + null
-    char dateString[DATE_STRING_LENGTH + (sizeof(dateRangeSeparator)-1) + DATE_STRING_LENGTH + 1 + 1];
+    me->m_BenchTimes = (int64_t*)malloc((size_t)iterations * sizeof(int64_t));
+    me->m_BenchCycles = (int64_t*)malloc((size_t)iterations * sizeof(int64_t));
+    if((me->m_BenchTimes == NULL) || (me->m_BenchCycles == NULL))
+    {
+        printf("Error: failed to allocate benchmark times\n");
+        return RESULT_ERROR;
+    }
 
-    //
-    // PRINT
-    //
-    // header
-    //
-    printf("=======================================\n");
-    printf("%s\n", g_ResumeFullName);
-    printf("%s\n", g_ResumeEmail);
-    printf("%s, %s\n", g_ResumeCity, g_ResumeState);
-    printf("%s\n", g_ResumeMobileNumber);
-    printf("%s\n", g_ResumeWebUrl);
+    printf("JSON benchmark of %d iterations over %d byte corpora. depth=%d seed=%d\n",
+        iterations,
+        me->m_BenchSpec.m_SpecCorpusSize,
+        me->m_BenchSpec.m_SpecDepth,
+        me->m_BenchSpec.m_SpecSeed);
+#if !defined(RESUME_RDTSC)
+    printf("    cycles per byte are not available without a time stamp counter\n");
+#endif
     printf("\n");
+    printf("    %-22s %-8s %12s %10s %12s\n", "function", "corpus", "bytes", "MB/s", "cycles/byte");
 
-    // print all sections
-    EntriesTraverse_t traverse;
-    int sectionIndex = 0;
-    SectionData_t* sectionData = ResumeGetSectionData(me, sectionIndex);
-    while(sectionData)
+    corpus = 0;
+    do
     {
-        int displayMax = sectionData->m_SectionDisplayMax;
-        if(ResumeOptionsIsHiddenSection(&me->m_ResumeOptions, sectionData->m_SectionTitle) == RESULT_YES)
+        BenchPrimitive_t primitive = 0;
+        if(BenchGenerateCorpus(me, corpus) == RESULT_ERROR)
         {
-            displayMax = 0;
+            printf("Error: failed to generate the %s corpus\n", g_BenchCorpusLookup[corpus]);
+            return RESULT_ERROR;
         }
 
-        if(sectionData->m_SectionDisplayMax != DISPLAY_NONE)
+        do
         {
-            int dateStringStart = 0;
-            int displayCount = 0;
-
-            // apply resume options to display max
-            if(me->m_ResumeOptions.m_ExtendedDisplayCount == DISPLAY_ALL)
-            {
-                displayMax = DISPLAY_ALL;
-            }
-            else
+            JsonState_t jsonState = JSON_STATE_OK;
+            int64_t bytes;
+            int64_t medianTime;
+            int64_t medianCycles;
+            int iteration;
+
+            // the first walk is not timed so every timed
+            // walk starts with the corpus in the caches
+            bytes = BenchJsonWalk(me, primitive, &jsonState);
+            if((jsonState != JSON_STATE_OK) || (bytes <= 0))
             {
-                displayMax += me->m_ResumeOptions.m_ExtendedDisplayCount;
+                printf("Error: %s failed on the %s corpus\n", g_BenchPrimitiveLookup[primitive], g_BenchCorpusLookup[corpus]);
+                return RESULT_ERROR;
             }
 
-            // adjust date string start position
-            if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_ALL) == DATE_OPTION_HIDE_ALL)
-            {
-                // the date is always
-                // hidden in this section
-                dateStringStart = (sizeof(dateString) - 1);
-            }
-            else if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_START) == DATE_OPTION_HIDE_START)
+            iteration = 0;
+            while(iteration < iterations)
             {
-                // the start date is always
-                // hidden in this section
-                dateStringStart = datePos[ENTRY_TIME_END];
-            }
-
-            //
-            // PRINT
-            //
-            // section title
-            //
-            printf("---------------------------------------\n");
-            printf("%s\n", sectionData->m_SectionTitle);
-            printf("---------------------------------------\n");
-
-            EntriesTraverseInit(&traverse);
-            Entry_t* entry = EntriesTraverseFirst(&traverse, &sectionData->m_SectionEntries, sectionData->m_SectionOrder, sectionData->m_SectionOrderEntryTime);
-            while(entry)
-            {
-                // format the date string
-                int datesShown = 0;
-                datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_START]], DATE_STRING_LENGTH, ENTRY_TIME_START, sectionData->m_SectionDateOption) > 0);
-                datesShown += (int)(EntryTimeToString(entry, &dateString[datePos[ENTRY_TIME_END]], DATE_STRING_LENGTH, ENTRY_TIME_END, sectionData->m_SectionDateOption) > 0);
-                if(datesShown == 2)
-                {
-                    // both dates are shown.
-                    // include the separator
-                    memcpy(&dateString[DATE_STRING_LENGTH], dateRangeSeparator, sizeof(dateRangeSeparator)-1);
-                    dateString[sizeof(dateString)-2] = ' ';
-                    dateString[sizeof(dateString)-1] = '\0';
-                }
-                else if(datesShown == 1)
-                {
-                    // only 1 or no date is shown.
-                    if((sectionData->m_SectionDateOption & DATE_OPTION_HIDE_END) == DATE_OPTION_HIDE_END)
-                    {
-                        // entire end date is hidden.
-                        // only the start date is shown.
-                        dateString[DATE_STRING_LENGTH]   = ' ';
-                        dateString[DATE_STRING_LENGTH + 1] = '\0';
-                    }
-                    else
-                    {
-                        // the end date is not hidden so
-                        // the start date must be.
-                        // fill the separator with spaces
-                        memset(&dateString[DATE_STRING_LENGTH], ' ', sizeof(dateRangeSeparator)-1);
-                        dateString[sizeof(dateString)-2] = ' ';
-                        dateString[sizeof(dateString)-1] = '\0';
-                    }
-                }
-                else
-                {
-                    // no dates shown
-                    dateString[dateStringStart] = '\0';
-                }
-
-                //
-                // PRINT
-                //
-                // date string and entry text
-                //
-                printf("     %s%s\n", &dateString[dateStringStart], entry->m_EntryText);
-
-                // check if more entries should be displayed
-                if(displayMax != DISPLAY_ALL)
+                int64_t startTime = TimeNowNano();
+                int64_t startCycles = BenchReadCycles();
+                int64_t walked = BenchJsonWalk(me, primitive, &jsonState);
+                me->m_BenchCycles[iteration] = (BenchReadCycles() - startCycles);
+                me->m_BenchTimes[iteration] = (TimeNowNano() - startTime);
+                if(walked != bytes)
                 {
-                    displayCount++;
-                    if(displayCount == displayMax)
-                    {
-                        // max display count reached.
-                        // break out of this loop
-                        break;
-                    }
+                    // every walk goes over the same bytes
+                    printf("Error: %s changed on the %s corpus\n", g_BenchPrimitiveLookup[primitive], g_BenchCorpusLookup[corpus]);
+                    return RESULT_ERROR;
                 }
+                iteration++;
+            }
 
-                entry = EntriesTraverseNext(&traverse);
+            qsort(me->m_BenchTimes, (size_t)iterations, sizeof(int64_t), BenchCompareTimes);
+            qsort(me->m_BenchCycles, (size_t)iterations, sizeof(int64_t), BenchCompareTimes);
+            medianTime = me->m_BenchTimes[iterations / 2];
+            medianCycles = me->m_BenchCycles[iterations / 2];
+            if(medianTime < 1)
+            {
+                // faster than the clock can measure
+                medianTime = 1;
             }
-            EntriesTraverseDeInit(&traverse);
 
-            //
-            // PRINT
-            //
-            // end of section
-            //
-            printf("\n");
-        }
-        else
-        {
-            // this section is hidden
+            printf("    %-22s %-8s %12lld %10.1f %12.3f\n",
+                g_BenchPrimitiveLookup[primitive],
+                g_BenchCorpusLookup[corpus],
+                (long long)bytes,
+                (((double)bytes * NANO_PER_SECOND) / ((double)medianTime * 1024.0 * 1024.0)),
+                ((double)medianCycles / (double)bytes));
+            primitive++;
         }
+        while(primitive < BENCH_PRIMITIVE_COUNT);
 
-        sectionIndex++;
-        sectionData = ResumeGetSectionData(me, sectionIndex);
+        corpus++;
     }
+    while(corpus < BENCH_CORPUS_COUNT);
 
-    //
-    // PRINT
-    //
-    // footer
-    //
-    printf("=======================================\n");
-    printf("\n");
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static Result_t ResumeFillSectionsFromJsonArray(
-    Resume_t* me,
-    const char* json)
+static int64_t BenchReadCycles(void)
 {
-    Result_t result = RESULT_OK;
+#if defined(RESUME_RDTSC)
+    return (int64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
 
-    SKIP_WHITESPACE(json);
-    if(json[0] == '[')
+/**********************************************************/
+static Result_t BenchMemoryRun(
+    Bench_t* me,
+    int* overBudget)
+{
+    if(BenchMemoryCase(me, "the built-in resume", g_ResumeJsonData, overBudget) == RESULT_ERROR)
     {
-        // sections array
-        JsonState_t jsonState = JSON_STATE_OK;
-        int jsonArrayIndex = INVALID_POSITION;
-        json = JsonArrayNextIndex((json + 1), &jsonArrayIndex, &jsonState); // recursive
-        if(jsonState == JSON_STATE_OK)
-        {
-            while(jsonArrayIndex != INVALID_POSITION)
-            {
-                if(json[0] == '{')
-                {
-                    SectionData_t* sectionData = ResumeInsertSection(me, SECTION_AT_RUNTIME);
-                    if(sectionData == NULL)
-                    {
-                        // cannot insert a new section
-                        result = RESULT_ERROR;
+        return RESULT_ERROR;
+    }
 
-                        // break out of this loop
-                        break;
-                    }
-                    else
-                    {
-                        // a new section was created and
-                        // initialized. its index is
-                        // SECTION_AT_RUNTIME. if there
-                        // was already a section at that
-                        // index it can be found at
-                        // sectionData->m_SectionNext
-                    }
+    if(BenchGenerate(me) == RESULT_ERROR)
+    {
+        printf("Error: failed to generate the benchmark resume\n");
+        return RESULT_ERROR;
+    }
 
-                    if(ResumeFillSectionFromJsonObject(me, sectionData, json) == RESULT_ERROR)
-                    {
-                        // cannot fill the section from
-                        // the json object data
-                        result = RESULT_ERROR;
+    if(BenchMemoryCase(me, "the generated resume", me->m_BenchJson.m_OutputData, overBudget) == RESULT_ERROR)
+    {
+        printf("Error: the generated resume may need a larger -DRESUME_MAX_PAGES\n");
+        return RESULT_ERROR;
+    }
 
-                        // remove the empty section data 
-                        // from the resume so it can be
-                        // deinited without removing any
-                        // sections that were already added
-                        ResumeRemoveSection(me, SECTION_AT_RUNTIME);
-                        SectionDataDeInit(sectionData);
-                        free(sectionData);
-                        sectionData = NULL;
+    return RESULT_OK;
+}
 
-                        // break out of this loop
-                        break;
-                    }
-                    else
-                    {
-                        // section filled
-                    }
-                }
-                else
-                {
-                    // not a json object.
-                    // this could be an error, but allow
-                    // this loop to try to skip to the next
-                    // array element
-                }
+/**********************************************************/
+static Result_t BenchMemoryCase(
+    Bench_t* me,
+    const char* name,
+    const char* json,
+    int* overBudget)
+{
+    ResumeOptions_t options = me->m_BenchOptions;
+    OutputBuffer_t output[FORMAT_COUNT];
+    BenchMemory_t memory;
+    int64_t* allocs = memory.m_MemoryAllocs;
+    int64_t* peak = memory.m_MemoryPeak;
+    int64_t againAllocs[FORMAT_COUNT];
+    int64_t againPeak[FORMAT_COUNT];
+    int64_t outputLength[FORMAT_COUNT];
+    int64_t liveBefore;
+    int64_t textBytes = 0;
+    int64_t entryBytes;
+    int64_t sectionBytes;
+    int entryCount;
+    int sectionCount;
+    int format;
+    int index;
+    Section_t section;
+    SectionData_t* sectionData;
+    Resume_t resume;
+    Result_t result;
 
-                // skp to the next json array element
-                json = JsonArrayNextIndex(json, &jsonArrayIndex, &jsonState); // recursive
-                if(jsonState != JSON_STATE_OK)
-                {
-                    return RESULT_ERROR;
-                }
-            }
-            // done looping through all json array elements
+    // the parallel fill is not checked
+    options.m_ThreadCount = 1;
+
+    BenchMemoryBegin(&allocs[BENCH_PHASE_INIT], &peak[BENCH_PHASE_INIT]);
+    liveBefore = peak[BENCH_PHASE_INIT];
+    result = ResumeInit(&resume, &options);
+    BenchMemoryEnd(&allocs[BENCH_PHASE_INIT], &peak[BENCH_PHASE_INIT]);
+
+    if(result != RESULT_ERROR)
+    {
+        result = ResumeLoad(&resume, json, BenchLoadMemory, &memory);
+        if(result == RESULT_ERROR)
+        {
+            ResumePrintLoadError(&resume, "%s", name);
         }
-        else
+    }
+    else
+    {
+        printf("Error: %s could not be initialized\n", name);
+    }
+
+    // each format is rendered twice. the second render
+    // reuses the output buffer so it must not allocate
+    // anything for any entry
+    format = 0;
+    do
+    {
+        BenchPhase_t phase = (format == FORMAT_HTML) ? BENCH_PHASE_RENDER_HTML : BENCH_PHASE_RENDER_TEXT;
+        OutputBufferInit(&output[format]);
+
+        BenchMemoryBegin(&allocs[phase], &peak[phase]);
+        if(result != RESULT_ERROR)
         {
-            // JsonArrayNextIndex() could not search for
-            // the first array index within the json data.
-            // check jsonState for the exact reason.
-            result = RESULT_ERROR;
+            result = ResumePrintFormat(&resume, &options, (Format_t)format, &output[format]);
+        }
+        BenchMemoryEnd(&allocs[phase], &peak[phase]);
+
+        OutputBufferClear(&output[format]);
+        BenchMemoryBegin(&againAllocs[format], &againPeak[format]);
+        if(result != RESULT_ERROR)
+        {
+            result = ResumePrintFormat(&resume, &options, (Format_t)format, &output[format]);
+        }
+        BenchMemoryEnd(&againAllocs[format], &againPeak[format]);
+
+        if(output[format].m_OutputResult == RESULT_ERROR)
+        {
+            printf("Error: %s could not be rendered\n", name);
         }
+        format++;
     }
-    else
+    while(format < FORMAT_COUNT);
+
+    // the budgets grow with the entries, sections, and
+    // text of the resume
+    entryCount = resume.m_ResumeAllEntries.m_ManagedEntries.m_EntriesUsed;
+    index = 0;
+    while(index < entryCount)
     {
-        // sections array should start with '['
-        result = RESULT_ERROR;
+        textBytes += (int64_t)strlen(resume.m_ResumeAllEntries.m_ManagedEntries.m_Entries[index]->m_EntryText) + 1;
+        index++;
+    }
+    sectionCount = 0;
+    section = 0;
+    sectionData = ResumeGetSectionData(&resume, section);
+    while(sectionData)
+    {
+        textBytes += (int64_t)strlen(sectionData->m_SectionTitle) + 1;
+        sectionCount++;
+        section++;
+        sectionData = ResumeGetSectionData(&resume, section);
     }
 
-    return result;
+    // an entry, its text, and its place in the managed
+    // entries, its section, and its traverse arrays
+    entryBytes = (int64_t)(sizeof(Entry_t) + (2 * sizeof(MemoryHeader_t)) + (3 * sizeof(Entry_t*)));
+
+    // a runtime section, its title, and its entries and
+    // traverse arrays
+    sectionBytes = (int64_t)(sizeof(SectionData_t) + (4 * sizeof(MemoryHeader_t)));
+
+    format = 0;
+    do
+    {
+        outputLength[format] = output[format].m_OutputLength;
+        OutputBufferDeInit(&output[format]);
+        format++;
+    }
+    while(format < FORMAT_COUNT);
+
+    BenchMemoryBegin(&allocs[BENCH_PHASE_DEINIT], &peak[BENCH_PHASE_DEINIT]);
+    ResumeDeInit(&resume);
+    BenchMemoryEnd(&allocs[BENCH_PHASE_DEINIT], &peak[BENCH_PHASE_DEINIT]);
+
+    if(result == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+
+    printf("Memory of %s. %d entries in %d sections\n", name, entryCount, sectionCount);
+    printf("\n");
+    printf("    %-24s %10s %10s %12s %12s\n", "phase", "allocs", "budget", "peak KB", "budget KB");
+    BenchMemoryPrint(g_BenchPhaseLookup[BENCH_PHASE_INIT],
+        allocs[BENCH_PHASE_INIT], BENCH_BUDGET_FIXED_ALLOCS,
+        peak[BENCH_PHASE_INIT], ((int64_t)(RESUME_MAX_ENTRIES * sizeof(Entry_t*)) + BENCH_BUDGET_FIXED_BYTES),
+        overBudget);
+    BenchMemoryPrint(g_BenchPhaseLookup[BENCH_PHASE_FILL],
+        allocs[BENCH_PHASE_FILL], ((3 * (int64_t)entryCount) + (4 * (int64_t)sectionCount) + BENCH_BUDGET_FIXED_ALLOCS),
+        peak[BENCH_PHASE_FILL], ((entryCount * entryBytes) + (sectionCount * sectionBytes) + textBytes + BENCH_BUDGET_FIXED_BYTES),
+        overBudget);
+    BenchMemoryPrint(g_BenchPhaseLookup[BENCH_PHASE_ORDER],
+        allocs[BENCH_PHASE_ORDER], sectionCount,
+        peak[BENCH_PHASE_ORDER], ((int64_t)entryCount * (int64_t)sizeof(Entry_t*)) + ((int64_t)sectionCount * (int64_t)sizeof(MemoryHeader_t)),
+        overBudget);
+    format = 0;
+    do
+    {
+        BenchPhase_t phase = (format == FORMAT_HTML) ? BENCH_PHASE_RENDER_HTML : BENCH_PHASE_RENDER_TEXT;
+        char againName[32];
+        snprintf(againName, sizeof(againName), "%s again", g_BenchPhaseLookup[phase]);
+
+        // the output buffer at most doubles past the
+        // length of the output
+        BenchMemoryPrint(g_BenchPhaseLookup[phase],
+            allocs[phase], BENCH_BUDGET_RENDER_ALLOCS,
+            peak[phase], ((2 * outputLength[format]) + OUTPUT_BUFFER_INITIAL_SIZE),
+            overBudget);
+        BenchMemoryPrint(againName, againAllocs[format], 0, againPeak[format], 0, overBudget);
+        format++;
+    }
+    while(format < FORMAT_COUNT);
+    BenchMemoryPrint(g_BenchPhaseLookup[BENCH_PHASE_DEINIT],
+        allocs[BENCH_PHASE_DEINIT], 0,
+        peak[BENCH_PHASE_DEINIT], 0,
+        overBudget);
+
+    // everything the resume allocated must be freed
+    BenchMemoryBegin(&allocs[BENCH_PHASE_DEINIT], &peak[BENCH_PHASE_DEINIT]);
+    if(peak[BENCH_PHASE_DEINIT] != liveBefore)
+    {
+        printf("    leaked %lld bytes\n", (long long)(peak[BENCH_PHASE_DEINIT] - liveBefore));
+        (*overBudget)++;
+    }
+    printf("\n");
+
+    return RESULT_OK;
 }
 
 /**********************************************************/
-static Result_t ResumeFillSectionFromJsonObject(
-    Resume_t* me,
-    SectionData_t* sectionData,
-    const char* json)
+static void BenchLoadMemory(
+    LoadPhase_t phase,
+    void* userData)
 {
-    Result_t result = RESULT_OK;
+    BenchMemory_t* memory = (BenchMemory_t*)userData;
 
-    SKIP_WHITESPACE(json);
-    if(json[0] == '{')
+    switch(phase)
     {
-        // section object
-        JsonState_t jsonState = JSON_STATE_OK;
-        const char* key;
-        int keyLength;
-        const char* nextKey;
-        int nextKeyLength;
-        const char* value;
-        int valueLength;
+    case LOAD_PHASE_FILL:
+    {
+        BenchMemoryBegin(&memory->m_MemoryAllocs[BENCH_PHASE_FILL], &memory->m_MemoryPeak[BENCH_PHASE_FILL]);
+    }
+    break;
 
-        json = JsonSkipToNextValue((json + 1), &key, &keyLength, &jsonState);
-        while(keyLength > 2)
-        {
-            value = json;
-            valueLength = JsonValueDataLength(json, &jsonState);
-            if(valueLength == 0)
-            {
-                // value is missing
-                result = RESULT_ERROR;
-                break;
-            }
-            json = JsonSkipToNextValue((json + valueLength), &nextKey, &nextKeyLength, &jsonState);
+    case LOAD_PHASE_FILL_JSON:
+    {
+        // the hard-coded and json sections are both
+        // counted as filling
+    }
+    break;
 
-            key++;
-            keyLength -= 2;
-            if(strncmp(RESUME_STRING_NAME, key, keyLength) == 0)
-            {
-                if(valueLength >= 2)
-                {
-                    if(SectionDataSetTitleSubstr(sectionData, value+1, valueLength-2) == RESULT_ERROR)
-                    {
-                        result = RESULT_ERROR;
-                    }
-                }
-            }
-            else if(strncmp(RESUME_STRING_DATE_ORDER, key, keyLength) == 0)
-            {
-                if(valueLength >= 2)
-                {
-                    if(strncmp(RESUME_STRING_DATE_END, value+1, valueLength-2) == 0)
-                    {
-                        sectionData->m_SectionOrderEntryTime = ENTRY_TIME_END;
-                    }
-                }
-            }
-            else if(strncmp(RESUME_STRING_DATE_OPTION, key, keyLength) == 0)
-            {
-                if(valueLength >= 2)
-                {
-                    if(strncmp(RESUME_STRING_SHOW_YEAR_ONLY, value+1, valueLength-2) == 0)
-                    {
-                        sectionData->m_SectionDateOption = DATE_OPTION_SHOW_YEAR_ONLY;
-                    }
-                }
-            }
-            else if(strncmp(RESUME_STRING_DISPLAY_MAX, key, keyLength) == 0)
-            {
-                int displayMax;
-                if(sscanf(value, "%d", &displayMax) == 1)
-                {
-                    sectionData->m_SectionDisplayMax = displayMax;
-                }
-                else
-                {
-                    // parsing failed
-                    result = RESULT_ERROR;
-                }
-            }
-            else if(strncmp(RESUME_STRING_ORDER, key, keyLength) == 0)
-            {
-                if(valueLength >= 2)
-                {
-                    if(strncmp(RESUME_STRING_NEWEST_FIRST, value+1, valueLength-2) == 0)
-                    {
-                        sectionData->m_SectionOrder = ORDER_NEWEST_FIRST;
-                    }
-                    else if(strncmp(RESUME_STRING_OLDEST_FIRST, value+1, valueLength-2) == 0)
-                    {
-                        sectionData->m_SectionOrder = ORDER_OLDEST_FIRST;
-                    }
-                    else if(strncmp(RESUME_STRING_RANDOM, value+1, valueLength-2) == 0)
-                    {
-                        sectionData->m_SectionOrder = ORDER_RANDOM;
-                    }
-                }
-            }
-            else if(strncmp(RESUME_STRING_ENTRIES, key, keyLength) == 0)
-            {
-                if(ResumeFillEntriesFromJsonArray(me, sectionData, value) == RESULT_ERROR)
-                {
-                    result = RESULT_ERROR;
-                }
-            }
+    case LOAD_PHASE_ORDER:
+    {
+        BenchMemoryEnd(&memory->m_MemoryAllocs[BENCH_PHASE_FILL], &memory->m_MemoryPeak[BENCH_PHASE_FILL]);
+        BenchMemoryBegin(&memory->m_MemoryAllocs[BENCH_PHASE_ORDER], &memory->m_MemoryPeak[BENCH_PHASE_ORDER]);
+    }
+    break;
 
-            key = nextKey;
-            keyLength = nextKeyLength;
-        }
-        // done looping through all json object values
+    case LOAD_PHASE_DONE:
+    {
+        BenchMemoryEnd(&memory->m_MemoryAllocs[BENCH_PHASE_ORDER], &memory->m_MemoryPeak[BENCH_PHASE_ORDER]);
     }
-    else
+    break;
+
+    default:
     {
-        // section object should start with '{'
-        result = RESULT_ERROR;
+        // not a phase
     }
+    break;
+    }
+}
 
-    return result;
+/**********************************************************/
+static void BenchMemoryBegin(
+    int64_t* allocs,
+    int64_t* live)
+{
+    MemoryCounters_t counters;
+    MemoryGetCounters(MEMORY_COUNT, &counters);
+    (*allocs) = (counters.m_CountAllocs + counters.m_CountReallocs);
+    (*live) = counters.m_CountLive;
+    MemoryResetPhasePeak();
 }
 
 /**********************************************************/
-static Result_t ResumeFillEntriesFromJsonArray(
-    Resume_t* me, 
-    SectionData_t* sectionData,
-    const char* json)
+static void BenchMemoryEnd(
+    int64_t* allocs,
+    int64_t* live)
 {
-    Result_t result = RESULT_OK;
+    MemoryCounters_t counters;
+    MemoryGetCounters(MEMORY_COUNT, &counters);
+    (*allocs) = ((counters.m_CountAllocs + counters.m_CountReallocs) - (*allocs));
+    (*live) = (MemoryGetPhasePeak() - (*live));
+}
 
-    SKIP_WHITESPACE(json);
-    if(json[0] == '[')
+/**********************************************************/
+static void BenchMemoryPrint(
+    const char* name,
+    int64_t allocs,
+    int64_t maxAllocs,
+    int64_t peak,
+    int64_t maxPeak,
+    int* overBudget)
+{
+    Result_t over = ((allocs > maxAllocs) || (peak > maxPeak)) ? RESULT_YES : RESULT_NO;
+
+    printf("    %-24s %10lld %10lld %12.1f %12.1f%s\n",
+        name,
+        (long long)allocs,
+        (long long)maxAllocs,
+        ((double)peak / 1024.0),
+        ((double)maxPeak / 1024.0),
+        (over == RESULT_YES) ? " over budget" : "");
+    if(over == RESULT_YES)
     {
-        // entries array
-        JsonState_t jsonState = JSON_STATE_OK;
-        int jsonArrayIndex = INVALID_POSITION;
-        json = JsonArrayNextIndex((json + 1), &jsonArrayIndex, &jsonState); // recursive
-        if(jsonState == JSON_STATE_OK)
-        {
-            while(jsonArrayIndex != INVALID_POSITION)
-            {
-                if(json[0] == '{')
-                {
-                    // entry object
-                    const char* nextJson;
-                    const char* key;
-                    int keyLength;
-                    const char* nextKey;
-                    int nextKeyLength;
-                    const char* value;
-                    int valueLength;
-                    const char* text = NULL;
-                    int textLength = 0;
-                    const char* startDate = NULL;
-                    const char* endDate = NULL;
+        (*overBudget)++;
+    }
+}
 
-                    nextJson = JsonSkipToNextValue((json + 1), &key, &keyLength, &jsonState);
-                    while(keyLength > 2)
-                    {
-                        value = nextJson;
-                        valueLength = JsonValueDataLength(nextJson, &jsonState);
-                        if(valueLength == 0)
-                        {
-                            // value is missing
-                            result = RESULT_ERROR;
-                            break;
-                        }
-                        nextJson = JsonSkipToNextValue((nextJson + valueLength), &nextKey, &nextKeyLength, &jsonState);
+// MARK: --- GOLDEN ---
 
-                        key++;
-                        keyLength -= 2;
-                        if(strncmp(RESUME_STRING_TEXT, key, keyLength) == 0)
-                        {
-                            if(valueLength >= 2)
-                            {
-                                text = value + 1;
-                                textLength = valueLength - 2;
-                            }
-                        }
-                        else if(strncmp(RESUME_STRING_DATE_START, key, keyLength) == 0)
-                        {
-                            if(valueLength > 2)
-                            {
-                                startDate = value + 1;
-                            }
-                        }
-                        else if(strncmp(RESUME_STRING_DATE_END, key, keyLength) == 0)
-                        {
-                            if(valueLength > 2)
-                            {
-                                endDate = value + 1;
-                            }
-                        }
+/**********************************************************/
+static void GoldenInit(
+    Golden_t* me,
+    const char* directory,
+    Result_t update,
+    ResumeOptions_t* options)
+{
+    me->m_GoldenDirectory = directory;
+    me->m_GoldenUpdate = update;
+    BenchInit(&me->m_GoldenBench, options);
+    OutputBufferInit(&me->m_GoldenOutput);
+    OutputBufferInit(&me->m_GoldenRepeat);
+    OutputBufferInit(&me->m_GoldenExpected);
+    OutputBufferInit(&me->m_GoldenBaseline);
+    OutputBufferInit(&me->m_GoldenNewBaseline);
+    me->m_GoldenChecked = 0;
+    me->m_GoldenMismatched = 0;
+    me->m_GoldenSlower = 0;
+    me->m_GoldenRecorded = 0;
+    me->m_GoldenMissing = 0;
+}
 
-                        key = nextKey;
-                        keyLength = nextKeyLength;
-                    }
-                    // done looping through all json object values
+/**********************************************************/
+static void GoldenDeInit(
+    Golden_t* me)
+{
+    BenchDeInit(&me->m_GoldenBench);
+    OutputBufferDeInit(&me->m_GoldenOutput);
+    OutputBufferDeInit(&me->m_GoldenRepeat);
+    OutputBufferDeInit(&me->m_GoldenExpected);
+    OutputBufferDeInit(&me->m_GoldenBaseline);
+    OutputBufferDeInit(&me->m_GoldenNewBaseline);
+}
 
-                    if(SectionAddEntry(sectionData, me, text, textLength, startDate, endDate) == RESULT_ERROR)
-                    {
-                        result = RESULT_ERROR;
-                    }
-                }
-                else
-                {
-                    // not a json object.
-                    // this could be an error, but allow
-                    // this loop to try to skip to the next
-                    // array element
-                }
+/**********************************************************/
+static Result_t GoldenRun(
+    Golden_t* me)
+{
+    char path[GOLDEN_MAX_PATH];
+    int pathLength;
+    int caseIndex;
+
+#if defined(RESUME_STAT)
+    // --golden-update creates the directory
+    if((me->m_GoldenUpdate == RESULT_YES) &&
+       (mkdir(me->m_GoldenDirectory, 0777) != 0) && (errno != EEXIST))
+    {
+        printf("Error: failed to create golden directory \"%s\"\n", me->m_GoldenDirectory);
+        return RESULT_ERROR;
+    }
+#endif
+
+    pathLength = snprintf(path, sizeof(path), "%s/%s", me->m_GoldenDirectory, GOLDEN_BASELINE_FILE);
+    if((pathLength < 0) || (pathLength >= (int)sizeof(path)))
+    {
+        printf("Error: golden directory \"%s\" is too long\n", me->m_GoldenDirectory);
+        return RESULT_ERROR;
+    }
+    if(me->m_GoldenUpdate == RESULT_YES)
+    {
+        // every output is recorded in a new baseline
+    }
+    else if(MainReadFile(path, &me->m_GoldenBaseline) == RESULT_ERROR)
+    {
+        // no render time is compared
+        printf("Error: golden baseline \"%s\" is missing. run --golden-update to write it\n", path);
+        OutputBufferClear(&me->m_GoldenBaseline);
+        me->m_GoldenMissing++;
+    }
+    else
+    {
+        // each render time is compared to the baseline
+    }
+    OutputBufferPrintf(&me->m_GoldenNewBaseline, "# %s Resume v%d.%02d.%02d\n", g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+    OutputBufferPrintf(&me->m_GoldenNewBaseline, "# output nanoseconds\n");
+
+    // the generated resume is the same for every run
+    if(BenchGenerate(&me->m_GoldenBench) == RESULT_ERROR)
+    {
+        printf("Error: failed to generate the golden resume\n");
+        return RESULT_ERROR;
+    }
+
+    printf("    %-28s %10s %12s %10s %12s %s\n", "output", "bytes", "fastest us", "MB/s", "baseline us", "result");
+    caseIndex = 0;
+    do
+    {
+        if((GoldenRunCase(me, "builtin", g_ResumeJsonData, &g_GoldenCases[caseIndex]) == RESULT_ERROR) ||
+           (GoldenRunCase(me, "generated", me->m_GoldenBench.m_BenchJson.m_OutputData, &g_GoldenCases[caseIndex]) == RESULT_ERROR))
+        {
+            return RESULT_ERROR;
+        }
+        caseIndex++;
+    }
+    while(caseIndex < GOLDEN_CASE_COUNT);
+
+    if(me->m_GoldenUpdate == RESULT_YES)
+    {
+        if(MainWriteOutput(path, &me->m_GoldenNewBaseline) == RESULT_ERROR)
+        {
+            printf("Error: failed to write golden baseline \"%s\"\n", path);
+            return RESULT_ERROR;
+        }
+        printf("Wrote golden baseline \"%s\"\n", path);
+    }
+
+    return RESULT_OK;
+}
+
+/**********************************************************/
+static Result_t GoldenRunCase(
+    Golden_t* me,
+    const char* inputName,
+    const char* json,
+    const GoldenCase_t* goldenCase)
+{
+    ResumeOptions_t options = me->m_GoldenBench.m_BenchOptions;
+    Result_t result = RESULT_OK;
+    Resume_t resume;
+    Batch_t batch;
+    char manifest[GOLDEN_MAX_MANIFEST];
+    int format;
+
+    // every case is filled and rendered on this thread
+    options.m_ThreadCount = 1;
+    options.m_ExtendedDisplayCount = goldenCase->m_CaseExtended;
+    options.m_HideSectionCount = 0;
+    if(goldenCase->m_CaseHide == RESULT_YES)
+    {
+        while(options.m_HideSectionCount < GOLDEN_HIDDEN_COUNT)
+        {
+            options.m_HideSectionName[options.m_HideSectionCount] = g_GoldenHidden[options.m_HideSectionCount];
+            options.m_HideSectionCount++;
+        }
+    }
 
-                // skip to the next json array element
-                json = JsonArrayNextIndex(json, &jsonArrayIndex, &jsonState); // recursive
-                if(jsonState != JSON_STATE_OK)
-                {
-                    result = RESULT_ERROR;
-                }
-            }
-            // done looping through all json array elements
+    // the manifest line is split in place so the hidden
+    // section names point into manifest until the case
+    // is done
+    BatchInit(&batch, NULL, &options);
+    if(goldenCase->m_CaseManifest)
+    {
+        int manifestLength = snprintf(manifest, sizeof(manifest), "%s", goldenCase->m_CaseManifest);
+        if((manifestLength < 0) || (manifestLength >= (int)sizeof(manifest)))
+        {
+            printf("Error: golden manifest line \"%s\" is too long\n", goldenCase->m_CaseName);
+            result = RESULT_ERROR;
         }
-        else
+        else if(BatchAddJob(&batch, manifest, manifestLength, 1) == RESULT_ERROR)
         {
-            // JsonArrayNextIndex() could not search for
-            // the first array index within the json data.
-            // check jsonState for the exact reason.
+            // the error was printed
             result = RESULT_ERROR;
         }
+        else
+        {
+            options = batch.m_BatchJobs[0].m_JobOptions;
+        }
     }
     else
     {
-        // entries array should start with '['
+        // no options from a manifest
+    }
+
+    if(ResumeInit(&resume, &options) == RESULT_ERROR)
+    {
+        printf("Error: golden resume could not be initialized\n");
         result = RESULT_ERROR;
     }
+    else if(result != RESULT_ERROR)
+    {
+        // random sections are in the same order for
+        // the same seed
+        srand(goldenCase->m_CaseSeed);
+        result = ResumeLoad(&resume, json, NULL, NULL);
+        if(result == RESULT_ERROR)
+        {
+            ResumePrintLoadError(&resume, "golden resume");
+        }
+    }
+    else
+    {
+        // the manifest line could not be parsed
+    }
+
+    format = 0;
+    while((result != RESULT_ERROR) && (format < FORMAT_COUNT))
+    {
+        char fileName[GOLDEN_MAX_NAME];
+        const char* status = NULL;
+        int64_t baseline;
+        int64_t fastest;
+        int nameLength;
+        int sample;
+
+        nameLength = snprintf(fileName, sizeof(fileName), "%s-%s.%s", inputName, goldenCase->m_CaseName, (format == FORMAT_HTML) ? "html" : "txt");
+        if((nameLength < 0) || (nameLength >= (int)sizeof(fileName)))
+        {
+            printf("Error: golden file name \"%s-%s\" is too long\n", inputName, goldenCase->m_CaseName);
+            result = RESULT_ERROR;
+            break;
+        }
+        OutputBufferClear(&me->m_GoldenOutput);
+        result = ResumePrintFormat(&resume, &options, (Format_t)format, &me->m_GoldenOutput);
+
+        // the first render is not timed so the buffer
+        // is already large enough. each sample is the
+        // average of enough renders to fill
+        // GOLDEN_MIN_SAMPLE_NANO and the fastest sample
+        // is the one least slowed by the rest of the
+        // system
+        fastest = 0;
+        sample = 0;
+        do
+        {
+            int64_t start = TimeNowNano();
+            int64_t elapsed;
+            int renders = 0;
+            do
+            {
+                OutputBufferClear(&me->m_GoldenRepeat);
+                ResumePrintFormat(&resume, &options, (Format_t)format, &me->m_GoldenRepeat);
+                renders++;
+                elapsed = (TimeNowNano() - start);
+            }
+            while(elapsed < GOLDEN_MIN_SAMPLE_NANO);
+            elapsed /= renders;
+            if((sample == 0) || (elapsed < fastest))
+            {
+                fastest = elapsed;
+            }
+            sample++;
+        }
+        while(sample < GOLDEN_SAMPLES);
+        if(fastest <= 0)
+        {
+            // the clock is too coarse
+            fastest = 1;
+        }
+
+        if(result == RESULT_ERROR)
+        {
+            printf("Error: failed to render \"%s\"\n", fileName);
+            break;
+        }
+
+        if((me->m_GoldenRepeat.m_OutputLength != me->m_GoldenOutput.m_OutputLength) ||
+           (memcmp(me->m_GoldenRepeat.m_OutputData, me->m_GoldenOutput.m_OutputData, (size_t)me->m_GoldenOutput.m_OutputLength) != 0))
+        {
+            // a golden file cannot match an output that
+            // changes each time it is rendered
+            status = "not repeatable";
+            me->m_GoldenMismatched++;
+        }
+        else if(GoldenCheck(me, fileName, &status) == RESULT_ERROR)
+        {
+            // the golden file could not be written
+            // so there is no status to print
+            result = RESULT_ERROR;
+            break;
+        }
+        else
+        {
+            // status is set
+        }
+
+        baseline = GoldenFindBaseline(me, fileName);
+        if((baseline > 0) &&
+           (fastest > ((baseline * (100 + GOLDEN_MAX_SLOWER_PERCENT)) / 100)) &&
+           (fastest > (baseline + GOLDEN_MIN_SLOWER_NANO)) &&
+           (strcmp(status, "ok") == 0))
+        {
+            status = "slower";
+            me->m_GoldenSlower++;
+        }
+        OutputBufferPrintf(&me->m_GoldenNewBaseline, "%s %lld\n", fileName, (long long)fastest);
+
+        printf("    %-28s %10d %12.1f %10.1f %12.1f %s\n",
+            fileName,
+            me->m_GoldenOutput.m_OutputLength,
+            ((double)fastest / 1000.0),
+            (((double)me->m_GoldenOutput.m_OutputLength * 1000.0) / (double)fastest),
+            ((double)baseline / 1000.0),
+            status);
+        me->m_GoldenChecked++;
+        format++;
+    }
+
+    ResumeDeInit(&resume);
+    BatchDeInit(&batch);
 
     return result;
 }
 
 /**********************************************************/
-static Result_t ResumeFillHardCoded(
-    Resume_t* me)
+static Result_t GoldenCheck(
+    Golden_t* me,
+    const char* fileName,
+    const char** status)
 {
-    if(ResumeFillSectionsFromHardCoded(me) != RESULT_OK)
+    char path[GOLDEN_MAX_PATH];
+    int pathLength;
+
+    pathLength = snprintf(path, sizeof(path), "%s/%s", me->m_GoldenDirectory, fileName);
+    if((pathLength < 0) || (pathLength >= (int)sizeof(path)))
     {
+        printf("Error: golden directory \"%s\" is too long\n", me->m_GoldenDirectory);
         return RESULT_ERROR;
     }
-
-    if(ResumeFillEntriesFromHardCoded(me) != RESULT_OK)
+    OutputBufferClear(&me->m_GoldenExpected);
+    if((me->m_GoldenUpdate == RESULT_NO) &&
+       (MainReadFile(path, &me->m_GoldenExpected) == RESULT_OK))
     {
-        return RESULT_ERROR;
+        // MainReadFile() added a null-terminator
+        int expectedLength = (me->m_GoldenExpected.m_OutputLength - 1);
+        if((expectedLength == me->m_GoldenOutput.m_OutputLength) &&
+           (memcmp(me->m_GoldenExpected.m_OutputData, me->m_GoldenOutput.m_OutputData, (size_t)expectedLength) == 0))
+        {
+            (*status) = "ok";
+        }
+        else
+        {
+            (*status) = "different";
+            me->m_GoldenMismatched++;
+            GoldenPrintDifference(me, fileName, expectedLength);
+        }
+    }
+    else if(me->m_GoldenUpdate == RESULT_YES)
+    {
+        if(MainWriteOutput(path, &me->m_GoldenOutput) == RESULT_ERROR)
+        {
+            printf("Error: failed to write golden file \"%s\"\n", path);
+            return RESULT_ERROR;
+        }
+        (*status) = "recorded";
+        me->m_GoldenRecorded++;
+    }
+    else
+    {
+        // only --golden-update writes golden files so a
+        // missing one cannot pass unnoticed
+        (*status) = "missing";
+        me->m_GoldenMissing++;
     }
 
     return RESULT_OK;
 }
 
 /**********************************************************/
-static Result_t ResumeFillSectionsFromHardCoded(
-    Resume_t* me)
+static void GoldenPrintDifference(
+    Golden_t* me,
+    const char* fileName,
+    int expectedLength)
 {
-    Result_t result = RESULT_OK;
-
-    //
-    // set title for each hard-coded section
-    //
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_EXPERIENCE], "Experience") == RESULT_ERROR)
-    {
-        me->m_ResumeErrorInSection = SECTION_EXPERIENCE;
-        result = RESULT_ERROR;
-    }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_WORK_HISTORY], "Work History") == RESULT_ERROR)
-    {
-        me->m_ResumeErrorInSection = SECTION_WORK_HISTORY;
-        result = RESULT_ERROR;
-    }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_INTERESTS], "Interests") == RESULT_ERROR)
+    const char* expected = me->m_GoldenExpected.m_OutputData;
+    const char* rendered = me->m_GoldenOutput.m_OutputData;
+    int renderedLength = me->m_GoldenOutput.m_OutputLength;
+    int offset = 0;
+    int lineStart = 0;
+    int line = 1;
+    int expectedEnd;
+    int renderedEnd;
+
+    while((offset < expectedLength) && (offset < renderedLength) && (expected[offset] == rendered[offset]))
     {
-        me->m_ResumeErrorInSection = SECTION_INTERESTS;
-        result = RESULT_ERROR;
+        if(expected[offset] == '\n')
+        {
+            lineStart = (offset + 1);
+            line++;
+        }
+        offset++;
     }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_EDUCATION], "Education") == RESULT_ERROR)
+
+    expectedEnd = lineStart;
+    while((expectedEnd < expectedLength) && (expected[expectedEnd] != '\n'))
     {
-        me->m_ResumeErrorInSection = SECTION_EDUCATION;
-        result = RESULT_ERROR;
+        expectedEnd++;
     }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_TOOLS], "Tools") == RESULT_ERROR)
+    renderedEnd = lineStart;
+    while((renderedEnd < renderedLength) && (rendered[renderedEnd] != '\n'))
     {
-        me->m_ResumeErrorInSection = SECTION_TOOLS;
-        result = RESULT_ERROR;
+        renderedEnd++;
     }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_ACCOMPLISHMENTS], "Accomplishments") == RESULT_ERROR)
+
+    printf("Error: \"%s\" is different at line %d\n", fileName, line);
+    printf("    golden:   %.*s\n", (expectedEnd - lineStart), &expected[lineStart]);
+    printf("    rendered: %.*s\n", (renderedEnd - lineStart), &rendered[lineStart]);
+}
+
+/**********************************************************/
+static int64_t GoldenFindBaseline(
+    Golden_t* me,
+    const char* fileName)
+{
+    const char* line = me->m_GoldenBaseline.m_OutputData;
+    size_t nameLength = strlen(fileName);
+
+    if(me->m_GoldenBaseline.m_OutputLength == 0)
     {
-        me->m_ResumeErrorInSection = SECTION_ACCOMPLISHMENTS;
-        result = RESULT_ERROR;
+        // no baseline
+        return 0;
     }
-    if(SectionDataSetTitle(&me->m_ResumeSection[SECTION_PROJECTS], "Projects") == RESULT_ERROR)
+
+    while((*line) != '\0')
     {
-        me->m_ResumeErrorInSection = SECTION_PROJECTS;
-        result = RESULT_ERROR;
+        if((strncmp(line, fileName, nameLength) == 0) && (line[nameLength] == ' '))
+        {
+            return (int64_t)strtoll(&line[nameLength + 1], NULL, 10);
+        }
+
+        // skip to the next line
+        line = strchr(line, '\n');
+        if(line == NULL)
+        {
+            break;
+        }
+        line++;
     }
 
-    //
-    // set section sort options
-    //
-    // default order is ORDER_NEWEST_FIRST
-    // default entry time is ENTRY_TIME_START
-    me->m_ResumeSection[SECTION_EDUCATION].m_SectionOrderEntryTime   = ENTRY_TIME_END;
-    me->m_ResumeSection[SECTION_INTERESTS].m_SectionOrder       = ORDER_RANDOM;
-    me->m_ResumeSection[SECTION_TOOLS].m_SectionOrder           = ORDER_RANDOM;
-    me->m_ResumeSection[SECTION_ACCOMPLISHMENTS].m_SectionOrder = ORDER_RANDOM;
-    me->m_ResumeSection[SECTION_PROJECTS].m_SectionOrder        = ORDER_RANDOM;
+    return 0;
+}
 
-    //
-    // set max entries to display
-    //
-    // default is DISPLAY_ALL
-    me->m_ResumeSection[SECTION_EXPERIENCE].m_SectionDisplayMax      = 6;
-    me->m_ResumeSection[SECTION_INTERESTS].m_SectionDisplayMax       = 5;
-    me->m_ResumeSection[SECTION_ACCOMPLISHMENTS].m_SectionDisplayMax = 5;
-    me->m_ResumeSection[SECTION_PROJECTS].m_SectionDisplayMax        = 5;
+// MARK: --- TRACE ---
 
-    //
-    // set date information to display
-    //
-    // default is DATE_OPTION_HIDE_ALL
-    me->m_ResumeSection[SECTION_WORK_HISTORY].m_SectionDateOption = DATE_OPTION_SHOW_YEAR_ONLY;
-    me->m_ResumeSection[SECTION_EXPERIENCE].m_SectionDateOption   = DATE_OPTION_SHOW_START_ONLY | DATE_OPTION_HIDE_START_DAY;
-    me->m_ResumeSection[SECTION_EDUCATION].m_SectionDateOption    = DATE_OPTION_SHOW_END_ONLY | DATE_OPTION_SHOW_YEAR_ONLY;
+/**********************************************************/
+static void TraceInit(
+    Trace_t* me)
+{
+    int index = 0;
+    do
+    {
+        me->m_TraceRings[index] = NULL;
+        index++;
+    }
+    while(index < TRACE_MAX_THREADS);
+    ATOMIC_INIT(&me->m_TraceRingCount, 0);
+    me->m_TraceStart = TimeNowNano();
 
-    return result;
+    // the calling thread is the first thread in the trace
+    g_TraceRing = NULL;
+    (void)TraceGetRing(me);
 }
 
 /**********************************************************/
-static Result_t ResumeFillEntriesFromHardCoded(
-    Resume_t* me)
+static void TraceDeInit(
+    Trace_t* me)
 {
-    Result_t result = RESULT_OK;
-    Section_t section;
+    int index = 0;
+    do
+    {
+        free(me->m_TraceRings[index]);
+        me->m_TraceRings[index] = NULL;
+        index++;
+    }
+    while(index < TRACE_MAX_THREADS);
+    g_TraceRing = NULL;
+}
 
-    // using INVALID_POSITION to indicate no errors
-    me->m_ResumeErrorInSection = INVALID_POSITION;
+/**********************************************************/
+static int64_t TraceBegin(void)
+{
+    if(g_Trace == NULL)
+    {
+        // the clock is only read when tracing
+        return 0;
+    }
 
-    // using ENTRY_STATE_OK to indicate no entry errors have occured
-    me->m_ResumeErrorInEntry = ENTRY_STATE_OK;
+    return TimeNowNano();
+}
 
-    //
-    // add entries to each section
-    //
+/**********************************************************/
+static void TraceEnd(
+    TraceSpan_t span,
+    const char* detail,
+    int count,
+    int64_t start)
+{
+    TraceRing_t* ring;
+    TraceEvent_t* event;
+    int length = 0;
 
-    section = SECTION_ACCOMPLISHMENTS;
-    ResumeAddEntry(me, section, "Coldfire bare-metal Ethernet driver using ring-buffer and DMA",                                         NULL, NULL);
-    ResumeAddEntry(me, section, "static memory TCP/IP library for Atmel and ported to Coldfire and AM335X (Sitara)",                     NULL, NULL);
-    ResumeAddEntry(me, section, "FAT32 library with long file name support for Atmel and ported to Coldfire and AM335X (Sitara)",        NULL, NULL);
-    ResumeAddEntry(me, section, "multi-screen touch panel GUI editor including integration with UDP data from controllers",              NULL, NULL);
-    ResumeAddEntry(me, section, "Blackfin ucLinux kernel modules for SPI and SPORT (TDM) communication with two CS42448",                NULL, NULL);
-    ResumeAddEntry(me, section, "custom board with TI CC3200 module for remote HVAC 24VAC and differential pressure monitoring",         NULL, NULL);
-    ResumeAddEntry(me, section, "iOS app for local network communication and file transfer with HVAC monitor",                           NULL, NULL);
-    ResumeAddEntry(me, section, "frame-accurate sequence timeline rendering with collapsible groups and interactive media scrubbing",    NULL, NULL);
-    ResumeAddEntry(me, section, "communication protocol and audio status monitoring for on-board ride vehicle audio player",             NULL, NULL);
-    ResumeAddEntry(me, section, "automatic detection of network modules and mounting of NFS shares for multichannel audio/video player", NULL, NULL);
-    ResumeAddEntry(me, section, "remote firmware update capability for uBoot and Linux on Blackfin",                                     NULL, NULL);
-    ResumeAddEntry(me, section, "multi-channel WAV and MP3 audio playback control and configuration software",                           NULL, NULL);
-    ResumeAddEntry(me, section, "reliable transfer of image files over Modbus using sequenced data chunks with CRC16",                   NULL, NULL);
-    ResumeAddEntry(me, section, "complete XML reader / writer with integrated motification history tracker",                             NULL, NULL);
-    ResumeAddEntry(me, section, "closed over 500 customer and end-user support tickets",                                                 NULL, NULL);
-    ResumeAddEntry(me, section, "integrated 3rd party lighting controller with train signals over the Tempe Salt River bridge",          NULL, NULL);
+    if((g_Trace == NULL) || (start == 0))
+    {
+        // not tracing
+        return;
+    }
 
-    section = SECTION_INTERESTS;
-    ResumeAddEntry(me, section, "Video Games - Dr Mario",                 NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Astro Bot",                NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Stormworks",               NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Bloons TD 6",              NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Civilization VI",          NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Donut County",             NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Minecraft",                NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Teardown",                 NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Everybody's Golf",         NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Border Bots VR",           NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Just Cause 3",             NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - TMNT: Shredder's Revenge", NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Rogue Tower",              NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Subnautica",               NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Sanctum",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Command & Conquer",        NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Homeworld",                NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Super Smash Brothers",     NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Mario Kart 8",             NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Portal",                   NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - LEGO City Undercover",     NULL, NULL);
-    ResumeAddEntry(me, section, "Video Games - Worms Armageddon",         NULL, NULL);
+    ring = TraceGetRing(g_Trace);
+    if(ring == NULL)
+    {
+        // too many threads
+        return;
+    }
+
+    event = &ring->m_RingEvents[ring->m_RingWritten % TRACE_RING_SIZE];
+    event->m_EventSpan = span;
+    event->m_EventCount = count;
+    event->m_EventStart = start;
+    event->m_EventDuration = (TimeNowNano() - start);
+    if(detail)
+    {
+        while((length < (TRACE_MAX_DETAIL - 1)) && (detail[length] != '\0'))
+        {
+            event->m_EventDetail[length] = detail[length];
+            length++;
+        }
+    }
+    else
+    {
+        // no detail
+    }
+    event->m_EventDetail[length] = '\0';
+    ring->m_RingWritten++;
+}
 
-    ResumeAddEntry(me, section, "Sports - Flag Football", NULL, NULL);
-    ResumeAddEntry(me, section, "Sports - Basketball",    NULL, NULL);
-    ResumeAddEntry(me, section, "Sports - Tae Kwon Do",   NULL, NULL);
-    ResumeAddEntry(me, section, "Sports - Racquetball",   NULL, NULL);
-    ResumeAddEntry(me, section, "Sports - Crossfit",      NULL, NULL);
-    ResumeAddEntry(me, section, "Sports - Fun Run/Walk",  NULL, NULL);
+/**********************************************************/
+static TraceRing_t* TraceGetRing(
+    Trace_t* me)
+{
+    if(g_TraceRing == NULL)
+    {
+        // the first event of this thread.
+        // claiming a ring is the only atomic operation
+        int index = ATOMIC_FETCH_ADD(&me->m_TraceRingCount, 1);
+        if(index < TRACE_MAX_THREADS)
+        {
+            TraceRing_t* ring = (TraceRing_t*)malloc(sizeof(TraceRing_t));
+            if(ring)
+            {
+                ring->m_RingWritten = 0;
+                ring->m_RingThread = (index + 1);
+                me->m_TraceRings[index] = ring;
+                g_TraceRing = ring;
+            }
+            else
+            {
+                // failed to allocate memory
+            }
+        }
+        else
+        {
+            // too many threads
+        }
+    }
 
-    ResumeAddEntry(me, section, "Movies - Rat Race",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Stargate",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Robin Hood: Men in Tights", NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Despicable Me",             NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Down Periscope",            NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Crazy Rich Asians",         NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - The Last Samurai",          NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - LEGO Movie",                NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Tron: Legacy",              NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Mars Attacks",              NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Demolition Man",            NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Harry Potter",              NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Lord of the Rings",         NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - First Knight",              NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Gaurdians of the Galaxy",   NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Contact",                   NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Hotel Transylvania",        NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Idiocracy",                 NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Independence Day",          NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - John Carter",               NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Inside Out",                NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Jurassic Park",             NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Pitch Perfect",             NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - TMNT",                      NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Trolls",                    NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Valerian",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - The Fifth Element",         NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - The Matrix",                NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - The Hunt for Red October",  NULL, NULL);
-    ResumeAddEntry(me, section, "Movies - Groundhog Day",             NULL, NULL);
+    return g_TraceRing;
+}
 
-    ResumeAddEntry(me, section, "Music - Noisestorm",           NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Stray Kids",           NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Robert Miles",         NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Sofi Tucker",          NULL, NULL);
-    ResumeAddEntry(me, section, "Music - They Might be Giants", NULL, NULL);
-    ResumeAddEntry(me, section, "Music - BTS",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Aespa",                NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Miami Sound Machine",  NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Vangelis",             NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Daft Punk",            NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Lionel Richie",        NULL, NULL);
-    ResumeAddEntry(me, section, "Music - The Black Eyed Peas",  NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Olive",                NULL, NULL);
-    ResumeAddEntry(me, section, "Music - Sade",                 NULL, NULL);
+/**********************************************************/
+static Result_t TraceWrite(
+    Trace_t* me,
+    OutputBuffer_t* output)
+{
+    int64_t dropped = 0;
+    int ringCount = ATOMIC_LOAD(&me->m_TraceRingCount);
+    int index = 0;
 
-    section = SECTION_WORK_HISTORY;
-    ResumeAddEntry(me, section, "Alcorn McBride",                       "2006-02-06", NULL);
+    OutputBufferPrintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    OutputBufferPrintf(output, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"%s Resume v%d.%02d.%02d\"}}",
+        g_ResumeFullName, MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+    while(index < ringCount)
+    {
+        TraceRing_t* ring;
+        int64_t event;
 
-    section = SECTION_EDUCATION;
-    ResumeAddEntry(me, section, "Bachelor of Science - Computer Science - Stetson University", "1999-08-01", "2003-05-01");
+        if(index >= TRACE_MAX_THREADS)
+        {
+            // these threads did not record any events
+            break;
+        }
 
-    section = SECTION_EXPERIENCE;
-    ResumeAddEntry(me, section, "add feature to adjust panel pc rotation by integrating a Powershell script with an existing Qt application",         "2024-01-01", NULL);
-    ResumeAddEntry(me, section, "fix bug in Product File Creator where user defined spaces were being stripped from the final output",                "2024-03-01", NULL);
-    ResumeAddEntry(me, section, "fix script import bugs that allowed script password to be bypassed",                                                 "2024-08-01", NULL);
-    ResumeAddEntry(me, section, "fix script import bugs to identify when literals are used in place of variables for \"if\" events",                  "2024-08-01", NULL);
-    ResumeAddEntry(me, section, "guide junior developer to integrate timecode conversion function into expression parser",                            "2024-09-01", NULL);
-    ResumeAddEntry(me, section, "generate jenkins pipelines for RideAmp and VPage Utils projects for Visual Studio 2022",                             "2024-11-01", NULL);
-    ResumeAddEntry(me, section, "allow expression parser to include variable names with special characters and spaces",                               "2023-04-01", NULL);
-    ResumeAddEntry(me, section, "fix memory leak in one-shot sequences by tracing the code paths used to allocate each event",                        "2023-02-01", NULL);
-    ResumeAddEntry(me, section, "organize product files and reformat all xml simplify compare and merge operations",                                  "2022-11-01", NULL);
-    ResumeAddEntry(me, section, "allow copy and paste between WinScript Live version 5 and 6",                                                        "2022-12-01", NULL);
-    ResumeAddEntry(me, section, "expand live mode sequence status to include pre-roll and looping states",                                            "2022-07-01", NULL);
-    ResumeAddEntry(me, section, "allow winscriot live events view to split display of grid and timeline in the same frame",                           "2022-05-01", NULL);
-    ResumeAddEntry(me, section, "modify timeline graphics to match WinScript live 6 mockups",                                                         "2022-03-01", NULL);
-    ResumeAddEntry(me, section, "fix problem loading fonts that have the same name but different weights",                                            "2021-06-01", NULL);
-    ResumeAddEntry(me, section, "redesign button action dialog to allow multiple actions for release and a separate action for press",                "2021-03-01", NULL);
-    ResumeAddEntry(me, section, "simplify Visual Studio projects using property sheets",                                                              "2021-01-31", NULL);
-    ResumeAddEntry(me, section, "improve GPS parser to support decimal degrees from GPRMC messages",                                                  "2013-10-01", NULL);
-    ResumeAddEntry(me, section, "use PHP to load raw json data from a database then convert it for use with FusionCharts XT Javscript library",       "2019-12-01", NULL);
-    ResumeAddEntry(me, section, "add feature to WinScript Live to track the active sequence and automatically display all variables in a watch list", "2024-05-01", NULL);
-    ResumeAddEntry(me, section, "improve visibility into sequence scheduling by integrating a time database into the debug code",                     "2024-07-01", NULL);
-    ResumeAddEntry(me, section, "update ShowTouch to work with latest OEM panel pc running Windows 10 IoT",                                           "2024-07-01", NULL);
+        ring = me->m_TraceRings[index];
+        index++;
+        if(ring == NULL)
+        {
+            // failed to allocate the ring
+            continue;
+        }
 
-    section = SECTION_TOOLS;
-    ResumeAddEntry(me, section, "Git / github.com / bitbucket.org", NULL, NULL);
-    ResumeAddEntry(me, section, "SVN",                              NULL, NULL);
-    ResumeAddEntry(me, section, "Microsoft Visual Studio",          NULL, NULL);
-    ResumeAddEntry(me, section, "Eclipse / ARM DS5",                NULL, NULL);
-    ResumeAddEntry(me, section, "Qt Creator",                       NULL, NULL);
-    ResumeAddEntry(me, section, "Corel Draw",                       NULL, NULL);
-    ResumeAddEntry(me, section, "Adobe Photoshop",                  NULL, NULL);
-    ResumeAddEntry(me, section, "Adobe After Effects",              NULL, NULL);
-    ResumeAddEntry(me, section, "Wireshark / tcpdump",              NULL, NULL);
-    ResumeAddEntry(me, section, "VS Code",                          NULL, NULL);
-    ResumeAddEntry(me, section, "VMWare Workstation / Virtual Box", NULL, NULL);
+        if(ring->m_RingThread == 1)
+        {
+            OutputBufferPrintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}");
+        }
+        else
+        {
+            OutputBufferPrintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"worker %d\"}}",
+                ring->m_RingThread, (ring->m_RingThread - 1));
+        }
 
-    section = SECTION_PROJECTS;
-    ResumeAddEntry(me, section, "bottle cap motion sensor using Arduino with C++",                                                        NULL, NULL);
-    ResumeAddEntry(me, section, "digital audio recorder settings GUI using Qt for Windows and MacOS",                                     NULL, NULL);
-    ResumeAddEntry(me, section, "\"Yuri on Ice\" themed ice-skating game using HTML5, Zim, and Javascript",                               NULL, NULL);
-    ResumeAddEntry(me, section, "UDP tool using Qt and Npcap to monitor, send, and receive unicast, multicast, and broadcast datagrams.", NULL, NULL);
-    ResumeAddEntry(me, section, "DMX512 visual data file editor using Qt",                                                                NULL, NULL);
-    ResumeAddEntry(me, section, "WinMerge plugin to extract XML data from a proprietary archive file format",                             NULL, NULL);
-    ResumeAddEntry(me, section, "GPS visualization tool for trigger zones and live positioning data",                                     NULL, NULL);
-    ResumeAddEntry(me, section, "text based UDP protocol and gateway server for file system, SMTP, IMAP, and HTTPS access",               NULL, NULL);
+        // oldest event first
+        event = 0;
+        if(ring->m_RingWritten > TRACE_RING_SIZE)
+        {
+            event = (ring->m_RingWritten - TRACE_RING_SIZE);
+            dropped += event;
+        }
+        while(event < ring->m_RingWritten)
+        {
+            TraceEvent_t* traceEvent = &ring->m_RingEvents[event % TRACE_RING_SIZE];
+            const char* countName = g_TraceCountLookup[traceEvent->m_EventSpan];
 
-    if(me->m_ResumeErrorInSection != INVALID_POSITION)
-    {
-        // an error occurred in a section
-        result = RESULT_ERROR;
+            // phases are named by the detail and
+            // sections by the span and title
+            OutputBufferPrintf(output, ",\n{\"name\":\"");
+            if(traceEvent->m_EventSpan != TRACE_SPAN_PHASE)
+            {
+                OutputBufferPrintf(output, "%s ", g_TraceSpanLookup[traceEvent->m_EventSpan]);
+            }
+            TraceAppendJsonText(output, traceEvent->m_EventDetail);
+            OutputBufferPrintf(output, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d",
+                g_TraceSpanLookup[traceEvent->m_EventSpan],
+                ((double)(traceEvent->m_EventStart - me->m_TraceStart) / 1000.0),
+                ((double)traceEvent->m_EventDuration / 1000.0),
+                ring->m_RingThread);
+            if(countName)
+            {
+                OutputBufferPrintf(output, ",\"args\":{\"section\":\"");
+                TraceAppendJsonText(output, traceEvent->m_EventDetail);
+                OutputBufferPrintf(output, "\",\"%s\":%d}", countName, traceEvent->m_EventCount);
+            }
+            else
+            {
+                // phases have no args
+            }
+            OutputBufferPrintf(output, "}");
+            event++;
+        }
     }
+    OutputBufferPrintf(output, "\n]}\n");
 
-    if(me->m_ResumeErrorInEntry != ENTRY_STATE_OK)
+    if(dropped > 0)
     {
-        // an error occurred in an entry
-        result = RESULT_ERROR;
+        fprintf(stderr, "Trace dropped the oldest %lld events. each thread keeps %d events\n", (long long)dropped, TRACE_RING_SIZE);
+    }
+    if(ringCount > TRACE_MAX_THREADS)
+    {
+        fprintf(stderr, "Trace dropped the events of %d threads\n", (ringCount - TRACE_MAX_THREADS));
     }
 
-    return result;
+    return output->m_OutputResult;
+}
+
+/**********************************************************/
+static void TraceAppendJsonText(
+    OutputBuffer_t* output,
+    const char* text)
+{
+    while((*text) != '\0')
+    {
+        unsigned char c = (unsigned char)(*text);
+        if((c == '"') || (c == '\\'))
+        {
+            char escaped[2] = { '\\', (char)c };
+            OutputBufferAppend(output, escaped, 2);
+        }
+        else if((c < ' ') || (c >= 0x80))
+        {
+            // resume text is Latin-1 so each byte is its
+            // own character. the trace file is utf-8
+            OutputBufferPrintf(output, "\\u%04x", (unsigned int)c);
+        }
+        else
+        {
+            OutputBufferAppend(output, text, 1);
+        }
+        text++;
+    }
 }
 
 //
@@ -4786,6 +19282,33 @@ int main(
     Resume_t resume;
     ResumeOptions_t resumeOptions = { 0 };
     unsigned int seed;
+    Format_t outputFormat[MAIN_MAX_OUTPUTS];
+    const char* outputDestination[MAIN_MAX_OUTPUTS];
+    int outputCount = 0;
+    const char* compileDestination = NULL;
+    const char* generateDestination = NULL;
+    const char* snapshotFile = NULL;
+    const char* jsonFile = NULL;
+    const char* serveSocket = NULL;
+    int httpPort = 0;
+    Result_t watch = RESULT_NO;
+    const char* batchManifest = NULL;
+    const char* batchCache = NULL;
+    const char* benchSpec = NULL;
+    const char* benchJsonSpec = NULL;
+    const char* benchMemorySpec = NULL;
+    const char* goldenDirectory = NULL;
+    Result_t goldenUpdate = RESULT_NO;
+    const char* rankFile = NULL;
+    OutputBuffer_t rankData;
+    const char* highlightFile = NULL;
+    OutputBuffer_t highlightData;
+    Highlight_t highlight;
+    Result_t printStats = RESULT_NO;
+    MainStats_t stats;
+    int64_t phaseStart;
+    const char* traceDestination = NULL;
+    Trace_t trace;
 
     // select a new random seed
     seed = (unsigned int)time(NULL);
@@ -4801,141 +19324,330 @@ int main(
             char* arg = argv[index];
             if(arg)
             {
-                if(strcmp(arg, "-h") == 0)
+                int optionExitCode = MainParseResumeOption(argc, argv, &index, &resumeOptions);
+                if(optionExitCode != EXIT_UNKNOWN_ARG)
+                {
+                    // resume option
+                    if(optionExitCode != EXIT_OK)
+                    {
+                        exitCode = optionExitCode;
+                    }
+                }
+                else if(strcmp(arg, "-h") == 0)
+                {
+                    // display help
+                    MainPrintHelp(argv[0]);
+                    return 0;
+                }
+                else if(strcmp(arg, "-v") == 0)
+                {
+                    MainPrintVersion();
+                    return 0;
+                }
+                else if(strcmp(arg, "-o") == 0)
+                {
+                    // format and destination expected
+                    index++;
+                    if(index < argc)
+                    {
+                        arg = argv[index];
+                        if(arg)
+                        {
+                            // the format ends at the first ':'
+                            // so the destination can be any
+                            // path including a drive letter
+                            const char* destination = strchr(arg, ':');
+                            if(outputCount >= MAIN_MAX_OUTPUTS)
+                            {
+                                exitCode = EXIT_OUTPUT_TOO_MANY;
+                                printf("Error: too many outputs. max is %d\n", MAIN_MAX_OUTPUTS);
+                            }
+                            else if((destination == NULL) || (destination[1] == '\0'))
+                            {
+                                exitCode = EXIT_OUTPUT_DESTINATION_MISSING;
+                                printf("Error: output destination is missing \"%s\"\n", arg);
+                            }
+                            else if(MainParseFormat(arg, &outputFormat[outputCount]) == RESULT_ERROR)
+                            {
+                                exitCode = EXIT_OUTPUT_UNKNOWN_FORMAT;
+                                printf("Error: unknown output format \"%s\"\n", arg);
+                            }
+                            else
+                            {
+                                outputDestination[outputCount] = (destination + 1);
+                                outputCount++;
+                            }
+                        }
+                        else
+                        {
+                            exitCode = EXIT_OUTPUT_ARG_MISSING;
+                            printf("Error: output arg data is missing\n");
+                        }
+                    }
+                    else
+                    {
+                        exitCode = EXIT_OUTPUT_SELECTION_MISSING;
+                        printf("Error: output selection is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--compile") == 0)
+                {
+                    // snapshot destination expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        compileDestination = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_COMPILE_DESTINATION_MISSING;
+                        printf("Error: compile destination is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--generate") == 0)
+                {
+                    // generated source destination expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        generateDestination = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_GENERATE_DESTINATION_MISSING;
+                        printf("Error: generate destination is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "-j") == 0)
+                {
+                    // json file expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        jsonFile = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_JSON_FILE_MISSING;
+                        printf("Error: json file is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--serve") == 0)
+                {
+                    // socket path expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        // replaces --http
+                        serveSocket = argv[index];
+                        httpPort = 0;
+                    }
+                    else
+                    {
+                        exitCode = EXIT_SERVE_SOCKET_MISSING;
+                        printf("Error: serve socket is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--http") == 0)
+                {
+                    // port expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        int portLength = 0;
+                        int argLength = (int)strlen(argv[index]);
+                        if((StringToInt(argv[index], argLength, &httpPort, &portLength) == RESULT_OK) &&
+                           (portLength == argLength) &&
+                           (httpPort >= 1) &&
+                           (httpPort <= SERVER_PORT_MAX))
+                        {
+                            // replaces --serve
+                            serveSocket = NULL;
+                        }
+                        else
+                        {
+                            exitCode = EXIT_HTTP_PORT_INVALID;
+                            printf("Error: invalid http port \"%s\"\n", argv[index]);
+                        }
+                    }
+                    else
+                    {
+                        exitCode = EXIT_HTTP_PORT_MISSING;
+                        printf("Error: http port is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--watch") == 0)
+                {
+                    watch = RESULT_YES;
+                }
+                else if(strcmp(arg, "--batch") == 0)
+                {
+                    // manifest expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        batchManifest = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_BATCH_MANIFEST_MISSING;
+                        printf("Error: batch manifest is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--cache") == 0)
                 {
-                    // display help
-                    MainPrintHelp(argv[0]);
-                    return 0;
+                    // cache file expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        batchCache = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_BATCH_CACHE_MISSING;
+                        printf("Error: batch cache is missing\n");
+                    }
                 }
-                else if(strcmp(arg, "-v") == 0)
+                else if(strcmp(arg, "--bench") == 0)
                 {
-                    MainPrintVersion();
-                    return 0;
+                    // spec expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        benchSpec = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_BENCH_SPEC_MISSING;
+                        printf("Error: benchmark spec is missing\n");
+                    }
                 }
-                else if(strcmp(arg, "-H") == 0)
+                else if(strcmp(arg, "--bench-json") == 0)
                 {
-                    // hidden section title expected
+                    // spec expected
                     index++;
-                    if(index < argc)
+                    if((index < argc) && (argv[index]))
                     {
-                        arg = argv[index];
-                        if(arg)
-                        {
-                            if(resumeOptions.m_HideSectionCount < RESUME_OPTIONS_MAX_HIDDEN_SECTIONS)
-                            {
-                                resumeOptions.m_HideSectionName[resumeOptions.m_HideSectionCount] = arg;
-                                resumeOptions.m_HideSectionCount++;
-                            }
-                            else
-                            {
-                                // out of resume options hidden sections
-                            }
-                        }
-                        else
-                        {
-                            // invalid section name
-                        }
+                        benchJsonSpec = argv[index];
                     }
                     else
                     {
-                        // missing section name
+                        exitCode = EXIT_BENCH_SPEC_MISSING;
+                        printf("Error: benchmark spec is missing\n");
                     }
                 }
-                else if(strcmp(arg, "-f") == 0)
+                else if(strcmp(arg, "--bench-memory") == 0)
                 {
-                    // format expected
+                    // spec expected
                     index++;
-                    if(index < argc)
+                    if((index < argc) && (argv[index]))
                     {
-                        arg = argv[index];
-                        if(arg)
-                        {
-                            switch(arg[0])
-                            {
-                            case 'H': // fall-through
-                            case 'h':
-                            {
-                                resumeOptions.m_DisplayFormat = FORMAT_HTML;
-                            }
-                            break;
-
-                            case 'T': // fall-through
-                            case 't':
-                            {
-                                resumeOptions.m_DisplayFormat = FORMAT_TEXT;
-                            }
-                            break;
+                        benchMemorySpec = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_BENCH_SPEC_MISSING;
+                        printf("Error: benchmark spec is missing\n");
+                    }
+                }
+                else if((strcmp(arg, "--golden") == 0) ||
+                        (strcmp(arg, "--golden-update") == 0))
+                {
+                    goldenUpdate = (strcmp(arg, "--golden-update") == 0) ? RESULT_YES : RESULT_NO;
 
-                            default:
-                            {
-                                exitCode = EXIT_FORMAT_UNKNOWN_ARG;
-                                printf("Error: unknown format arg \"%s\"\n", arg);
-                            }
-                            break;
-                            }
-                        }
-                        else
-                        {
-                            exitCode = EXIT_FORMAT_ARG_MISSING;
-                            printf("Error: format arg data is missing\n");
-                        }
+                    // directory expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        goldenDirectory = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_GOLDEN_DIRECTORY_MISSING;
+                        printf("Error: golden directory is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--rank") == 0)
+                {
+                    // keyword or job description file expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        rankFile = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_RANK_FILE_MISSING;
+                        printf("Error: rank file is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--highlight") == 0)
+                {
+                    // keyword file expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        highlightFile = argv[index];
                     }
                     else
                     {
-                        exitCode = EXIT_FORMAT_SELECTION_MISSING;
-                        printf("Error: format selection is missing\n");
+                        exitCode = EXIT_HIGHLIGHT_FILE_MISSING;
+                        printf("Error: highlight file is missing\n");
                     }
                 }
-                else if(strcmp(arg, "-a") == 0)
+                else if(strcmp(arg, "--stats") == 0)
                 {
-                    resumeOptions.m_ExtendedDisplayCount = DISPLAY_ALL;
+                    printStats = RESULT_YES;
                 }
-                else if(strcmp(arg, "-e") == 0)
+                else if(strcmp(arg, "--trace") == 0)
                 {
-                    // additional entry count expected
+                    // trace file expected
                     index++;
-                    if(index < argc)
+                    if((index < argc) && (argv[index]))
                     {
-                        arg = argv[index];
-                        if(arg)
-                        {
-                            int count;
-                            if(sscanf(arg, "%d", &count) != 1)
-                            {
-                                // parsing failed
-                                count = 0;
-                            }
-
-                            if((count >= 1) && (count <= RESUME_MAX_LINES_PER_PAGE))
-                            {
-                                if(resumeOptions.m_ExtendedDisplayCount != DISPLAY_ALL)
-                                {
-                                    resumeOptions.m_ExtendedDisplayCount = count;
-                                }
-                                else
-                                {
-                                    // display all option
-                                    // already selected.
-                                    // changes to this
-                                    // option are ignored
-                                }
-                            }
-                            else
-                            {
-                                exitCode = EXIT_EXTENDED_COUNT_INVALID;
-                                printf("Error: invalid extended count \"%s\"\n", arg);
-                            }
-                        }
-                        else
+                        traceDestination = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_TRACE_FILE_MISSING;
+                        printf("Error: trace file is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--threads") == 0)
+                {
+                    // thread count expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        int countLength = 0;
+                        int argLength = (int)strlen(argv[index]);
+                        if((StringToInt(argv[index], argLength, &resumeOptions.m_ThreadCount, &countLength) != RESULT_OK) ||
+                           (countLength != argLength) ||
+                           (resumeOptions.m_ThreadCount < 1) ||
+                           (resumeOptions.m_ThreadCount > RESUME_MAX_THREADS))
                         {
-                            exitCode = EXIT_EXTENDED_COUNT_ARG_MISSING;
-                            printf("Error: extended count arg data is missing\n");
+                            exitCode = EXIT_THREADS_INVALID;
+                            printf("Error: invalid thread count \"%s\"\n", argv[index]);
                         }
                     }
                     else
                     {
-                        exitCode = EXIT_EXTENDED_COUNT_MISSING;
-                        printf("Error: extended count is missing\n");
+                        exitCode = EXIT_THREADS_MISSING;
+                        printf("Error: thread count is missing\n");
+                    }
+                }
+                else if(strcmp(arg, "--snapshot") == 0)
+                {
+                    // snapshot file expected
+                    index++;
+                    if((index < argc) && (argv[index]))
+                    {
+                        snapshotFile = argv[index];
+                    }
+                    else
+                    {
+                        exitCode = EXIT_SNAPSHOT_FILE_MISSING;
+                        printf("Error: snapshot file is missing\n");
                     }
                 }
                 else
@@ -4957,6 +19669,25 @@ int main(
         // no command line args
     }
 
+    if((exitCode == EXIT_OK) && (watch == RESULT_YES) &&
+       ((jsonFile == NULL) || ((serveSocket == NULL) && (httpPort == 0))))
+    {
+        exitCode = EXIT_WATCH_INVALID;
+        printf("Error: --watch needs -j and --serve or --http\n");
+    }
+
+    if((exitCode == EXIT_OK) && (snapshotFile) && (jsonFile))
+    {
+        exitCode = EXIT_SNAPSHOT_INVALID;
+        printf("Error: --snapshot can not be used with -j\n");
+    }
+
+    if((exitCode == EXIT_OK) && (compileDestination) && (serveSocket))
+    {
+        exitCode = EXIT_COMPILE_INVALID;
+        printf("Error: --compile can not be used with --serve\n");
+    }
+
     if(exitCode != EXIT_OK)
     {
         // previous error
@@ -4964,44 +19695,404 @@ int main(
         return exitCode;
     }
 
+    if((batchCache) && (batchManifest == NULL))
+    {
+        printf("Error: --cache is only used with --batch\n");
+        printf("\nTo view help text, run: %s -h\n", argv[0]);
+        return EXIT_BATCH_CACHE_UNUSED;
+    }
+
+    if(traceDestination)
+    {
+        // every thread records spans until the trace
+        // is written
+        TraceInit(&trace);
+        g_Trace = &trace;
+    }
+
+    if(batchManifest)
+    {
+        // every resume is loaded by the batch
+        exitCode = MainBatch(batchManifest, batchCache, &resumeOptions);
+        return MainWriteTrace(traceDestination, exitCode);
+    }
+
+    if(benchSpec)
+    {
+        // the benchmark generates its own resume
+        exitCode = MainBench(benchSpec, &resumeOptions);
+        return MainWriteTrace(traceDestination, exitCode);
+    }
+
+    if(benchJsonSpec)
+    {
+        // no resume is used
+        exitCode = MainBenchJson(benchJsonSpec);
+        return MainWriteTrace(traceDestination, exitCode);
+    }
+
+    if(benchMemorySpec)
+    {
+        // the built-in and generated resumes are used
+        exitCode = MainBenchMemory(benchMemorySpec, &resumeOptions);
+        return MainWriteTrace(traceDestination, exitCode);
+    }
+
+    if(goldenDirectory)
+    {
+        // the built-in and generated resumes are used
+        exitCode = MainGolden(goldenDirectory, goldenUpdate, &resumeOptions);
+        return MainWriteTrace(traceDestination, exitCode);
+    }
+
+    // the rank text is used by every order of the resume
+    // including each reload while serving
+    OutputBufferInit(&rankData);
+    if(rankFile)
+    {
+        if(MainReadFile(rankFile, &rankData) == RESULT_OK)
+        {
+            resumeOptions.m_RankText = rankData.m_OutputData;
+        }
+        else
+        {
+            exitCode = EXIT_RANK_FILE_READ_ERROR;
+            printf("Error: failed to read rank file \"%s\"\n", rankFile);
+            OutputBufferDeInit(&rankData);
+            return MainWriteTrace(traceDestination, exitCode);
+        }
+    }
+
+    // the keywords are built once and used by every
+    // render including each render while serving
+    OutputBufferInit(&highlightData);
+    HighlightInit(&highlight);
+    if(highlightFile)
+    {
+        if(MainReadFile(highlightFile, &highlightData) == RESULT_ERROR)
+        {
+            exitCode = EXIT_HIGHLIGHT_FILE_READ_ERROR;
+            printf("Error: failed to read highlight file \"%s\"\n", highlightFile);
+        }
+        else if(HighlightBuild(&highlight, highlightData.m_OutputData) == RESULT_ERROR)
+        {
+            exitCode = EXIT_HIGHLIGHT_KEYWORDS_INVALID;
+            printf("Error: highlight file \"%s\" has no keywords or more than %d bytes of keywords\n", highlightFile, HIGHLIGHT_MAX_KEYWORD_BYTES);
+        }
+        else
+        {
+            resumeOptions.m_Highlight = &highlight;
+        }
+
+        if(exitCode != EXIT_OK)
+        {
+            HighlightDeInit(&highlight);
+            OutputBufferDeInit(&highlightData);
+            OutputBufferDeInit(&rankData);
+            return MainWriteTrace(traceDestination, exitCode);
+        }
+    }
+
+    if(outputCount == 0)
+    {
+        // default to a single output using
+        // the format selected by -f
+        outputFormat[0] = resumeOptions.m_DisplayFormat;
+        outputDestination[0] = MAIN_OUTPUT_STDOUT;
+        outputCount = 1;
+    }
+
+    // every phase is timed but only printed with --stats
+    memset(&stats, 0, sizeof(stats));
+    phaseStart = MainStatsBegin(&stats);
     if(ResumeInit(&resume, &resumeOptions) == RESULT_OK)
     {
-        Result_t fillResult = ResumeFillHardCoded(&resume);
-        if(fillResult != RESULT_ERROR)
+        Result_t fillResult = RESULT_OK;
+        OutputBuffer_t jsonData;
+        const char* json = g_ResumeJsonData;
+
+        MainStatsAdd(&stats, STATS_PHASE_INIT, phaseStart);
+        OutputBufferInit(&jsonData);
+        if(snapshotFile)
+        {
+            // a snapshot already has every section and
+            // entry so nothing is parsed
+            phaseStart = MainStatsBegin(&stats);
+            fillResult = ResumeFillFromSnapshot(&resume, snapshotFile);
+            MainStatsAdd(&stats, STATS_PHASE_FILL_SNAPSHOT, phaseStart);
+            if(fillResult == RESULT_ERROR)
+            {
+                exitCode = EXIT_SNAPSHOT_LOAD_ERROR;
+                printf("Error: failed to load snapshot \"%s\"\n", snapshotFile);
+                ResumeDeInit(&resume);
+                HighlightDeInit(&highlight);
+                OutputBufferDeInit(&highlightData);
+                OutputBufferDeInit(&rankData);
+                return exitCode;
+            }
+            json = NULL;
+        }
+        else
         {
-            fillResult = ResumeFillSectionsFromJsonArray(&resume, g_ResumeJsonData);
+            if(jsonFile)
+            {
+                phaseStart = MainStatsBegin(&stats);
+                if(MainReadFile(jsonFile, &jsonData) == RESULT_OK)
+                {
+                    MainStatsAdd(&stats, STATS_PHASE_READ, phaseStart);
+                    json = jsonData.m_OutputData;
+                }
+                else
+                {
+                    exitCode = EXIT_JSON_FILE_READ_ERROR;
+                    printf("Error: failed to read json file \"%s\"\n", jsonFile);
+                    OutputBufferDeInit(&jsonData);
+                    ResumeDeInit(&resume);
+                    HighlightDeInit(&highlight);
+                    OutputBufferDeInit(&highlightData);
+                    OutputBufferDeInit(&rankData);
+                    return exitCode;
+                }
+            }
+#if defined(RESUME_GENERATED_DATA)
+            else
+            {
+                // the generated tables already have every
+                // section and entry so nothing is parsed
+                json = NULL;
+            }
+#endif
+
+            if(json)
+            {
+                // ResumeLoad() fills the sections from
+                // the json
+            }
+            else
+            {
+                phaseStart = MainStatsBegin(&stats);
+#if defined(RESUME_GENERATED_DATA)
+                fillResult = ResumeFillFromSnapshotTables(
+                    &resume,
+                    g_GeneratedSections,
+                    RESUME_GENERATED_SECTION_COUNT,
+                    g_GeneratedEntries,
+                    RESUME_GENERATED_ENTRY_COUNT,
+                    g_GeneratedPool,
+                    RESUME_GENERATED_POOL_SIZE);
+#else
+                fillResult = RESULT_ERROR;
+#endif
+                MainStatsAdd(&stats, STATS_PHASE_FILL_SNAPSHOT, phaseStart);
+            }
         }
 
         if(fillResult != RESULT_ERROR)
         {
-            switch(resume.m_ResumeOptions.m_DisplayFormat)
-            {
-            case FORMAT_HTML:
+            // load the same way as --batch and each reload
+            // so every section is ordered once and all
+            // outputs display the same entries in the same
+            // order
+            stats.m_StatsLoadPhase = STATS_PHASE_COUNT;
+            fillResult = ResumeLoad(&resume, json, MainStatsLoad, &stats);
+        }
+
+        // entries keep a copy of the json text
+        OutputBufferDeInit(&jsonData);
+
+        if((fillResult != RESULT_ERROR) && ((compileDestination) || (generateDestination)))
+        {
+            if(compileDestination)
             {
-                ResumePrintHtml(&resume);
+                OutputBuffer_t snapshot;
+                OutputBufferInit(&snapshot);
+                if((ResumeWriteSnapshot(&resume, &snapshot) == RESULT_ERROR) ||
+                   (MainWriteOutput(compileDestination, &snapshot) == RESULT_ERROR))
+                {
+                    exitCode = EXIT_COMPILE_WRITE_ERROR;
+                    printf("Error: failed to write snapshot \"%s\"\n", compileDestination);
+                }
+                OutputBufferDeInit(&snapshot);
             }
-            break;
 
-            case FORMAT_TEXT: // fall-through
-            default:
+            if(generateDestination)
             {
-                ResumePrintPlainText(&resume);
+                OutputBuffer_t generated;
+                OutputBufferInit(&generated);
+                if((ResumeWriteGenerated(&resume, &generated) == RESULT_ERROR) ||
+                   (MainWriteOutput(generateDestination, &generated) == RESULT_ERROR))
+                {
+                    exitCode = EXIT_GENERATE_WRITE_ERROR;
+                    printf("Error: failed to write generated source \"%s\"\n", generateDestination);
+                }
+                OutputBufferDeInit(&generated);
             }
-            break;
+
+            if(printStats == RESULT_YES)
+            {
+                MainStatsPrint(&stats, &resume);
             }
         }
-        else
+        else if((fillResult != RESULT_ERROR) && ((serveSocket) || (httpPort > 0)))
         {
-            exitCode = EXIT_FILL_ERROR;
-            if(resume.m_ResumeErrorInSection != INVALID_POSITION)
+            MainServe_t serve;
+            Server_t server;
+            ResumeShared_t shared;
+            ResumeReload_t reload;
+            Result_t listenResult;
+
+            ResumeSharedInit(&shared, &resume);
+            serve.m_ServeShared = &shared;
+            serve.m_ServeOptions = resume.m_ResumeOptions;
+            serve.m_ServeSeed = seed;
+            RenderCacheInit(&serve.m_ServeCache);
+            if(serveSocket)
+            {
+                ServerInit(&server, MainServeRequest, &serve);
+                listenResult = ServerListenUnix(&server, serveSocket);
+            }
+            else
+            {
+                ServerInit(&server, MainHttpRequest, &serve);
+                listenResult = ServerListenTcp(&server, httpPort);
+            }
+
+            if((listenResult == RESULT_OK) && (watch == RESULT_YES) &&
+               (ResumeReloadStart(&reload, &shared, jsonFile, &resumeOptions) == RESULT_ERROR))
+            {
+                exitCode = EXIT_WATCH_ERROR;
+                printf("Error: cannot watch \"%s\"\n", jsonFile);
+            }
+            else if(listenResult == RESULT_OK)
+            {
+                if(printStats == RESULT_YES)
+                {
+                    // the resume may be replaced while serving
+                    MainStatsPrint(&stats, &resume);
+                }
+                if(serveSocket)
+                {
+                    printf("Serving resume requests at \"%s\"\n", serveSocket);
+                }
+                else
+                {
+                    printf("Serving resume at http://127.0.0.1:%d/\n", httpPort);
+                }
+                fflush(stdout);
+                if(ServerRun(&server) == RESULT_ERROR)
+                {
+                    exitCode = EXIT_SERVE_ERROR;
+                    printf("Error: server stopped unexpectedly\n");
+                }
+            }
+            else if(serveSocket)
             {
-                const char* sectionTitle = ResumeGetSectionTitle(&resume, resume.m_ResumeErrorInSection);
-                printf("Error: resume could not be filled at section \"%s\" [%s]\n", sectionTitle, g_EntryStateLookup[resume.m_ResumeErrorInEntry]);
+                exitCode = EXIT_SERVE_ERROR;
+                printf("Error: cannot serve at \"%s\"\n", serveSocket);
             }
             else
             {
-                printf("Error: resume could not be filled [%s]\n", g_EntryStateLookup[resume.m_ResumeErrorInEntry]);
+                exitCode = EXIT_SERVE_ERROR;
+                printf("Error: cannot serve http on port %d\n", httpPort);
+            }
+            if((listenResult == RESULT_OK) && (watch == RESULT_YES))
+            {
+                // stopped even if it failed to start
+                ResumeReloadStop(&reload);
+            }
+            ServerDeInit(&server);
+            RenderCacheDeInit(&serve.m_ServeCache);
+
+            // the resume may have been replaced
+            ResumeSharedDeInit(&shared);
+        }
+        else if(fillResult != RESULT_ERROR)
+        {
+            // each format is rendered at most once
+            // no matter how many outputs use it.
+            // with several threads each section is
+            // rendered into its own buffer
+            OutputBuffer_t output[FORMAT_COUNT];
+            ResumeRender_t render[FORMAT_COUNT];
+            int outputRendered[FORMAT_COUNT] = { 0 };
+            int threadCount = resume.m_ResumeOptions.m_ThreadCount;
+            int outputIndex;
+            int format;
+
+            format = 0;
+            do
+            {
+                OutputBufferInit(&output[format]);
+                ResumeRenderInit(&render[format]);
+                format++;
+            }
+            while(format < FORMAT_COUNT);
+
+            outputIndex = 0;
+            do
+            {
+                format = outputFormat[outputIndex];
+                if(outputRendered[format] == 0)
+                {
+                    ResumeOptions_t outputOptions = resume.m_ResumeOptions;
+                    outputOptions.m_DisplayFormat = (Format_t)format;
+                    phaseStart = MainStatsBegin(&stats);
+                    if(threadCount > 1)
+                    {
+                        int part = 0;
+                        output[format].m_OutputResult = ResumeRenderRun(&render[format], &resume, &outputOptions, threadCount);
+                        while(part < render[format].m_RenderPartCount)
+                        {
+                            stats.m_StatsRendered[format] += render[format].m_RenderParts[part].m_OutputLength;
+                            part++;
+                        }
+                    }
+                    else
+                    {
+                        ResumePrint(&resume, &outputOptions, &output[format]);
+                        stats.m_StatsRendered[format] = output[format].m_OutputLength;
+                    }
+                    MainStatsAdd(&stats, STATS_PHASE_RENDER, phaseStart);
+                    outputRendered[format] = 1;
+                }
+
+                phaseStart = MainStatsBegin(&stats);
+                if((output[format].m_OutputResult == RESULT_ERROR) ||
+                   ((threadCount > 1) &&
+                    (MainWriteOutputs(outputDestination[outputIndex], render[format].m_RenderParts, render[format].m_RenderPartCount) == RESULT_ERROR)) ||
+                   ((threadCount <= 1) &&
+                    (MainWriteOutput(outputDestination[outputIndex], &output[format]) == RESULT_ERROR)))
+                {
+                    exitCode = EXIT_OUTPUT_WRITE_ERROR;
+                    printf("Error: failed to write output \"%s\"\n", outputDestination[outputIndex]);
+                }
+                else
+                {
+                    stats.m_StatsWritten += stats.m_StatsRendered[format];
+                }
+                MainStatsAdd(&stats, STATS_PHASE_WRITE, phaseStart);
+                outputIndex++;
+            }
+            while(outputIndex < outputCount);
+
+            if(printStats == RESULT_YES)
+            {
+                MainStatsPrint(&stats, &resume);
             }
+
+            format = 0;
+            do
+            {
+                OutputBufferDeInit(&output[format]);
+                ResumeRenderDeInit(&render[format]);
+                format++;
+            }
+            while(format < FORMAT_COUNT);
+        }
+        else
+        {
+            exitCode = EXIT_FILL_ERROR;
+            ResumePrintLoadError(&resume, "resume");
         }
     }
     else
@@ -5018,6 +20109,9 @@ int main(
         }
     }
     ResumeDeInit(&resume);
+    HighlightDeInit(&highlight);
+    OutputBufferDeInit(&highlightData);
+    OutputBufferDeInit(&rankData);
 
-    return exitCode;
+    return MainWriteTrace(traceDestination, exitCode);
 }